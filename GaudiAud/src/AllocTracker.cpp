@@ -0,0 +1,104 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+// Allocation tracking library, to be preloaded (e.g. with `gaudirun.py --preload libGaudiAllocTracker.so`).
+//
+// The malloc family of functions is replaced by thin wrappers of the glibc implementations updating the
+// per-thread counters described in AllocTracker.h. The sizes are taken from malloc_usable_size, so that the
+// deallocations can be accounted for without any bookkeeping.
+
+#include "AllocTracker.h"
+
+#include <cerrno>
+#include <cstddef>
+#include <malloc.h>
+#include <stdlib.h>
+
+extern "C" {
+// glibc entry points of the default allocator
+void* __libc_malloc( std::size_t size );
+void  __libc_free( void* ptr );
+void* __libc_calloc( std::size_t n, std::size_t size );
+void* __libc_realloc( void* ptr, std::size_t size );
+void* __libc_memalign( std::size_t alignment, std::size_t size );
+void* __libc_valloc( std::size_t size );
+void* __libc_pvalloc( std::size_t size );
+}
+
+namespace {
+  using Gaudi::AllocTracker::ThreadCounters;
+
+  // the initial-exec model guarantees that accessing the counters never allocates (which would recurse)
+  constinit thread_local ThreadCounters s_counters __attribute__( ( tls_model( "initial-exec" ) ) );
+
+  inline void countAllocation( std::size_t size ) {
+    auto& c = s_counters;
+    ++c.allocations;
+    c.allocated += size;
+    c.live += static_cast<std::int64_t>( size );
+    if ( c.live > c.peak ) c.peak = c.live;
+  }
+
+  inline void countDeallocation( std::size_t size ) {
+    auto& c = s_counters;
+    ++c.deallocations;
+    c.deallocated += size;
+    c.live -= static_cast<std::int64_t>( size );
+  }
+
+  inline void* allocated( void* ptr ) {
+    if ( ptr ) countAllocation( malloc_usable_size( ptr ) );
+    return ptr;
+  }
+} // namespace
+
+extern "C" {
+__attribute__( ( visibility( "default" ) ) ) ThreadCounters* gaudi_alloc_tracker_thread_counters() {
+  return &s_counters;
+}
+
+void* malloc( std::size_t size ) noexcept { return allocated( __libc_malloc( size ) ); }
+
+void free( void* ptr ) noexcept {
+  if ( ptr ) countDeallocation( malloc_usable_size( ptr ) );
+  __libc_free( ptr );
+}
+
+void* calloc( std::size_t n, std::size_t size ) noexcept { return allocated( __libc_calloc( n, size ) ); }
+
+void* realloc( void* ptr, std::size_t size ) noexcept {
+  const std::size_t old    = ptr ? malloc_usable_size( ptr ) : 0;
+  void*             result = __libc_realloc( ptr, size );
+  // on failure the original block is untouched, while realloc( ptr, 0 ) may release it returning nullptr
+  if ( !result && size ) return result;
+  if ( ptr ) countDeallocation( old );
+  return allocated( result );
+}
+
+void* memalign( std::size_t alignment, std::size_t size ) noexcept {
+  return allocated( __libc_memalign( alignment, size ) );
+}
+
+void* aligned_alloc( std::size_t alignment, std::size_t size ) noexcept {
+  return allocated( __libc_memalign( alignment, size ) );
+}
+
+int posix_memalign( void** memptr, std::size_t alignment, std::size_t size ) noexcept {
+  if ( alignment % sizeof( void* ) != 0 || ( alignment & ( alignment - 1 ) ) != 0 ) return EINVAL;
+  void* ptr = allocated( __libc_memalign( alignment, size ) );
+  if ( !ptr ) return ENOMEM;
+  *memptr = ptr;
+  return 0;
+}
+
+void* valloc( std::size_t size ) noexcept { return allocated( __libc_valloc( size ) ); }
+
+void* pvalloc( std::size_t size ) noexcept { return allocated( __libc_pvalloc( size ) ); }
+}
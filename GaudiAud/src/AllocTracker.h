@@ -0,0 +1,40 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <cstdint>
+
+/** Interface between the allocation tracking library (libGaudiAllocTracker.so, to be preloaded) and its users.
+ *
+ *  The library interposes the malloc family of functions (and then the default operator new and delete) to keep
+ *  per-thread allocation statistics. Each thread only updates its own counters, so they can be read without locks
+ *  from the same thread, e.g. before and after the execution of an algorithm (see AllocationAuditor).
+ */
+namespace Gaudi::AllocTracker {
+  /// Allocation statistics of a thread
+  ///
+  /// Memory released by a thread is accounted to it even if it was allocated by another one, so `live` may
+  /// be negative.
+  struct ThreadCounters {
+    std::uint64_t allocations   = 0; ///< number of allocations
+    std::uint64_t deallocations = 0; ///< number of deallocations
+    std::uint64_t allocated     = 0; ///< bytes allocated
+    std::uint64_t deallocated   = 0; ///< bytes released
+    std::int64_t  live          = 0; ///< bytes allocated minus bytes released
+    std::int64_t  peak          = 0; ///< maximum of `live` since it was last reset by a user
+  };
+
+  /// Type of the function returning the counters of the calling thread
+  using CountersFunction = ThreadCounters* (*)();
+
+  /// Name of the (C linkage) function returning the counters of the calling thread, to be looked up with dlsym
+  inline constexpr const char* countersFunctionName = "gaudi_alloc_tracker_thread_counters";
+} // namespace Gaudi::AllocTracker
@@ -0,0 +1,150 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include "AllocTracker.h"
+#include <Gaudi/Accumulators.h>
+#include <Gaudi/Auditor.h>
+#include <GaudiKernel/EventContext.h>
+#include <algorithm>
+#include <dlfcn.h>
+#include <format>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/** Accounts for the heap allocations of each algorithm, also in multi-threaded jobs.
+ *
+ *  The allocations are counted per thread by the preloaded library libGaudiAllocTracker.so (see AllocTracker.h),
+ *  and the counters of the thread executing an algorithm are compared before and after its execution, so that
+ *  concurrent algorithms do not interfere (the numbers include the nested algorithms, like the timing ones).
+ *
+ *  For each algorithm the number of allocations, the allocated bytes and the growth of the live heap (peak of the
+ *  allocated minus released bytes during the execution) are published as counters, and a summary table ordered by
+ *  allocated bytes is printed at finalize. Without the preloaded library the auditor does nothing.
+ */
+class AllocationAuditor final : public Gaudi::Auditor {
+public:
+  using Auditor::Auditor;
+
+  using Auditor::after;
+  using Auditor::before;
+
+  StatusCode initialize() override {
+    m_threadCounters = reinterpret_cast<Gaudi::AllocTracker::CountersFunction>(
+        ::dlsym( RTLD_DEFAULT, Gaudi::AllocTracker::countersFunctionName ) );
+    if ( !m_threadCounters ) {
+      warning() << "libGaudiAllocTracker.so is not preloaded (try gaudirun.py --preload libGaudiAllocTracker.so): "
+                   "allocations will not be tracked"
+                << endmsg;
+    }
+    return Auditor::initialize();
+  }
+
+  void before( std::string const& evt, std::string const& alg, EventContext const& ctx ) override {
+    if ( !m_threadCounters ) return;
+    if ( evt == Gaudi::IAuditor::Initialize ) {
+      m_stats.try_emplace( alg, this, alg );
+    } else if ( evt == Gaudi::IAuditor::Execute ) {
+      auto stats = m_stats.find( alg );
+      if ( stats == m_stats.end() ) return;
+      auto& frames = s_frames;
+      // a frame left for the same algorithm comes from an execution resumed on another thread: drop it
+      std::erase_if( frames, [&]( const Frame& f ) { return f.stats == &stats->second; } );
+      auto& frame = frames.emplace_back( &stats->second, ctx.slot(), ctx.evt() );
+      auto  c     = m_threadCounters();
+      // start tracking the peak for this execution, keeping the one of the enclosing algorithms
+      frame.start     = *c;
+      frame.outerPeak = c->peak;
+      c->peak         = c->live;
+    }
+  }
+
+  void after( std::string const& evt, std::string const& alg, EventContext const& ctx, const StatusCode& ) override {
+    if ( !m_threadCounters || evt != Gaudi::IAuditor::Execute ) return;
+    const auto c     = m_threadCounters();
+    const auto d     = *c;
+    auto       stats = m_stats.find( alg );
+    if ( stats == m_stats.end() ) return;
+    auto& frames = s_frames;
+    auto  frame  = std::find_if( frames.rbegin(), frames.rend(), [&]( const Frame& f ) {
+      return f.stats == &stats->second && f.slot == ctx.slot() && f.evt == ctx.evt();
+    } );
+    if ( frame == frames.rend() ) {
+      // execution started on another thread
+      ++m_migrated;
+      return;
+    }
+    auto& s = stats->second;
+    s.allocations += d.allocations - frame->start.allocations;
+    s.bytes += d.allocated - frame->start.allocated;
+    s.peak += std::max<std::int64_t>( d.peak - frame->start.live, 0 );
+    c->peak = std::max( c->peak, frame->outerPeak );
+    frames.erase( std::prev( frame.base() ), frames.end() );
+  }
+
+  StatusCode finalize() override {
+    if ( m_threadCounters ) {
+      std::vector<std::pair<const std::string*, const AlgStats*>> stats;
+      stats.reserve( m_stats.size() );
+      for ( const auto& [name, s] : m_stats ) {
+        if ( s.allocations.nEntries() ) stats.emplace_back( &name, &s );
+      }
+      std::sort( begin( stats ), end( stats ),
+                 []( const auto& a, const auto& b ) { return a.second->bytes.sum() > b.second->bytes.sum(); } );
+      info() << "------------------------------------------------------------------------------------" << endmsg;
+      info() << "Algorithm                      |   count   | allocs/exec |  kB/exec  | max peak (kB)" << endmsg;
+      info() << "------------------------------------------------------------------------------------" << endmsg;
+      for ( const auto& [name, s] : stats ) {
+        info() << std::format( "{:<30.30} | {:9} | {:11.1f} | {:9.2f} | {:13.2f}", *name, s->allocations.nEntries(),
+                               s->allocations.mean(), s->bytes.mean() / 1024, s->peak.max() / 1024 )
+               << endmsg;
+      }
+      info() << "------------------------------------------------------------------------------------" << endmsg;
+    }
+    return Auditor::finalize();
+  }
+
+private:
+  /// Allocations of an algorithm, per execution
+  struct AlgStats {
+    AlgStats( AllocationAuditor* owner, const std::string& alg )
+        : allocations{ owner, alg + " allocations" }
+        , bytes{ owner, alg + " allocated bytes" }
+        , peak{ owner, alg + " peak live bytes" } {}
+    Gaudi::Accumulators::StatCounter<> allocations;
+    Gaudi::Accumulators::StatCounter<> bytes;
+    Gaudi::Accumulators::StatCounter<> peak;
+  };
+
+  /// State of the thread counters at the beginning of an algorithm execution
+  struct Frame {
+    Frame( AlgStats* stats, EventContext::ContextID_t slot, EventContext::ContextEvt_t evt )
+        : stats{ stats }, slot{ slot }, evt{ evt } {}
+    AlgStats*                           stats;
+    EventContext::ContextID_t           slot;
+    EventContext::ContextEvt_t          evt;
+    Gaudi::AllocTracker::ThreadCounters start;
+    std::int64_t                        outerPeak = 0;
+  };
+
+  /// Executions in progress on the current thread (more than one for nested algorithms)
+  static thread_local std::vector<Frame> s_frames;
+
+  Gaudi::AllocTracker::CountersFunction m_threadCounters = nullptr;
+
+  /// Statistics per algorithm, filled when the algorithms are initialized (only looked up during the event loop)
+  std::unordered_map<std::string, AlgStats> m_stats;
+
+  mutable Gaudi::Accumulators::Counter<> m_migrated{ this, "Executions resumed on another thread" };
+};
+
+thread_local std::vector<AllocationAuditor::Frame> AllocationAuditor::s_frames;
+
+DECLARE_COMPONENT( AllocationAuditor )
@@ -58,7 +58,7 @@ namespace Gaudi {
     /// Manual cast by class name
     void* cast( const std::string& cl ) const override;
     /// ROOT object implementation
-    TObject* representation() const override { return m_rep.get(); }
+    TObject* representation() const override { return rep(); }
     /// Adopt ROOT histogram representation
     void adoptRepresentation( TObject* rep ) override;
     /// Get the title of the object
@@ -79,9 +79,9 @@ namespace Gaudi {
     const Axis& axis() const override { return m_axis; }
 
     /// Get the number or all the entries
-    int entries() const override { return m_rep->GetEntries(); }
+    int entries() const override { return rep()->GetEntries(); }
     /// Get the number or all the entries, both in range and underflow/overflow bins of the IProfile.
-    int allEntries() const override { return m_rep->GetEntries(); }
+    int allEntries() const override { return rep()->GetEntries(); }
     /// Get the number of entries in the underflow and overflow bins.
     int extraEntries() const override;
     /// Number of entries in the corresponding bin (ie the number of times fill was called for this bin).
@@ -89,15 +89,15 @@ namespace Gaudi {
     // spread
     virtual double binRms( int index ) const;
     /// Get the sum of in range bin heights in the IProfile.
-    double sumBinHeights() const override { return m_rep->GetSumOfWeights(); }
+    double sumBinHeights() const override { return rep()->GetSumOfWeights(); }
     /// Get the sum of all the bins heights (including underflow and overflow bin).
-    double sumAllBinHeights() const override { return m_rep->GetSum(); }
+    double sumAllBinHeights() const override { return rep()->GetSum(); }
     /// Get the sum of the underflow and overflow bin height.
     double sumExtraBinHeights() const override { return sumAllBinHeights() - sumBinHeights(); }
     /// Get the minimum height of the in-range bins.
-    double minBinHeight() const override { return m_rep->GetMinimum(); }
+    double minBinHeight() const override { return rep()->GetMinimum(); }
     /// Get the maximum height of the in-range bins.
-    double maxBinHeight() const override { return m_rep->GetMaximum(); }
+    double maxBinHeight() const override { return rep()->GetMaximum(); }
 
     /// Number of equivalent entries, i.e. <tt>SUM[ weight ] ^ 2 / SUM[ weight^2 ]</tt>
     virtual double equivalentBinEntries() const;
@@ -117,9 +117,9 @@ namespace Gaudi {
     /// The error of a given bin.
     double binError( int index ) const override;
     /// The mean of the whole IHistogram1D.
-    double mean() const override { return m_rep->GetMean(); }
+    double mean() const override { return rep()->GetMean(); }
     /// The RMS of the whole IHistogram1D.
-    double rms() const override { return m_rep->GetRMS(); }
+    double rms() const override { return rep()->GetRMS(); }
     /// Get the bin number corresponding to a given coordinate along the x axis.
     int coordToIndex( double coord ) const override { return axis().coordToIndex( coord ); }
     /// Get the Histogram's dimension.
@@ -132,6 +132,14 @@ namespace Gaudi {
     int write( const char* file_name ) const override;
 
   protected:
+    /// Merge into the representation the fills not yet applied to it (none by default)
+    virtual void flushFills() const {}
+    /// Access to the underlying implementation, up to date with all the fills
+    IMPLEMENTATION* rep() const {
+      flushFills();
+      return m_rep.get();
+    }
+
     /// Axis member
     Axis m_axis;
     /// Object annotations
@@ -146,7 +154,7 @@ namespace Gaudi {
 
   template <class INTERFACE, class IMPLEMENTATION>
   bool Generic1D<INTERFACE, IMPLEMENTATION>::setTitle( const std::string& title ) {
-    m_rep->SetTitle( title.c_str() );
+    rep()->SetTitle( title.c_str() );
     if ( !annotation().addItem( "Title", title ) ) m_annotation.setValue( "Title", title );
     if ( !annotation().addItem( "title", title ) ) annotation().setValue( "title", title );
     return true;
@@ -154,29 +162,29 @@ namespace Gaudi {
 
   template <class INTERFACE, class IMPLEMENTATION>
   bool Generic1D<INTERFACE, IMPLEMENTATION>::setName( const std::string& newName ) {
-    m_rep->SetName( newName.c_str() );
+    rep()->SetName( newName.c_str() );
     m_annotation.setValue( "Name", newName );
     return true;
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic1D<INTERFACE, IMPLEMENTATION>::binRms( int index ) const {
-    return m_rep->GetBinError( rIndex( index ) );
+    return rep()->GetBinError( rIndex( index ) );
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic1D<INTERFACE, IMPLEMENTATION>::binMean( int index ) const {
-    return m_rep->GetBinCenter( rIndex( index ) );
+    return rep()->GetBinCenter( rIndex( index ) );
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic1D<INTERFACE, IMPLEMENTATION>::binHeight( int index ) const {
-    return m_rep->GetBinContent( rIndex( index ) );
+    return rep()->GetBinContent( rIndex( index ) );
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic1D<INTERFACE, IMPLEMENTATION>::binError( int index ) const {
-    return m_rep->GetBinError( rIndex( index ) );
+    return rep()->GetBinError( rIndex( index ) );
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
@@ -186,7 +194,7 @@ namespace Gaudi {
   template <class INTERFACE, class IMPLEMENTATION>
   bool Generic1D<INTERFACE, IMPLEMENTATION>::reset() {
     m_sumEntries = 0;
-    m_rep->Reset();
+    rep()->Reset();
     return true;
   }
 
@@ -194,13 +202,13 @@ namespace Gaudi {
   double Generic1D<INTERFACE, IMPLEMENTATION>::equivalentBinEntries() const {
     if ( sumBinHeights() <= 0 ) return 0;
     Stat_t stats[11]; // cover up to 3D...
-    m_rep->GetStats( stats );
+    rep()->GetStats( stats );
     return stats[0] * stats[0] / stats[1];
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   bool Generic1D<INTERFACE, IMPLEMENTATION>::scale( double scaleFactor ) {
-    m_rep->Scale( scaleFactor );
+    rep()->Scale( scaleFactor );
     return true;
   }
 
@@ -208,7 +216,7 @@ namespace Gaudi {
   bool Generic1D<INTERFACE, IMPLEMENTATION>::add( const INTERFACE& h ) {
     const Generic1D<INTERFACE, IMPLEMENTATION>* p = dynamic_cast<const Generic1D<INTERFACE, IMPLEMENTATION>*>( &h );
     if ( p ) {
-      m_rep->Add( p->m_rep.get() );
+      rep()->Add( p->rep() );
       return true;
     }
     throw std::runtime_error( "Cannot add profile histograms of different implementations." );
@@ -217,7 +225,7 @@ namespace Gaudi {
   template <class INTERFACE, class IMPLEMENTATION>
   std::ostream& Generic1D<INTERFACE, IMPLEMENTATION>::print( std::ostream& s ) const {
     /// bin contents and errors are printed for all bins including under and overflows
-    m_rep->Print( "all" );
+    rep()->Print( "all" );
     return s;
   }
 
@@ -236,7 +244,7 @@ namespace Gaudi {
   template <class INTERFACE, class IMPLEMENTATION>
   int Generic1D<INTERFACE, IMPLEMENTATION>::write( const char* file_name ) const {
     TFile* f      = TFile::Open( file_name, "RECREATE" );
-    Int_t  nbytes = m_rep->Write();
+    Int_t  nbytes = rep()->Write();
     f->Close();
     return nbytes;
   }
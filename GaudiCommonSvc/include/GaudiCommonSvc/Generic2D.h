@@ -54,7 +54,7 @@ namespace Gaudi {
 
   public:
     /// ROOT object implementation
-    TObject* representation() const override { return m_rep.get(); }
+    TObject* representation() const override { return rep(); }
     /// Adopt ROOT histogram representation
     void adoptRepresentation( TObject* rep ) override;
     /// Get the title of the object
@@ -151,6 +151,14 @@ namespace Gaudi {
     int write( const char* file_name ) const override;
 
   protected:
+    /// Merge into the representation the fills not yet applied to it (none by default)
+    virtual void flushFills() const {}
+    /// Access to the underlying implementation, up to date with all the fills
+    IMPLEMENTATION* rep() const {
+      flushFills();
+      return m_rep.get();
+    }
+
     /// X axis member
     Axis m_xAxis;
     /// Y axis member
@@ -167,7 +175,7 @@ namespace Gaudi {
 
   template <class INTERFACE, class IMPLEMENTATION>
   bool Generic2D<INTERFACE, IMPLEMENTATION>::setTitle( const std::string& title ) {
-    m_rep->SetTitle( title.c_str() );
+    rep()->SetTitle( title.c_str() );
     if ( !annotation().addItem( "Title", title ) ) m_annotation.setValue( "Title", title );
     if ( !annotation().addItem( "title", title ) ) annotation().setValue( "title", title );
     return true;
@@ -175,54 +183,54 @@ namespace Gaudi {
 
   template <class INTERFACE, class IMPLEMENTATION>
   bool Generic2D<INTERFACE, IMPLEMENTATION>::setName( const std::string& newName ) {
-    m_rep->SetName( newName.c_str() );
+    rep()->SetName( newName.c_str() );
     m_annotation.setValue( "Name", newName );
     return true;
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   int Generic2D<INTERFACE, IMPLEMENTATION>::entries() const {
-    return m_rep->GetEntries();
+    return rep()->GetEntries();
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   int Generic2D<INTERFACE, IMPLEMENTATION>::allEntries() const {
-    return m_rep->GetEntries();
+    return rep()->GetEntries();
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic2D<INTERFACE, IMPLEMENTATION>::minBinHeight() const {
-    return m_rep->GetMinimum();
+    return rep()->GetMinimum();
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic2D<INTERFACE, IMPLEMENTATION>::maxBinHeight() const {
-    return m_rep->GetMaximum();
+    return rep()->GetMaximum();
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic2D<INTERFACE, IMPLEMENTATION>::sumBinHeights() const {
-    return m_rep->GetSumOfWeights();
+    return rep()->GetSumOfWeights();
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic2D<INTERFACE, IMPLEMENTATION>::sumAllBinHeights() const {
-    return m_rep->GetSum();
+    return rep()->GetSum();
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic2D<INTERFACE, IMPLEMENTATION>::binRms( int indexX, int indexY ) const {
-    return m_rep->GetBinError( rIndexX( indexX ), rIndexY( indexY ) );
+    return rep()->GetBinError( rIndexX( indexX ), rIndexY( indexY ) );
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic2D<INTERFACE, IMPLEMENTATION>::binMeanX( int indexX, int ) const {
-    return m_rep->GetXaxis()->GetBinCenter( rIndexX( indexX ) );
+    return rep()->GetXaxis()->GetBinCenter( rIndexX( indexX ) );
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic2D<INTERFACE, IMPLEMENTATION>::binMeanY( int, int indexY ) const {
-    return m_rep->GetYaxis()->GetBinCenter( rIndexY( indexY ) );
+    return rep()->GetYaxis()->GetBinCenter( rIndexY( indexY ) );
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
@@ -241,7 +249,7 @@ namespace Gaudi {
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic2D<INTERFACE, IMPLEMENTATION>::binHeight( int indexX, int indexY ) const {
-    return m_rep->GetBinContent( rIndexX( indexX ), rIndexY( indexY ) );
+    return rep()->GetBinContent( rIndexX( indexX ), rIndexY( indexY ) );
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
@@ -260,27 +268,27 @@ namespace Gaudi {
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic2D<INTERFACE, IMPLEMENTATION>::binError( int indexX, int indexY ) const {
-    return m_rep->GetBinError( rIndexX( indexX ), rIndexY( indexY ) );
+    return rep()->GetBinError( rIndexX( indexX ), rIndexY( indexY ) );
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic2D<INTERFACE, IMPLEMENTATION>::meanX() const {
-    return m_rep->GetMean( 1 );
+    return rep()->GetMean( 1 );
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic2D<INTERFACE, IMPLEMENTATION>::meanY() const {
-    return m_rep->GetMean( 2 );
+    return rep()->GetMean( 2 );
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic2D<INTERFACE, IMPLEMENTATION>::rmsX() const {
-    return m_rep->GetRMS( 1 );
+    return rep()->GetRMS( 1 );
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic2D<INTERFACE, IMPLEMENTATION>::rmsY() const {
-    return m_rep->GetRMS( 2 );
+    return rep()->GetRMS( 2 );
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
@@ -297,7 +305,7 @@ namespace Gaudi {
   bool Generic2D<INTERFACE, IMPLEMENTATION>::add( const INTERFACE& hist ) {
     const Base* p = dynamic_cast<const Base*>( &hist );
     if ( !p ) throw std::runtime_error( "Cannot add profile histograms of different implementations." );
-    m_rep->Add( p->m_rep.get() );
+    rep()->Add( p->rep() );
     return true;
   }
 
@@ -313,27 +321,27 @@ namespace Gaudi {
   double Generic2D<INTERFACE, IMPLEMENTATION>::equivalentBinEntries() const {
     if ( sumBinHeights() <= 0 ) return 0;
     Stat_t stats[11]; // cover up to 3D...
-    m_rep->GetStats( stats );
+    rep()->GetStats( stats );
     return stats[0] * stats[0] / stats[1];
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   bool Generic2D<INTERFACE, IMPLEMENTATION>::scale( double scaleFactor ) {
-    m_rep->Scale( scaleFactor );
+    rep()->Scale( scaleFactor );
     return true;
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   bool Generic2D<INTERFACE, IMPLEMENTATION>::reset() {
     m_sumEntries = 0;
-    m_rep->Reset();
+    rep()->Reset();
     return true;
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   std::ostream& Generic2D<INTERFACE, IMPLEMENTATION>::print( std::ostream& s ) const {
     /// bin contents and errors are printed for all bins including under and overflows
-    m_rep->Print( "all" );
+    rep()->Print( "all" );
     return s;
   }
 
@@ -356,7 +364,7 @@ namespace Gaudi {
   template <class INTERFACE, class IMPLEMENTATION>
   int Generic2D<INTERFACE, IMPLEMENTATION>::write( const char* file_name ) const {
     TFile* f      = TFile::Open( file_name, "RECREATE" );
-    Int_t  nbytes = m_rep->Write();
+    Int_t  nbytes = rep()->Write();
     f->Close();
     return nbytes;
   }
@@ -54,7 +54,7 @@ namespace Gaudi {
 
   public:
     /// ROOT object implementation
-    TObject* representation() const override { return m_rep.get(); }
+    TObject* representation() const override { return rep(); }
     /// Adopt ROOT histogram representation
     void adoptRepresentation( TObject* rep ) override;
 
@@ -94,15 +94,15 @@ namespace Gaudi {
 
     /// The weighted mean along the x axis of a given bin.
     double binMeanX( int indexX, int, int ) const override {
-      return m_rep->GetXaxis()->GetBinCenter( rIndexX( indexX ) );
+      return rep()->GetXaxis()->GetBinCenter( rIndexX( indexX ) );
     }
     /// The weighted mean along the y axis of a given bin.
     double binMeanY( int, int indexY, int ) const override {
-      return m_rep->GetYaxis()->GetBinCenter( rIndexY( indexY ) );
+      return rep()->GetYaxis()->GetBinCenter( rIndexY( indexY ) );
     }
     /// The weighted mean along the z axis of a given bin.
     double binMeanZ( int, int, int indexZ ) const override {
-      return m_rep->GetYaxis()->GetBinCenter( rIndexY( indexZ ) );
+      return rep()->GetYaxis()->GetBinCenter( rIndexY( indexZ ) );
     }
     /// Number of entries in the corresponding bin (ie the number of times fill was calle d for this bin).
     int binEntries( int indexX, int indexY, int indexZ ) const override {
@@ -135,7 +135,7 @@ namespace Gaudi {
 
     /// Total height of the corresponding bin (ie the sum of the weights in this bin).
     double binHeight( int indexX, int indexY, int indexZ ) const {
-      return m_rep->GetBinContent( rIndexX( indexX ), rIndexY( indexY ), rIndexZ( indexZ ) );
+      return rep()->GetBinContent( rIndexX( indexX ), rIndexY( indexY ), rIndexZ( indexZ ) );
     }
 
     /// Sum of all the heights of the bins along a given x bin.
@@ -161,21 +161,21 @@ namespace Gaudi {
     }
     /// The error of a given bin.
     double binError( int indexX, int indexY, int indexZ ) const override {
-      return m_rep->GetBinError( rIndexX( indexX ), rIndexY( indexY ), rIndexZ( indexZ ) );
+      return rep()->GetBinError( rIndexX( indexX ), rIndexY( indexY ), rIndexZ( indexZ ) );
     }
     /// The mean of the IHistogram3D along the x axis.
-    double meanX() const override { return m_rep->GetMean( 1 ); }
+    double meanX() const override { return rep()->GetMean( 1 ); }
 
     /// The mean of the IHistogram3D along the y axis.
-    double meanY() const override { return m_rep->GetMean( 2 ); }
+    double meanY() const override { return rep()->GetMean( 2 ); }
     /// The mean of the IHistogram3D along the z axis.
-    double meanZ() const override { return m_rep->GetMean( 3 ); }
+    double meanZ() const override { return rep()->GetMean( 3 ); }
     /// The RMS of the IHistogram3D along the x axis.
-    double rmsX() const override { return m_rep->GetRMS( 1 ); }
+    double rmsX() const override { return rep()->GetRMS( 1 ); }
     /// The RMS of the IHistogram3D along the y axis.
-    double rmsY() const override { return m_rep->GetRMS( 2 ); }
+    double rmsY() const override { return rep()->GetRMS( 2 ); }
     /// The RMS of the IHistogram3D along the z axis.
-    double rmsZ() const override { return m_rep->GetRMS( 3 ); }
+    double rmsZ() const override { return rep()->GetRMS( 3 ); }
     /// Get the x axis of the IHistogram3D.
     const AIDA::IAxis& xAxis() const override { return m_xAxis; }
     /// Get the y axis of the IHistogram3D.
@@ -198,7 +198,7 @@ namespace Gaudi {
     bool add( const INTERFACE& hist ) override {
       const Base* p = dynamic_cast<const Base*>( &hist );
       if ( !p ) throw std::runtime_error( "Cannot add profile histograms of different implementations." );
-      m_rep->Add( p->m_rep.get() );
+      rep()->Add( p->rep() );
       return true;
     }
 
@@ -220,6 +220,14 @@ namespace Gaudi {
     int write( const char* file_name ) const override;
 
   protected:
+    /// Merge into the representation the fills not yet applied to it (none by default)
+    virtual void flushFills() const {}
+    /// Access to the underlying implementation, up to date with all the fills
+    IMPLEMENTATION* rep() const {
+      flushFills();
+      return m_rep.get();
+    }
+
     Gaudi::Axis m_xAxis;
     Gaudi::Axis m_yAxis;
     Gaudi::Axis m_zAxis;
@@ -235,7 +243,7 @@ namespace Gaudi {
 
   template <class INTERFACE, class IMPLEMENTATION>
   bool Generic3D<INTERFACE, IMPLEMENTATION>::setTitle( const std::string& title ) {
-    m_rep->SetTitle( title.c_str() );
+    rep()->SetTitle( title.c_str() );
     if ( !annotation().addItem( "Title", title ) ) m_annotation.setValue( "Title", title );
     if ( !annotation().addItem( "title", title ) ) annotation().setValue( "title", title );
     return true;
@@ -243,58 +251,58 @@ namespace Gaudi {
 
   template <class INTERFACE, class IMPLEMENTATION>
   bool Generic3D<INTERFACE, IMPLEMENTATION>::setName( const std::string& newName ) {
-    m_rep->SetName( newName.c_str() );
+    rep()->SetName( newName.c_str() );
     m_annotation.setValue( "Name", newName );
     return true;
   }
   template <class INTERFACE, class IMPLEMENTATION>
   int Generic3D<INTERFACE, IMPLEMENTATION>::entries() const {
-    return m_rep->GetEntries();
+    return rep()->GetEntries();
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   int Generic3D<INTERFACE, IMPLEMENTATION>::allEntries() const {
-    return int( m_rep->GetEntries() );
+    return int( rep()->GetEntries() );
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic3D<INTERFACE, IMPLEMENTATION>::minBinHeight() const {
-    return m_rep->GetMinimum();
+    return rep()->GetMinimum();
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic3D<INTERFACE, IMPLEMENTATION>::maxBinHeight() const {
-    return m_rep->GetMaximum();
+    return rep()->GetMaximum();
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic3D<INTERFACE, IMPLEMENTATION>::sumBinHeights() const {
-    return m_rep->GetSumOfWeights();
+    return rep()->GetSumOfWeights();
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic3D<INTERFACE, IMPLEMENTATION>::sumAllBinHeights() const {
-    return m_rep->GetSum();
+    return rep()->GetSum();
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   double Generic3D<INTERFACE, IMPLEMENTATION>::equivalentBinEntries() const {
     if ( sumBinHeights() <= 0 ) return 0;
     Stat_t stats[11]; // cover up to 3D...
-    m_rep->GetStats( stats );
+    rep()->GetStats( stats );
     return stats[0] * stats[0] / stats[1];
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   bool Generic3D<INTERFACE, IMPLEMENTATION>::scale( double scaleFactor ) {
-    m_rep->Scale( scaleFactor );
+    rep()->Scale( scaleFactor );
     return true;
   }
 
   template <class INTERFACE, class IMPLEMENTATION>
   std::ostream& Generic3D<INTERFACE, IMPLEMENTATION>::print( std::ostream& s ) const {
     /// bin contents and errors are printed for all bins including under and overflows
-    m_rep->Print( "all" );
+    rep()->Print( "all" );
     return s;
   }
 
@@ -316,7 +324,7 @@ namespace Gaudi {
   template <class INTERFACE, class IMPLEMENTATION>
   int Generic3D<INTERFACE, IMPLEMENTATION>::write( const char* file_name ) const {
     TFile* f      = TFile::Open( file_name, "RECREATE" );
-    Int_t  nbytes = m_rep->Write();
+    Int_t  nbytes = rep()->Write();
     f->Close();
     return nbytes;
   }
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "Generic1D.h"
+#include "ShadowBins.h"
 #include <AIDA/IHistogram1D.h>
 #include <Gaudi/Histograming/Sink/Utils.h>
 #include <GaudiKernel/DataObject.h>
@@ -18,6 +19,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include <memory>
 #include <mutex>
 
 namespace Gaudi {
@@ -52,11 +54,16 @@ namespace Gaudi {
     // free function reset
     friend void reset( Histogram1D& h ) { h.reset(); }
     /// conversion to json via nlohmann library
-    friend void to_json( nlohmann::json& j, Gaudi::Histogram1D const& h ) { j = *h.m_rep.get(); }
+    friend void to_json( nlohmann::json& j, Gaudi::Histogram1D const& h ) { j = *h.rep(); }
     /// set histogram statistics
     virtual bool setStatistics( int allEntries, double eqBinEntries, double mean, double rms );
     /// Fill the Profile1D with a value and the corresponding weight.
     bool fill( double x, double weight ) override;
+    /** Enable (or disable) the filling from several threads without locking.
+     *  The fills are accumulated in per-thread buffers and merged into the ROOT representation whenever it is
+     *  accessed. Must not be called while the histogram is being filled.
+     */
+    void setConcurrentFill( bool enable );
     /// Update histogram RMS
     bool setRms( double rms );
     /// Create new histogram from any AIDA based histogram
@@ -77,7 +84,12 @@ namespace Gaudi {
     StreamBuffer& serialize( StreamBuffer& s ) const;
 
   private:
-    std::mutex m_fillSerialization;
+    /// Merge the fills pending in the per-thread buffers
+    void flushFills() const override;
+
+    mutable std::mutex m_fillSerialization;
+    /// Per-thread buffers for the concurrent filling (see setConcurrentFill)
+    mutable ShadowBins<1> m_shadow;
 
   }; // end class Histogram1D
 } // end namespace Gaudi
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "Generic2D.h"
+#include "ShadowBins.h"
 #include <AIDA/IHistogram2D.h>
 #include <Gaudi/Histograming/Sink/Utils.h>
 #include <GaudiKernel/DataObject.h>
@@ -18,6 +19,9 @@
 
 #include <nlohmann/json.hpp>
 
+#include <memory>
+#include <mutex>
+
 namespace Gaudi {
   class Histogram1D;
 
@@ -34,8 +38,16 @@ namespace Gaudi {
     /// Standard initializing Constructor with TH2D representation to be adopted
     Histogram2D( TH2D* rep );
 
+    /// Adopt ROOT histogram representation
+    void adoptRepresentation( TObject* rep ) override;
+
     /// Fill the Histogram2D with a value and the
     bool fill( double x, double y, double weight = 1. ) override;
+    /** Enable (or disable) the filling from several threads without locking.
+     *  The fills are accumulated in per-thread buffers and merged into the ROOT representation whenever it is
+     *  accessed. Must not be called while the histogram is being filled.
+     */
+    void setConcurrentFill( bool enable );
     /// Fast filling method for a given bin. It can be also the over/underflow bin
     virtual bool setBinContents( int binIndexX, int binIndexY, int entries, double height, double error, double centreX,
                                  double centreY );
@@ -46,7 +58,7 @@ namespace Gaudi {
     // free function reset
     friend void reset( Histogram2D& h ) { h.reset(); }
     /// conversion to json via nlohmann library
-    friend void to_json( nlohmann::json& j, Histogram2D const& h ) { j = *h.m_rep.get(); }
+    friend void to_json( nlohmann::json& j, Histogram2D const& h ) { j = *h.rep(); }
     /// Create new histogram from any AIDA based histogram
     void copyFromAida( const AIDA::IHistogram2D& h );
     /// Retrieve reference to class defininition identifier
@@ -59,6 +71,11 @@ namespace Gaudi {
     double m_sumwy = 0;
 
   private:
-    std::mutex m_fillSerialization;
+    /// Merge the fills pending in the per-thread buffers
+    void flushFills() const override;
+
+    mutable std::mutex m_fillSerialization;
+    /// Per-thread buffers for the concurrent filling (see setConcurrentFill)
+    mutable ShadowBins<2> m_shadow;
   };
 } // namespace Gaudi
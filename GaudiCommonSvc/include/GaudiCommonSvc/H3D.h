@@ -11,6 +11,7 @@
 #pragma once
 
 #include "Generic3D.h"
+#include "ShadowBins.h"
 #include <AIDA/IHistogram3D.h>
 #include <Gaudi/Histograming/Sink/Utils.h>
 #include <GaudiKernel/DataObject.h>
@@ -18,6 +19,9 @@
 
 #include <nlohmann/json.hpp>
 
+#include <memory>
+#include <mutex>
+
 namespace Gaudi {
 
   /**@class Histogram3D
@@ -33,8 +37,16 @@ namespace Gaudi {
     /// Standard Constructor
     Histogram3D( TH3D* rep );
 
+    /// Adopt ROOT histogram representation
+    void adoptRepresentation( TObject* rep ) override;
+
     /// Fill bin content
     bool fill( double x, double y, double z, double weight ) override;
+    /** Enable (or disable) the filling from several threads without locking.
+     *  The fills are accumulated in per-thread buffers and merged into the ROOT representation whenever it is
+     *  accessed. Must not be called while the histogram is being filled.
+     */
+    void setConcurrentFill( bool enable );
     /// Fast filling method for a given bin. It can be also the over/underflow bin
     virtual bool setBinContents( int i, int j, int k, int entries, double height, double error, double centreX,
                                  double centreY, double centreZ );
@@ -45,7 +57,7 @@ namespace Gaudi {
     // free function reset
     friend void reset( Histogram3D& h ) { h.reset(); }
     /// conversion to json via nlohmann library
-    friend void to_json( nlohmann::json& j, Histogram3D const& h ) { j = *h.m_rep.get(); }
+    friend void to_json( nlohmann::json& j, Histogram3D const& h ) { j = *h.rep(); }
     /// Introspection method
     void* cast( const std::string& className ) const override;
     /// Create new histogram from any AIDA based histogram
@@ -61,6 +73,11 @@ namespace Gaudi {
     double m_sumwz = 0;
 
   private:
-    std::mutex m_fillSerialization;
+    /// Merge the fills pending in the per-thread buffers
+    void flushFills() const override;
+
+    mutable std::mutex m_fillSerialization;
+    /// Per-thread buffers for the concurrent filling (see setConcurrentFill)
+    mutable ShadowBins<3> m_shadow;
   };
 } // namespace Gaudi
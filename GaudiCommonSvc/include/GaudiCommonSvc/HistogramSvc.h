@@ -165,10 +165,16 @@ public:
    */
   StatusCode connectInput( const std::string& ident );
 
+  /// Enable the lock-free filling of a newly booked histogram, if requested
+  void i_enableConcurrentFill( DataObject* obj ) const;
+
   template <class T>
   inline T* i_book( DataObject* pPar, const std::string& rel, const std::string& title,
                     const std::pair<DataObject*, T*>& o ) {
-    if ( o.first && registerObject( pPar, rel, (Base*)o.second ).isSuccess() ) return o.second;
+    if ( o.first && registerObject( pPar, rel, (Base*)o.second ).isSuccess() ) {
+      i_enableConcurrentFill( o.first );
+      return o.second;
+    }
     delete o.first;
     throw GaudiException( "Cannot book " + System::typeinfoName( typeid( T ) ) + " " + title, "HistogramSvc",
                           StatusCode::FAILURE );
@@ -1080,6 +1086,10 @@ private:
   Gaudi::Property<DBaseEntries> m_input{ this, "Input", {}, "input streams" };
   Gaudi::Property<Histo1DMap>   m_defs1D{
       this, "Predefined1DHistos", {}, &HistogramSvc::update1Ddefs, "histograms with predefined parameters" };
+  Gaudi::Property<bool> m_concurrentFill{
+      this, "ConcurrentFill", false,
+      "fill the 1D, 2D and 3D histograms from several threads without locking, using per-thread buffers merged "
+      "when the histograms are read" };
 
   // modified histograms:
   std::set<std::string> m_mods1D;
@@ -0,0 +1,273 @@
+/***********************************************************************************\
+* (c) Copyright 1998-2026 CERN for the benefit of the LHCb and ATLAS collaborations *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <TH1.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+
+namespace Gaudi {
+
+  namespace details {
+    /** Dense index of the current thread, shared by all the histograms.
+     *  The index of a thread is given back when the thread exits and reused by the next new thread, so that the
+     *  indices stay small in applications that start and stop threads.
+     */
+    class ShadowThreadIndex {
+    public:
+      static std::size_t get() {
+        thread_local const Holder s_holder;
+        return s_holder.index;
+      }
+
+    private:
+      struct Registry {
+        std::mutex            lock;
+        std::set<std::size_t> free;
+        std::size_t           next = 0;
+      };
+      static Registry& registry() {
+        static Registry s_registry;
+        return s_registry;
+      }
+      struct Holder {
+        Holder() : registry{ ShadowThreadIndex::registry() } {
+          auto guard = std::scoped_lock{ registry.lock };
+          if ( registry.free.empty() ) {
+            index = registry.next++;
+          } else {
+            index = *registry.free.begin();
+            registry.free.erase( registry.free.begin() );
+          }
+        }
+        ~Holder() {
+          auto guard = std::scoped_lock{ registry.lock };
+          registry.free.insert( index );
+        }
+        Registry&   registry;
+        std::size_t index = 0;
+      };
+    };
+  } // namespace details
+
+  /** @class ShadowBins ShadowBins.h GaudiCommonSvc/ShadowBins.h
+   *
+   *  Per-thread copies of the bins and of the statistics of a ROOT histogram, used to fill the histogram from
+   *  several threads without locking.
+   *
+   *  Each thread accumulates its fills in its own buffer (atomic only to allow the merging from another thread)
+   *  and the pending fills are merged into the ROOT histogram by flush(). flush(), reset() and reshape() must be
+   *  protected by the caller against each other and against the other accesses to the histogram, but they can
+   *  run while other threads call fill(): a buffer is only deleted once its thread is no longer using it.
+   *
+   *  The memory is bounded: at most maxThreads buffers and maxBytes per histogram. Threads without a buffer
+   *  get false from fill() and must fill the histogram directly.
+   *
+   *  The statistics follow the layout of TH1::GetStats (sum of w, w^2, w*x, w*x^2, then w*y, w*y^2, w*x*y for
+   *  2D, then w*z, w*z^2, w*x*z, w*y*z for 3D) and, as in TH1::Fill, they include only the fills in range.
+   */
+  template <unsigned int NDIM>
+  class ShadowBins {
+  public:
+    /// Number of statistics entries (see TH1::GetStats)
+    static constexpr std::size_t nStats = NDIM == 1 ? 4 : NDIM == 2 ? 7 : 11;
+    /// Maximum number of threads with a buffer
+    static constexpr std::size_t maxThreads = 64;
+    /// Maximum size of the buffers of one histogram
+    static constexpr std::size_t maxBytes = 4 * 1024 * 1024;
+
+    /// Constructor of a disabled instance (fill() always returns false)
+    ShadowBins() = default;
+    /// Constructor for a histogram with the given number of cells (including underflow and overflow bins)
+    explicit ShadowBins( std::size_t nCells ) { reset( nCells ); }
+    ~ShadowBins() {
+      for ( auto& slot : m_buffers ) delete slot.buffer.load();
+    }
+    ShadowBins( const ShadowBins& )            = delete;
+    ShadowBins& operator=( const ShadowBins& ) = delete;
+
+    /// Tell if the fills can be recorded
+    bool enabled() const { return m_nCells.load( std::memory_order_relaxed ) != 0; }
+
+    /** Record a fill of the given global bin for the coordinates x.
+     *  @return false if the current thread has no buffer, in which case the fill was not recorded
+     */
+    bool fill( int bin, double w, const std::array<double, NDIM>& x, bool inRange ) {
+      const Pin pin = acquire();
+      Buffer*   b   = pin.buffer;
+      if ( !b || bin < 0 || static_cast<std::size_t>( bin ) >= b->nCells ) return false;
+      constexpr auto order = std::memory_order_relaxed;
+      b->sumw[bin].fetch_add( w, order );
+      b->sumw2[bin].fetch_add( w * w, order );
+      b->entries.fetch_add( 1, order );
+      if ( inRange ) {
+        b->stats[0].fetch_add( w, order );
+        b->stats[1].fetch_add( w * w, order );
+        b->stats[2].fetch_add( w * x[0], order );
+        b->stats[3].fetch_add( w * x[0] * x[0], order );
+        if constexpr ( NDIM > 1 ) {
+          b->stats[4].fetch_add( w * x[1], order );
+          b->stats[5].fetch_add( w * x[1] * x[1], order );
+          b->stats[6].fetch_add( w * x[0] * x[1], order );
+        }
+        if constexpr ( NDIM > 2 ) {
+          b->stats[7].fetch_add( w * x[2], order );
+          b->stats[8].fetch_add( w * x[2] * x[2], order );
+          b->stats[9].fetch_add( w * x[0] * x[2], order );
+          b->stats[10].fetch_add( w * x[1] * x[2], order );
+        }
+      }
+      b->dirty.store( true, std::memory_order_release );
+      return true;
+    }
+
+    /// Merge the pending fills into the histogram
+    void flush( TH1& h ) {
+      const std::size_t nCells = m_nCells.load();
+      for ( auto& slot : m_buffers ) {
+        Buffer* b = slot.buffer.load( std::memory_order_acquire );
+        if ( !b ) continue;
+        // a buffer created while the histogram was being reshaped
+        if ( b->nCells != nCells ) {
+          retire( slot );
+          continue;
+        }
+        if ( !b->dirty.exchange( false, std::memory_order_acq_rel ) ) continue;
+        // take the statistics before touching the bins, as ROOT recomputes them from the bins if they are empty
+        std::array<double, 11> stats{};
+        h.GetStats( stats.data() );
+        for ( std::size_t i = 0; i < nStats; ++i ) stats[i] += b->stats[i].exchange( 0 );
+        const double entries = h.GetEntries() + b->entries.exchange( 0 );
+        TArrayD*     sumw2   = h.GetSumw2();
+        for ( std::size_t bin = 0; bin < nCells; ++bin ) {
+          if ( const double w = b->sumw[bin].exchange( 0 ); w != 0 ) h.AddBinContent( bin, w );
+          if ( const double w2 = b->sumw2[bin].exchange( 0 ); w2 != 0 && sumw2 && sumw2->GetSize() ) {
+            sumw2->fArray[bin] += w2;
+          }
+        }
+        h.PutStats( stats.data() );
+        h.SetEntries( entries );
+      }
+    }
+
+    /// Drop the pending fills, keeping the buffers
+    void clear() {
+      for ( auto& slot : m_buffers ) {
+        if ( Buffer* b = slot.buffer.load( std::memory_order_acquire ) ) {
+          b->dirty.store( false );
+          b->entries.store( 0 );
+          for ( auto& s : b->stats ) s.store( 0 );
+          for ( std::size_t bin = 0; bin < b->nCells; ++bin ) {
+            b->sumw[bin].store( 0 );
+            b->sumw2[bin].store( 0 );
+          }
+        }
+      }
+    }
+
+    /** Drop the pending fills and prepare for a histogram with the given number of cells (0 to disable).
+     *  The buffers are cleared in place if the number of cells does not change.
+     */
+    void reset( std::size_t nCells ) {
+      if ( nCells == m_nCells.load() ) {
+        clear();
+        return;
+      }
+      m_maxBuffers.store( nCells ? std::clamp<std::size_t>( maxBytes / ( nCells * 2 * sizeof( double ) ), 1,
+                                                             maxThreads )
+                                 : 0 );
+      m_nCells.store( nCells );
+      for ( auto& slot : m_buffers ) retire( slot );
+    }
+
+    /// Same as reset(nCells) if enabled, otherwise do nothing
+    void reshape( std::size_t nCells ) {
+      if ( enabled() ) reset( nCells );
+    }
+
+  private:
+    struct Buffer {
+      explicit Buffer( std::size_t n )
+          : nCells{ n }
+          , sumw{ std::make_unique<std::atomic<double>[]>( n ) }
+          , sumw2{ std::make_unique<std::atomic<double>[]>( n ) } {}
+      const std::size_t                       nCells;
+      std::atomic<bool>                       dirty{ false };
+      std::atomic<double>                     entries{ 0 };
+      std::array<std::atomic<double>, nStats> stats{};
+      std::unique_ptr<std::atomic<double>[]>  sumw;
+      std::unique_ptr<std::atomic<double>[]>  sumw2;
+    };
+
+    struct Slot {
+      std::atomic<Buffer*> buffer{ nullptr };
+      /// set by the owning thread while filling, so that the buffer is not deleted under its feet
+      std::atomic<bool> inUse{ false };
+    };
+
+    /// Release the slot taken by acquire()
+    struct Pin {
+      Pin() = default;
+      explicit Pin( Slot* s ) : slot{ s } {}
+      Pin( Pin&& other ) noexcept : slot{ std::exchange( other.slot, nullptr ) }, buffer{ other.buffer } {}
+      Pin( const Pin& )            = delete;
+      Pin& operator=( const Pin& ) = delete;
+      Pin& operator=( Pin&& )      = delete;
+      ~Pin() {
+        if ( slot ) slot->inUse.store( false, std::memory_order_release );
+      }
+      Slot*   slot   = nullptr;
+      Buffer* buffer = nullptr;
+    };
+
+    /// Buffer of the current thread (created on first use) with its slot marked in use, nullptr if not available
+    Pin acquire() {
+      const std::size_t idx = details::ShadowThreadIndex::get();
+      if ( idx >= m_maxBuffers.load( std::memory_order_relaxed ) ) return {};
+      Pin pin{ &m_buffers[idx] };
+      // sequentially consistent with retire(): either retire() sees the slot in use, or we see it emptied
+      pin.slot->inUse.store( true );
+      Buffer* b = pin.slot->buffer.load();
+      if ( !b ) {
+        const std::size_t nCells = m_nCells.load();
+        if ( !nCells ) return pin;
+        auto    created  = std::make_unique<Buffer>( nCells );
+        Buffer* expected = nullptr;
+        // only this thread fills the slot, but reset() may empty it at any time
+        if ( !pin.slot->buffer.compare_exchange_strong( expected, created.get() ) ) return pin;
+        b = created.release();
+      }
+      // a buffer left over from before a reshape is deleted by the next flush
+      if ( b->nCells == m_nCells.load() ) pin.buffer = b;
+      return pin;
+    }
+
+    /// Empty the slot and delete its buffer once its thread has stopped using it
+    static void retire( Slot& slot ) {
+      Buffer* b = slot.buffer.exchange( nullptr );
+      if ( !b ) return;
+      while ( slot.inUse.load() ) std::this_thread::yield();
+      delete b;
+    }
+
+    std::atomic<std::size_t>     m_nCells{ 0 };
+    std::atomic<std::size_t>     m_maxBuffers{ 0 };
+    std::array<Slot, maxThreads> m_buffers{};
+  };
+} // namespace Gaudi
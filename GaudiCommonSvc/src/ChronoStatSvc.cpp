@@ -12,11 +12,13 @@
 // STD & STL
 // ============================================================================
 #include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <functional>
 #include <iomanip>
 #include <iostream>
 #include <string>
+#include <string_view>
 // ============================================================================
 // GaudiKernel
 // ============================================================================
@@ -25,10 +27,12 @@
 #include <GaudiKernel/IHiveWhiteBoard.h>
 #include <GaudiKernel/IIncidentSvc.h>
 #include <GaudiKernel/Kernel.h>
+#include <GaudiKernel/Memory.h>
 #include <GaudiKernel/MsgStream.h>
 #include <GaudiKernel/Stat.h>
 #include <GaudiKernel/StatEntity.h>
 #include <GaudiKernel/StatusCode.h>
+#include <GaudiKernel/Timing.h>
 // ============================================================================
 /// local
 // ============================================================================
@@ -93,19 +97,30 @@ StatusCode ChronoStatSvc::initialize() {
   if ( sc.isFailure() ) return sc;
 
   // only add an EndEvent listener if per-event output requested
-  if ( !m_perEventFile.empty() ) {
-    m_ofd.open( m_perEventFile );
-    if ( !m_ofd.is_open() ) {
-      error() << "unable to open per-event output file \"" << m_perEventFile << "\"" << endmsg;
+  if ( !m_perEventFile.empty() || !m_perEventRecordFile.empty() ) {
+    auto ii = serviceLocator()->service<IIncidentSvc>( "IncidentSvc" );
+    if ( !ii ) {
+      error() << "Unable to find IncidentSvc" << endmsg;
       return StatusCode::FAILURE;
-    } else {
-      auto ii = serviceLocator()->service<IIncidentSvc>( "IncidentSvc" );
-      if ( !ii ) {
-        error() << "Unable to find IncidentSvc" << endmsg;
+    }
+    if ( !m_perEventFile.empty() ) {
+      m_ofd.open( m_perEventFile );
+      if ( !m_ofd.is_open() ) {
+        error() << "unable to open per-event output file \"" << m_perEventFile << "\"" << endmsg;
+        return StatusCode::FAILURE;
+      }
+    }
+    if ( !m_perEventRecordFile.empty() ) {
+      m_recordFile.open( m_perEventRecordFile, std::ios::binary );
+      if ( !m_recordFile.is_open() ) {
+        error() << "unable to open per-event record file \"" << m_perEventRecordFile << "\"" << endmsg;
         return StatusCode::FAILURE;
       }
-      ii->addListener( this, IncidentType::EndEvent );
+      ii->addListener( this, IncidentType::BeginEvent );
+      serviceLocator()->monitoringHub().registerEntity( name(), "EventRecord", "chrono:EventRecord",
+                                                        m_recordSummary );
     }
+    ii->addListener( this, IncidentType::EndEvent );
   }
 
   if ( m_chronoTableFlag && !m_printUserTime && !m_printSystemTime && !m_printEllapsedTime ) { m_printUserTime = true; }
@@ -139,6 +154,16 @@ StatusCode ChronoStatSvc::finalize() {
     m_ofd.close();
   }
 
+  if ( m_recordFile.is_open() ) {
+    // make sure the schema is there even without events
+    if ( !m_recordHeaderDone ) fillRecordHeader();
+    flushEventRecords();
+    m_recordFile.close();
+    serviceLocator()->monitoringHub().removeEntity( m_recordSummary );
+    debug() << "written " << m_recordSummary.nEvents << " per-event records to '" << m_perEventRecordFile << "'"
+            << endmsg;
+  }
+
   ///
   /// Is the final chrono table to be printed?
   if ( m_chronoTableFlag && !m_chronoEntities.empty() && ( m_printUserTime || m_printSystemTime ) ) {
@@ -506,7 +531,13 @@ void ChronoStatSvc::printStats() {
 
 // ============================================================================
 
-void ChronoStatSvc::handle( const Incident& /* inc */ ) {
+void ChronoStatSvc::handle( const Incident& inc ) {
+
+  if ( inc.type() == IncidentType::BeginEvent ) {
+    startEventRecord( inc.context() );
+    return;
+  }
+  if ( m_recordFile.is_open() ) fillEventRecord( inc.context() );
 
   if ( !m_ofd.is_open() ) return;
 
@@ -523,6 +554,107 @@ void ChronoStatSvc::handle( const Incident& /* inc */ ) {
   }
 }
 
+// ============================================================================
+// per-event record
+// ============================================================================
+namespace {
+  constexpr std::uint32_t s_recordVersion = 1;
+
+  template <typename T>
+  void appendBinary( std::string& buffer, const T& value ) {
+    buffer.append( reinterpret_cast<const char*>( &value ), sizeof( T ) );
+  }
+  void appendColumn( std::string& buffer, char type, std::string_view name ) {
+    buffer.push_back( type );
+    appendBinary( buffer, static_cast<std::uint32_t>( name.size() ) );
+    buffer.append( name );
+  }
+  bool isExecuteTag( const IChronoStatSvc::ChronoTag& tag ) { return tag.find( ":Execute" ) != std::string::npos; }
+} // namespace
+
+void ChronoStatSvc::startEventRecord( const EventContext& ctx ) {
+  const auto slot = ctx.valid() ? ctx.slot() : 0;
+  EventStart start{ std::chrono::steady_clock::now(), System::cpuTime( System::microSec ),
+                    System::mappedMemory( System::kByte ) };
+
+  auto lock = std::scoped_lock{ m_mutex };
+  if ( m_eventStarts.size() <= slot ) m_eventStarts.resize( slot + 1 );
+  m_eventStarts[slot] = start;
+}
+
+void ChronoStatSvc::fillRecordHeader() {
+  for ( const auto& [tag, entity] : m_chronoEntities ) {
+    if ( isExecuteTag( tag ) ) m_recordColumns.push_back( &entity );
+  }
+  m_recordTotals.assign( m_recordColumns.size() + 1, 0. );
+
+  const auto nColumns = static_cast<std::uint32_t>( m_recordColumns.size() + 6 );
+  m_recordBuffer.append( "GCSR" );
+  appendBinary( m_recordBuffer, s_recordVersion );
+  appendBinary( m_recordBuffer, nColumns );
+  appendBinary( m_recordBuffer, static_cast<std::uint32_t>( nColumns * 8 ) );
+  appendColumn( m_recordBuffer, 'u', "event" );
+  appendColumn( m_recordBuffer, 'u', "slot" );
+  appendColumn( m_recordBuffer, 'd', "wall[us]" );
+  appendColumn( m_recordBuffer, 'd', "cpu[us]" );
+  appendColumn( m_recordBuffer, 'i', "rss_delta[kB]" );
+  for ( const auto& [tag, entity] : m_chronoEntities ) {
+    if ( isExecuteTag( tag ) ) appendColumn( m_recordBuffer, 'd', tag.substr( 0, tag.length() - 8 ) + "[us]" );
+  }
+  appendColumn( m_recordBuffer, 'd', "others[us]" );
+  m_recordHeaderDone = true;
+}
+
+void ChronoStatSvc::fillEventRecord( const EventContext& ctx ) {
+  const auto slot = ctx.valid() ? ctx.slot() : 0;
+  const auto wall = std::chrono::steady_clock::now();
+  const auto cpu  = System::cpuTime( System::microSec );
+  const auto rss  = System::mappedMemory( System::kByte );
+
+  auto lock = std::scoped_lock{ m_mutex };
+
+  double executeTotal = 0;
+  for ( const auto& [tag, entity] : m_chronoEntities ) {
+    if ( isExecuteTag( tag ) ) executeTotal += entity.eTotalTime();
+  }
+
+  if ( !m_recordHeaderDone ) fillRecordHeader();
+
+  const EventStart start = ( slot < m_eventStarts.size() ) ? m_eventStarts[slot] : EventStart{ wall, cpu, rss };
+  const double     eventWall = std::chrono::duration<double, std::micro>( wall - start.wall ).count();
+  const double     eventCpu  = static_cast<double>( cpu - start.cpu );
+  const long long  eventRss  = rss - start.rss;
+
+  appendBinary( m_recordBuffer, static_cast<std::uint64_t>( ctx.evt() ) );
+  appendBinary( m_recordBuffer, static_cast<std::uint64_t>( slot ) );
+  appendBinary( m_recordBuffer, eventWall );
+  appendBinary( m_recordBuffer, eventCpu );
+  appendBinary( m_recordBuffer, static_cast<std::int64_t>( eventRss ) );
+  double columnsTotal = 0;
+  for ( std::size_t i = 0; i < m_recordColumns.size(); ++i ) {
+    const double total = m_recordColumns[i]->eTotalTime();
+    appendBinary( m_recordBuffer, total - m_recordTotals[i] );
+    m_recordTotals[i] = total;
+    columnsTotal += total;
+  }
+  appendBinary( m_recordBuffer, ( executeTotal - columnsTotal ) - m_recordTotals.back() );
+  m_recordTotals.back() = executeTotal - columnsTotal;
+
+  m_recordSummary.add( ctx.evt(), eventWall, eventCpu, eventRss );
+
+  if ( ++m_nBufferedRecords >= m_perEventRecordBuffer ) flushEventRecords();
+}
+
+void ChronoStatSvc::flushEventRecords() {
+  m_recordFile.write( m_recordBuffer.data(), m_recordBuffer.size() );
+  m_recordFile.flush();
+  if ( !m_recordFile ) {
+    warning() << "failed to write the per-event records to '" << m_perEventRecordFile << "'" << endmsg;
+  }
+  m_recordBuffer.clear();
+  m_nBufferedRecords = 0;
+}
+
 // ============================================================================
 // The END
 // ============================================================================
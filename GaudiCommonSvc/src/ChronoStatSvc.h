@@ -15,14 +15,17 @@
 // STD & STL
 // ============================================================================
 #include <atomic>
+#include <chrono>
 #include <fstream>
 #include <functional>
 #include <map>
 #include <mutex>
 #include <string>
+#include <vector>
 // ============================================================================
 // GaudiKernel
 // ============================================================================
+#include <Gaudi/MonitoringHub.h>
 #include <GaudiKernel/IChronoStatSvc.h>
 #include <GaudiKernel/IIncidentListener.h>
 #include <GaudiKernel/Kernel.h>
@@ -40,6 +43,20 @@ class IMessageSvc;
  *   service implements the IChronoStatSvc  interface and  provides the
  *   basic chronometry and some statistical counts needed by all applications
  *
+ *   With the property PerEventRecordFile the service streams, at each EndEvent, a fixed-width binary record
+ *   with the wall time, CPU time and resident memory increase of the event and the elapsed time of each
+ *   "<algorithm>:Execute" chrono (filled by the ChronoAuditor). The file starts with a schema header:
+ *   - the magic string "GCSR", then the version (1), the number of columns and the size of a record as
+ *     32 bits unsigned integers,
+ *   - for each column, its type ('u' for uint64, 'i' for int64 or 'd' for double), the length of its name as
+ *     32 bits unsigned integer and the name (with the unit between square brackets),
+ *   followed by the records, all in native byte order. The algorithm columns are the ":Execute" chronos known
+ *   at the first EndEvent, the time of the chronos appearing later being accumulated in the "others" column.
+ *   In multithreaded jobs the CPU time and memory are the ones of the process, and the algorithm times are
+ *   the ones accumulated since the previous record.
+ *   A summary of the records (number of events, total and slowest event) is published to the MonitoringHub
+ *   as an entity of type "chrono:EventRecord".
+ *
  *   @author:  Vanya BELYAEV Ivan.Belyaev@itep.ru
  *   @daate:   December 1, 1999
  */
@@ -139,6 +156,15 @@ private:
   /// dump the statistics into an ASCII file for offline processing
   void saveStats();
   // ============================================================================
+  /// per-event record: take the resource usage at the beginning of the event
+  void startEventRecord( const EventContext& ctx );
+  /// per-event record: fill the schema header (with the algorithm columns known at that time)
+  void fillRecordHeader();
+  /// per-event record: fill the record of the event (and the header of the file for the first one)
+  void fillEventRecord( const EventContext& ctx );
+  /// per-event record: write the buffered records to the file
+  void flushEventRecords();
+  // ============================================================================
 public:
   // ============================================================================
   // Standard Destructor
@@ -210,6 +236,74 @@ private:
   TimeMap       m_perEvtTime;
   std::ofstream m_ofd;
 
+  Gaudi::Property<std::string>  m_perEventRecordFile{
+      this, "PerEventRecordFile", "",
+      "File name for the binary per-event resource record (wall and CPU time, RSS increase, time per algorithm)" };
+  Gaudi::Property<unsigned int> m_perEventRecordBuffer{ this, "PerEventRecordBuffer", 64,
+                                                        "Number of per-event records buffered before being written" };
+
+  /// resource usage at the BeginEvent of an event slot
+  struct EventStart {
+    std::chrono::steady_clock::time_point wall;
+    long long                             cpu = 0; // microseconds
+    long                                  rss = 0; // kB
+  };
+
+  /// summary of the per-event records, published to the MonitoringHub
+  /// (with its own lock, as the sinks read and reset it from their threads)
+  struct EventRecordSummary {
+    unsigned long long nEvents     = 0;
+    double             wall        = 0; // microseconds
+    double             cpu         = 0; // microseconds
+    long long          rss         = 0; // kB
+    unsigned long long slowestEvt  = 0;
+    double             slowestWall = 0; // microseconds
+    mutable std::mutex mutex;
+
+    void add( unsigned long long evt, double evtWall, double evtCpu, long long evtRss ) {
+      auto lock = std::scoped_lock{ mutex };
+      ++nEvents;
+      wall += evtWall;
+      cpu += evtCpu;
+      rss += evtRss;
+      if ( evtWall > slowestWall ) {
+        slowestWall = evtWall;
+        slowestEvt  = evt;
+      }
+    }
+
+    friend void to_json( nlohmann::json& j, const EventRecordSummary& s ) {
+      auto lock = std::scoped_lock{ s.mutex };
+      j         = { { "type", "chrono:EventRecord" },
+                    { "nEntries", s.nEvents },
+                    { "wall", s.wall },
+                    { "cpu", s.cpu },
+                    { "rssDelta", s.rss },
+                    { "slowestEvent", s.slowestEvt },
+                    { "slowestWall", s.slowestWall } };
+    }
+    friend void reset( EventRecordSummary& s ) {
+      auto lock     = std::scoped_lock{ s.mutex };
+      s.nEvents     = 0;
+      s.wall        = 0;
+      s.cpu         = 0;
+      s.rss         = 0;
+      s.slowestEvt  = 0;
+      s.slowestWall = 0;
+    }
+  };
+
+  std::ofstream                    m_recordFile;
+  std::vector<EventStart>          m_eventStarts;
+  /// chronos of the algorithm columns, fixed at the first record
+  std::vector<const ChronoEntity*> m_recordColumns;
+  /// elapsed times of the algorithm columns (and of the others) at the previous record
+  std::vector<double>              m_recordTotals;
+  bool                             m_recordHeaderDone = false;
+  std::string                      m_recordBuffer;
+  unsigned int                     m_nBufferedRecords = 0;
+  EventRecordSummary               m_recordSummary;
+
   // ============================================================================
 };
 // ============================================================================
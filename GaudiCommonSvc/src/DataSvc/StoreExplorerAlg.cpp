@@ -123,6 +123,9 @@ public:
           case ( CLID_ObjectVector + 0x00040000 ) >> 16: /* Keyed Hashmap */
             access( static_cast<KeyedContainer<KeyedObject<int>, Containers::HashMap>*>( base ) );
             break;
+          case ( CLID_ObjectVector + 0x00070000 ) >> 16: /* Keyed flat hashmap */
+            access( static_cast<KeyedContainer<KeyedObject<int>, Containers::FlatHashMap>*>( base ) );
+            break;
           case ( CLID_ObjectVector + 0x00050000 ) >> 16: /* Keyed array   */
             access( static_cast<KeyedContainer<KeyedObject<int>, Containers::Array>*>( base ) );
             break;
@@ -101,6 +101,7 @@ void Gaudi::Histogram1D::initSums() {
 bool Gaudi::Histogram1D::reset() {
   m_sumwx      = 0;
   m_sumEntries = 0;
+  m_shadow.clear();
   return Base::reset();
 }
 
@@ -110,6 +111,9 @@ void Gaudi::Histogram1D::adoptRepresentation( TObject* rep ) {
   if ( m_rep ) {
     init( m_rep->GetTitle() );
     initSums();
+    // the pending fills refer to the previous representation
+    auto guard = std::scoped_lock{ m_fillSerialization };
+    m_shadow.reshape( m_rep->GetNcells() );
   }
 }
 
@@ -158,12 +162,28 @@ bool Gaudi::Histogram1D::setStatistics( int allEntries, double eqBinEntries, dou
 }
 
 bool Gaudi::Histogram1D::fill( double x, double weight ) {
+  if ( m_shadow.enabled() ) {
+    const int bin = m_rep->GetXaxis()->FindFixBin( x );
+    if ( m_shadow.fill( bin, weight, { x }, bin > 0 && bin <= m_rep->GetNbinsX() ) ) return true;
+  }
   // avoid race conditions when filling the histogram
   auto guard = std::scoped_lock{ m_fillSerialization };
   m_rep->Fill( x, weight );
   return true;
 }
 
+void Gaudi::Histogram1D::setConcurrentFill( bool enable ) {
+  auto guard = std::scoped_lock{ m_fillSerialization };
+  m_shadow.flush( *m_rep );
+  m_shadow.reset( enable ? m_rep->GetNcells() : 0 );
+}
+
+void Gaudi::Histogram1D::flushFills() const {
+  if ( !m_shadow.enabled() ) return;
+  auto guard = std::scoped_lock{ m_fillSerialization };
+  m_shadow.flush( *m_rep );
+}
+
 void Gaudi::Histogram1D::copyFromAida( const AIDA::IHistogram1D& h ) {
   // implement here the copy
   std::string title = h.title() + "Copy";
@@ -181,6 +201,10 @@ void Gaudi::Histogram1D::copyFromAida( const AIDA::IHistogram1D& h ) {
   m_rep->Sumw2();
   m_sumEntries = 0;
   m_sumwx      = 0;
+  {
+    auto guard = std::scoped_lock{ m_fillSerialization };
+    m_shadow.reshape( m_rep->GetNcells() );
+  }
   // sumw
   double sumw = h.sumBinHeights();
   // sumw2
@@ -237,6 +261,10 @@ StreamBuffer& Gaudi::Histogram1D::serialize( StreamBuffer& s ) {
   m_rep->Sumw2();
   m_sumEntries = 0;
   m_sumwx      = 0;
+  {
+    auto guard = std::scoped_lock{ m_fillSerialization };
+    m_shadow.reshape( m_rep->GetNcells() );
+  }
 
   for ( int i = 0; i <= bins + 1; ++i ) {
     s >> binHeight >> binError;
@@ -269,11 +297,11 @@ StreamBuffer& Gaudi::Histogram1D::serialize( StreamBuffer& s ) const {
     for ( int i = 0; i < bins; ++i ) s << axis.binLowerEdge( i );
   }
   s << axis.upperEdge();
-  for ( int i = 0; i <= bins + 1; ++i ) s << m_rep->GetBinContent( i ) << m_rep->GetBinError( i );
+  for ( int i = 0; i <= bins + 1; ++i ) s << rep()->GetBinContent( i ) << rep()->GetBinError( i );
 
-  s << m_rep->GetEntries();
+  s << rep()->GetEntries();
   Stat_t stats[4]; // stats array
-  m_rep->GetStats( stats );
+  rep()->GetStats( stats );
   s << stats[0] << stats[1] << stats[2] << stats[3];
   return s;
 }
@@ -150,6 +150,15 @@ Gaudi::Histogram2D::Histogram2D( TH2D* rep ) {
   m_rep->SetDirectory( nullptr );
 }
 
+void Gaudi::Histogram2D::adoptRepresentation( TObject* rep ) {
+  Base::adoptRepresentation( rep );
+  // the pending fills refer to the previous representation
+  {
+    auto guard = std::scoped_lock{ m_fillSerialization };
+    m_shadow.reshape( m_rep->GetNcells() );
+  }
+}
+
 bool Gaudi::Histogram2D::setBinContents( int i, int j, int entries, double height, double error, double centreX,
                                          double centreY ) {
   m_rep->SetBinContent( rIndexX( i ), rIndexY( j ), height );
@@ -166,16 +175,35 @@ bool Gaudi::Histogram2D::setBinContents( int i, int j, int entries, double heigh
 bool Gaudi::Histogram2D::reset() {
   m_sumwx = 0;
   m_sumwy = 0;
+  m_shadow.clear();
   return Base::reset();
 }
 
 bool Gaudi::Histogram2D::fill( double x, double y, double weight ) {
+  if ( m_shadow.enabled() ) {
+    const int  binX    = m_rep->GetXaxis()->FindFixBin( x );
+    const int  binY    = m_rep->GetYaxis()->FindFixBin( y );
+    const bool inRange = binX > 0 && binX <= m_rep->GetNbinsX() && binY > 0 && binY <= m_rep->GetNbinsY();
+    if ( m_shadow.fill( m_rep->GetBin( binX, binY ), weight, { x, y }, inRange ) ) return true;
+  }
   // avoid race conditiosn when filling the histogram
   auto guard = std::scoped_lock{ m_fillSerialization };
   m_rep->Fill( x, y, weight );
   return true;
 }
 
+void Gaudi::Histogram2D::setConcurrentFill( bool enable ) {
+  auto guard = std::scoped_lock{ m_fillSerialization };
+  m_shadow.flush( *m_rep );
+  m_shadow.reset( enable ? m_rep->GetNcells() : 0 );
+}
+
+void Gaudi::Histogram2D::flushFills() const {
+  if ( !m_shadow.enabled() ) return;
+  auto guard = std::scoped_lock{ m_fillSerialization };
+  m_shadow.flush( *m_rep );
+}
+
 bool Gaudi::Histogram2D::setRms( double rmsX, double rmsY ) {
   m_rep->SetEntries( m_sumEntries );
   std::vector<double> stat( 11 );
@@ -221,6 +249,10 @@ void Gaudi::Histogram2D::copyFromAida( const IHistogram2D& h ) {
   m_sumEntries = 0;
   m_sumwx      = 0;
   m_sumwy      = 0;
+  {
+    auto guard = std::scoped_lock{ m_fillSerialization };
+    m_shadow.reshape( m_rep->GetNcells() );
+  }
   // statistics
   double sumw  = h.sumBinHeights();
   double sumw2 = 0;
@@ -87,6 +87,15 @@ Gaudi::Histogram3D::Histogram3D( TH3D* rep ) {
   m_rep->SetDirectory( nullptr );
 }
 
+void Gaudi::Histogram3D::adoptRepresentation( TObject* rep ) {
+  Base::adoptRepresentation( rep );
+  // the pending fills refer to the previous representation
+  {
+    auto guard = std::scoped_lock{ m_fillSerialization };
+    m_shadow.reshape( m_rep->GetNcells() );
+  }
+}
+
 // set bin content (entries and centre are not used )
 bool Gaudi::Histogram3D::setBinContents( int i, int j, int k, int entries, double height, double error, double centreX,
                                          double centreY, double centreZ ) {
@@ -107,17 +116,38 @@ bool Gaudi::Histogram3D::reset() {
   m_sumwy      = 0;
   m_sumwz      = 0;
   m_sumEntries = 0;
+  m_shadow.clear();
   m_rep->Reset();
   return true;
 }
 
 bool Gaudi::Histogram3D::fill( double x, double y, double z, double weight ) {
+  if ( m_shadow.enabled() ) {
+    const int  binX    = m_rep->GetXaxis()->FindFixBin( x );
+    const int  binY    = m_rep->GetYaxis()->FindFixBin( y );
+    const int  binZ    = m_rep->GetZaxis()->FindFixBin( z );
+    const bool inRange = binX > 0 && binX <= m_rep->GetNbinsX() && binY > 0 && binY <= m_rep->GetNbinsY() &&
+                         binZ > 0 && binZ <= m_rep->GetNbinsZ();
+    if ( m_shadow.fill( m_rep->GetBin( binX, binY, binZ ), weight, { x, y, z }, inRange ) ) return true;
+  }
   // avoid race conditiosn when filling the histogram
   auto guard = std::scoped_lock{ m_fillSerialization };
   m_rep->Fill( x, y, z, weight );
   return true;
 }
 
+void Gaudi::Histogram3D::setConcurrentFill( bool enable ) {
+  auto guard = std::scoped_lock{ m_fillSerialization };
+  m_shadow.flush( *m_rep );
+  m_shadow.reset( enable ? m_rep->GetNcells() : 0 );
+}
+
+void Gaudi::Histogram3D::flushFills() const {
+  if ( !m_shadow.enabled() ) return;
+  auto guard = std::scoped_lock{ m_fillSerialization };
+  m_shadow.flush( *m_rep );
+}
+
 void* Gaudi::Histogram3D::cast( const std::string& className ) const {
   if ( className == "AIDA::IHistogram3D" ) {
     return static_cast<AIDA::IHistogram3D*>( const_cast<Gaudi::Histogram3D*>( this ) );
@@ -186,6 +216,10 @@ void Gaudi::Histogram3D::copyFromAida( const AIDA::IHistogram3D& h ) {
   m_sumwx      = 0;
   m_sumwy      = 0;
   m_sumwz      = 0;
+  {
+    auto guard = std::scoped_lock{ m_fillSerialization };
+    m_shadow.reshape( m_rep->GetNcells() );
+  }
 
   // statistics
   double sumw  = h.sumBinHeights();
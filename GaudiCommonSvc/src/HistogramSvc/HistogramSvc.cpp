@@ -28,6 +28,9 @@
 
 // Local
 #include "GaudiPI.h"
+#include <GaudiCommonSvc/H1D.h>
+#include <GaudiCommonSvc/H2D.h>
+#include <GaudiCommonSvc/H3D.h>
 #include <GaudiCommonSvc/HistogramSvc.h>
 
 namespace {
@@ -233,6 +236,19 @@ StatusCode HistogramSvc::connectInput( const string& ident ) {
   return StatusCode::FAILURE;
 }
 
+//------------------------------------------------------------------------------
+void HistogramSvc::i_enableConcurrentFill( DataObject* obj ) const {
+  if ( !m_concurrentFill ) return;
+  // profiles keep the serialized filling
+  if ( auto h = dynamic_cast<Gaudi::Histogram1D*>( obj ) ) {
+    h->setConcurrentFill( true );
+  } else if ( auto h = dynamic_cast<Gaudi::Histogram2D*>( obj ) ) {
+    h->setConcurrentFill( true );
+  } else if ( auto h = dynamic_cast<Gaudi::Histogram3D*>( obj ) ) {
+    h->setConcurrentFill( true );
+  }
+}
+
 //------------------------------------------------------------------------------
 StatusCode HistogramSvc::initialize() {
   StatusCode status = DataSvc::initialize();
@@ -1,5 +1,5 @@
 /***********************************************************************************\
-* (c) Copyright 1998-2024 CERN for the benefit of the LHCb and ATLAS collaborations *
+* (c) Copyright 1998-2026 CERN for the benefit of the LHCb and ATLAS collaborations *
 *                                                                                   *
 * This software is distributed under the terms of the Apache version 2 licence,     *
 * copied verbatim in the file "LICENSE".                                            *
@@ -10,10 +10,14 @@
 \***********************************************************************************/
 // ========== header
 #include <GaudiKernel/AlgTool.h>
+#include <GaudiKernel/EventContext.h>
 #include <GaudiKernel/IDataStoreLeaves.h>
 #include <GaudiKernel/IIncidentListener.h>
 #include <GaudiKernel/SmartIF.h>
 
+#include <deque>
+#include <mutex>
+
 class IIncidentSvc;
 struct IDataManagerSvc;
 class IDataProviderSvc;
@@ -23,7 +27,9 @@ class IRegistry;
  * to the same source (file).
  *
  * By default, the list of entries is cached and the cache is cleared at every
- * BeginEvent incident.
+ * BeginEvent incident, or when the list is requested for another event than the
+ * one of the cache. There is one cache per event slot, filled under a lock, so
+ * that an instance can be shared by the streams of events processed concurrently.
  *
  * \par Properties:
  * \par
@@ -73,23 +79,37 @@ private:
   /// Pointer to the IDataProviderSvc interface of the data service.
   SmartIF<IDataProviderSvc> m_dataSvc;
 
-  /// Internal cache for the list of objects found during the scan.
-  LeavesList m_leaves;
+  /// Result of the scan for the event in an event slot.
+  struct Cache {
+    /// Internal cache for the list of objects found during the scan.
+    LeavesList leaves;
+    /// Number of the event for which the cache (and \b initialBase) was filled.
+    EventContext::ContextEvt_t evt = EventContext::INVALID_CONTEXT_EVT;
+    /// File ID of the \b Root node.
+    /// It is cached every BeginEvent to be compared with the one seen during the
+    /// collection of the leaves, to avoid that the collection is altered by
+    /// previous calls to an OutputStream.
+    std::string initialBase;
+  };
+  /// Caches of the event slots (a deque, so that growing it does not move the
+  /// lists already returned).
+  mutable std::deque<Cache> m_caches;
+  /// Protect \b m_caches and the scans filling them.
+  mutable std::mutex m_cachesMutex;
+
+  /// Return the cache of an event slot (to be called with the lock held).
+  Cache& i_cache( EventContext::ContextID_t slot ) const;
+  /// Clear the cache for a new event and cache the file ID of the \b Root node.
+  void i_resetCache( Cache& cache, EventContext::ContextEvt_t evt ) const;
 
   /// Scan the data service starting from the node specified as \b Root.
-  void i_collectLeaves();
+  void i_collectLeaves( Cache& cache ) const;
   /// Scan the data service starting from the specified node.
-  void i_collectLeaves( IRegistry* reg );
+  void i_collectLeaves( Cache& cache, IRegistry* reg ) const;
 
   /// Return the pointer to the IRegistry object associated to the node
   /// specified as \b Root.
-  IRegistry* i_getRootNode();
-
-  /// File ID of the \b Root node.
-  /// It is cached every BeginEvent to be compared with the one seen during the
-  /// collection of the leaves, to avoid that the collection is altered by
-  /// previous calls to an OutputStream.
-  std::string m_initialBase;
+  IRegistry* i_getRootNode() const;
 };
 
 // ========== implementation
@@ -100,6 +120,7 @@ private:
 #include <GaudiKernel/IIncidentSvc.h>
 #include <GaudiKernel/IOpaqueAddress.h>
 #include <GaudiKernel/IRegistry.h>
+#include <GaudiKernel/ThreadLocalContext.h>
 
 #include <GaudiKernel/GaudiException.h>
 
@@ -127,8 +148,8 @@ StatusCode DataSvcFileEntriesTool::initialize() {
   // If the Root node is not specified, take the name from the data service itself.
   if ( m_rootNode.empty() ) { m_rootNode = m_dataMgrSvc->rootName(); }
 
-  // Clear the cache (in case the instance is re-initilized).
-  m_leaves.clear();
+  // Clear the caches (in case the instance is re-initilized).
+  m_caches.clear();
   return StatusCode::SUCCESS;
 }
 
@@ -144,26 +165,45 @@ StatusCode DataSvcFileEntriesTool::finalize() {
 }
 
 void DataSvcFileEntriesTool::handle( const Incident& incident ) {
-  // Get the file id of the root node at every event
-  IOpaqueAddress* addr = i_getRootNode()->address();
-  if ( addr )
-    m_initialBase = addr->par()[0];
-  else
-    m_initialBase.clear(); // use empty file id if there is no address
-
-  m_leaves.clear();
+  std::scoped_lock lock( m_cachesMutex );
+  Cache&           cache = i_cache( incident.context().slot() );
+  i_resetCache( cache, incident.context().evt() );
   if ( m_scanOnBeginEvent ) {
     verbose() << "::handle scanning on " << incident.type() << endmsg;
-    i_collectLeaves();
+    i_collectLeaves( cache );
   }
 }
 
 const IDataStoreLeaves::LeavesList& DataSvcFileEntriesTool::leaves() const {
-  if ( m_leaves.empty() ) { const_cast<DataSvcFileEntriesTool*>( this )->i_collectLeaves(); }
-  return m_leaves;
+  const auto&      ctx = Gaudi::Hive::currentContext();
+  std::scoped_lock lock( m_cachesMutex );
+  Cache&           cache = i_cache( ctx.slot() );
+  // the BeginEvent seen for the slot may not be the one of the current event if the
+  // tool is used outside of the event processing (e.g. when capturing an event for replay)
+  if ( ctx.valid() && cache.evt != ctx.evt() ) i_resetCache( cache, ctx.evt() );
+  if ( cache.leaves.empty() ) i_collectLeaves( cache );
+  // the list is only modified again for the next event in the same slot
+  return cache.leaves;
+}
+
+DataSvcFileEntriesTool::Cache& DataSvcFileEntriesTool::i_cache( EventContext::ContextID_t slot ) const {
+  if ( slot == EventContext::INVALID_CONTEXT_ID ) slot = 0; // no event context (e.g. single-threaded event loop)
+  if ( slot >= m_caches.size() ) m_caches.resize( slot + 1 );
+  return m_caches[slot];
+}
+
+void DataSvcFileEntriesTool::i_resetCache( Cache& cache, EventContext::ContextEvt_t evt ) const {
+  cache.evt = evt;
+  // Get the file id of the root node at every event
+  IOpaqueAddress* addr = i_getRootNode()->address();
+  if ( addr )
+    cache.initialBase = addr->par()[0];
+  else
+    cache.initialBase.clear(); // use empty file id if there is no address
+  cache.leaves.clear();
 }
 
-IRegistry* DataSvcFileEntriesTool::i_getRootNode() {
+IRegistry* DataSvcFileEntriesTool::i_getRootNode() const {
   DataObject* obj = nullptr;
   StatusCode  sc  = m_dataSvc->retrieveObject( m_rootNode.value(), obj );
   if ( sc.isFailure() ) {
@@ -172,20 +212,20 @@ IRegistry* DataSvcFileEntriesTool::i_getRootNode() {
   return obj->registry();
 }
 
-void DataSvcFileEntriesTool::i_collectLeaves() { i_collectLeaves( i_getRootNode() ); }
+void DataSvcFileEntriesTool::i_collectLeaves( Cache& cache ) const { i_collectLeaves( cache, i_getRootNode() ); }
 
 /// todo: implement the scanning as an IDataStoreAgent
-void DataSvcFileEntriesTool::i_collectLeaves( IRegistry* reg ) {
+void DataSvcFileEntriesTool::i_collectLeaves( Cache& cache, IRegistry* reg ) const {
   // I do not put sanity checks on the pointers because I know how I'm calling the function
   IOpaqueAddress* addr = reg->address();
   if ( addr ) { // we consider only objects that are in a file
     if ( msgLevel( MSG::VERBOSE ) ) verbose() << "::i_collectLeaves added " << reg->identifier() << endmsg;
-    m_leaves.push_back( reg->object() ); // add this object
+    cache.leaves.push_back( reg->object() ); // add this object
     // Origin of the current object
     const std::string& base = addr->par()[0];
     // Compare with the origin seen during BeginEvent
-    if ( !m_ignoreOriginChange && ( m_initialBase != base ) )
-      throw GaudiException( "Origin of data has changed ('" + m_initialBase + "' !=  '" + base +
+    if ( !m_ignoreOriginChange && ( cache.initialBase != base ) )
+      throw GaudiException( "Origin of data has changed ('" + cache.initialBase + "' !=  '" + base +
                                 "'), probably OutputStream was called before "
                                 "InputCopyStream: check options",
                             name(), StatusCode::FAILURE );
@@ -199,7 +239,7 @@ void DataSvcFileEntriesTool::i_collectLeaves( IRegistry* reg ) {
           DataObject* obj = nullptr;
           sc              = m_dataSvc->retrieveObject( reg, i->name(), obj );
           if ( sc.isSuccess() ) {
-            i_collectLeaves( i );
+            i_collectLeaves( cache, i );
           } else {
             throw GaudiException( "Cannot get " + i->identifier() + " from " + m_dataSvcName, name(),
                                   StatusCode::FAILURE );
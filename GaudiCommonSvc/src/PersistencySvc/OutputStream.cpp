@@ -28,7 +28,7 @@
 
 #include "OutputStream.h"
 
-#include <set>
+#include <algorithm>
 #include <strings.h>
 
 // Define the algorithm factory for the standard output data writer
@@ -37,10 +37,19 @@ DECLARE_COMPONENT( OutputStream )
 #define ON_DEBUG if ( msgLevel( MSG::DEBUG ) )
 
 namespace {
-  bool passed( const Gaudi::Algorithm* alg ) {
-    const auto& algState = alg->execState( Gaudi::Hive::currentContext() );
+  bool passed( const Gaudi::Algorithm* alg, const EventContext& ctx ) {
+    const auto& algState = alg->execState( ctx );
     return algState.state() == AlgExecState::Done && algState.filterPassed();
   }
+
+  /// Tell if all the objects selected by the item `b` are also selected by the item `a`
+  bool covers( const DataStoreItem& a, const DataStoreItem& b ) {
+    if ( b.path() == a.path() ) return b.depth() <= a.depth();
+    if ( !b.path().starts_with( a.path() + '/' ) ) return false;
+    // the objects of b are at levels [n, n + depth(b)) of the subtree of a
+    const auto n = std::count( b.path().begin() + a.path().size(), b.path().end(), '/' );
+    return n + b.depth() <= a.depth();
+  }
 } // namespace
 
 StatusCode OutputStream::start() {
@@ -118,15 +127,10 @@ StatusCode OutputStream::initialize() {
     }
   }
 
-  // Take the item list to the data service preload list.
-  if ( m_doPreLoad ) {
-    for ( auto& j : m_itemList ) m_pDataProvider->addPreLoadItem( *j ).ignore();
-    // Not working: bad reference counting! pdataSvc->release();
-  }
+  // The items are not added to the preload list of the data service, which would load them for all the events:
+  // their objects are loaded while collecting them, only if the event is accepted (see collect()).
+  compileItems();
 
-  if ( m_doPreLoadOpt ) {
-    for ( auto& j : m_optItemList ) m_pDataProvider->addPreLoadItem( *j ).ignore();
-  }
   info() << "Data source: " << m_storeName.value() << " output: " << m_output.value() << endmsg;
 
   // Decode the accept, required and veto Algorithms. The logic is the following:
@@ -183,6 +187,11 @@ StatusCode OutputStream::writeObjects() {
   StatusCode status = collectObjects();
   if ( status.isSuccess() ) {
     IDataSelector* sel = selectedObjects();
+    ON_DEBUG {
+      auto& log = debug() << "Selected " << sel->size() << " object(s):";
+      for ( auto obj : *sel ) log << ' ' << ( obj->registry() ? obj->registry()->identifier() : "UnRegistered" );
+      log << endmsg;
+    }
     if ( sel->begin() != sel->end() ) {
       status = m_pConversionSvc->connectOutput( m_outputName, m_outputType );
       if ( status.isSuccess() ) {
@@ -233,94 +242,69 @@ StatusCode OutputStream::writeObjects() {
 // Place holder to create configurable data store agent
 bool OutputStream::collect( IRegistry* dir, int level ) {
   if ( level < m_currentItem->depth() ) {
-    if ( dir->object() ) {
-      /*
-        std::cout << "Analysing ("
-        << dir->name()
-        << ") Object:"
-        << ((dir->object()==0) ? "UNLOADED" : "LOADED")
-        << std::endl;
-      */
-      m_objects.push_back( dir->object() );
+    DataObject* obj = dir->object();
+    // the event is accepted: load the objects of the item not yet in the store
+    if ( !obj && m_loadCurrentItem && dir->address() ) m_pDataProvider->retrieveObject( dir, "", obj ).ignore();
+    if ( obj ) {
+      if ( m_selected.insert( obj ).second ) m_objects.push_back( obj );
       return true;
     }
   }
   return false;
 }
 
-/// Collect all objects to be written to the output stream
-StatusCode OutputStream::collectObjects() {
+/// Collect the objects of the given items
+StatusCode OutputStream::collectItems( const Items& itms, bool mandatory, bool load, std::string_view what ) {
   StatusCode status = StatusCode::SUCCESS;
-
-  // Traverse the tree and collect the requested objects
-  for ( auto& i : m_itemList ) {
+  m_loadCurrentItem = load;
+  for ( auto& i : itms ) {
     DataObject* obj = nullptr;
     m_currentItem   = i;
     StatusCode iret = m_pDataProvider->retrieveObject( m_currentItem->path(), obj );
     if ( iret.isSuccess() ) {
       iret = collectFromSubTree( obj );
-      if ( !iret.isSuccess() ) status = iret;
-    } else {
-      error() << "Cannot write mandatory object(s) (Not found) " << m_currentItem->path() << endmsg;
+      if ( !iret.isSuccess() && mandatory ) status = iret;
+    } else if ( mandatory ) {
+      error() << "Cannot write " << what << " object(s) (Not found) " << m_currentItem->path() << endmsg;
       status = iret;
-    }
-  }
-
-  // Traverse the tree and collect the requested objects (tolerate missing items here)
-  for ( auto& i : m_optItemList ) {
-    DataObject* obj = nullptr;
-    m_currentItem   = i;
-    StatusCode iret = m_pDataProvider->retrieveObject( m_currentItem->path(), obj );
-    if ( iret.isSuccess() ) iret = collectFromSubTree( obj );
-    if ( !iret.isSuccess() ) {
+    } else {
       ON_DEBUG
       debug() << "Ignore request to write non-mandatory object(s) " << m_currentItem->path() << endmsg;
     }
   }
+  return status;
+}
+
+/// Collect all objects to be written to the output stream
+StatusCode OutputStream::collectObjects() {
+  // Derived streams may have selected objects already (e.g. the input leaves in InputCopyStream): the items must
+  // not add them a second time
+  std::erase_if( m_objects, [this]( DataObject* obj ) { return !m_selected.insert( obj ).second; } );
+
+  // Traverse the tree and collect the requested objects
+  StatusCode status = collectItems( m_itemList, true, m_doPreLoad, "mandatory" );
+
+  // Traverse the tree and collect the requested objects (tolerate missing items here)
+  collectItems( m_optItemList, false, m_doPreLoadOpt, "non-mandatory" ).ignore();
 
   // Collect objects dependent on particular algorithms
-  for ( const auto& iAlgItems : m_algDependentItems ) {
-    auto         alg   = iAlgItems.first;
-    const Items& items = iAlgItems.second;
-    if ( passed( alg ) ) {
+  const auto& ctx = Gaudi::Hive::currentContext();
+  for ( const auto& [alg, items] : m_algDependentItems ) {
+    if ( passed( alg, ctx ) ) {
       ON_DEBUG
       debug() << "Algorithm '" << alg->name() << "' fired. Adding " << items << endmsg;
-      for ( const auto& i : items ) {
-        DataObject* obj = nullptr;
-        m_currentItem   = i;
-        StatusCode iret = m_pDataProvider->retrieveObject( m_currentItem->path(), obj );
-        if ( iret.isSuccess() ) {
-          iret = collectFromSubTree( obj );
-          if ( !iret.isSuccess() ) status = iret;
-        } else {
-          error() << "Cannot write mandatory (algorithm dependent) object(s) (Not found) " << m_currentItem->path()
-                  << endmsg;
-          status = iret;
-        }
-      }
-    }
-  }
-
-  if ( status.isSuccess() ) {
-    // Remove duplicates from the list of objects, preserving the order in the list
-    std::set<DataObject*>    unique;
-    std::vector<DataObject*> tmp; // temporary vector with the reduced list
-    tmp.reserve( m_objects.size() );
-    for ( auto& o : m_objects ) {
-      if ( !unique.count( o ) ) {
-        // if the pointer is not in the set, add it to both the set and the temporary vector
-        unique.insert( o );
-        tmp.push_back( o );
-      }
+      StatusCode iret = collectItems( items, true, false, "mandatory (algorithm dependent)" );
+      if ( !iret.isSuccess() ) status = iret;
     }
-    m_objects.swap( tmp ); // swap the data of the two vectors
   }
-
   return status;
 }
 
 // Clear collected object list
-void OutputStream::clearSelection() { m_objects.clear(); }
+void OutputStream::clearSelection() {
+  m_objects.clear();
+  m_selected.clear();
+}
 
 // Remove all items from the output streamer list;
 void OutputStream::clearItems( Items& itms ) {
@@ -362,6 +346,48 @@ void OutputStream::addItem( Items& itms, const std::string& descriptor ) {
   debug() << "Adding OutputStream item " << item->path() << " with " << item->depth() << " level(s)." << endmsg;
 }
 
+// Remove the redundant items
+void OutputStream::compileItems() {
+  // the same path may be requested several times (e.g. implicitly by VerifyItems): keep the largest depth
+  auto merge = []( Items& itms ) {
+    Items merged;
+    for ( auto i : itms ) {
+      auto same = std::find_if( merged.begin(), merged.end(),
+                                [i]( const DataStoreItem* m ) { return m->path() == i->path(); } );
+      if ( same == merged.end() ) {
+        merged.push_back( i );
+      } else {
+        if ( i->depth() > ( *same )->depth() ) **same = *i;
+        delete i;
+      }
+    }
+    itms.swap( merged );
+  };
+  merge( m_itemList );
+  merge( m_optItemList );
+  for ( auto& [alg, items] : m_algDependentItems ) merge( items );
+
+  // optional items fully covered by a mandatory one are not needed (if they would not load more objects)
+  if ( m_doPreLoad || !m_doPreLoadOpt ) {
+    std::erase_if( m_optItemList, [this]( DataStoreItem* i ) {
+      const bool covered = std::any_of( m_itemList.begin(), m_itemList.end(),
+                                        [i]( const DataStoreItem* m ) { return covers( *m, *i ); } );
+      if ( covered ) delete i;
+      return covered;
+    } );
+  }
+
+  ON_DEBUG {
+    auto print = [this]( std::string_view what, const Items& itms ) {
+      auto& log = debug() << what << ":";
+      for ( auto i : itms ) log << ' ' << i->path() << '#' << i->depth();
+      log << endmsg;
+    };
+    print( "Compiled ItemList", m_itemList );
+    print( "Compiled OptItemList", m_optItemList );
+  }
+}
+
 // Connect to proper conversion service
 StatusCode OutputStream::connectConversionSvc() {
   StatusCode status = StatusCode::FAILURE;
@@ -491,14 +517,17 @@ bool OutputStream::isEventAccepted() const {
   // whether any have been executed and have their filter
   // passed flag set. Any match causes the event to be
   // provisionally accepted.
-  bool result = m_acceptAlgs.empty() || std::any_of( std::begin( m_acceptAlgs ), std::end( m_acceptAlgs ), passed );
+  const auto& ctx       = Gaudi::Hive::currentContext();
+  auto        hasPassed = [&ctx]( const Gaudi::Algorithm* alg ) { return passed( alg, ctx ); };
+  bool        result =
+      m_acceptAlgs.empty() || std::any_of( std::begin( m_acceptAlgs ), std::end( m_acceptAlgs ), hasPassed );
 
   // Loop over all Algorithms in the required list to see
   // whether all have been executed and have their filter
   // passed flag set. Any mismatch causes the event to be
   // rejected.
   if ( result && !m_requireAlgs.empty() ) {
-    result = std::all_of( std::begin( m_requireAlgs ), std::end( m_requireAlgs ), passed );
+    result = std::all_of( std::begin( m_requireAlgs ), std::end( m_requireAlgs ), hasPassed );
   }
 
   // Loop over all Algorithms in the veto list to see
@@ -506,7 +535,7 @@ bool OutputStream::isEventAccepted() const {
   // passed flag set. Any match causes the event to be
   // rejected.
   if ( result && !m_vetoAlgs.empty() ) {
-    result = std::none_of( std::begin( m_vetoAlgs ), std::end( m_vetoAlgs ), passed );
+    result = std::none_of( std::begin( m_vetoAlgs ), std::end( m_vetoAlgs ), hasPassed );
   }
   return result;
 }
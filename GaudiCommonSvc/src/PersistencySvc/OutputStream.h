@@ -19,6 +19,7 @@
 // STL include files
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 // forward declarations
@@ -56,9 +57,11 @@ protected:
       "mapping between algorithm names, and a list of items for which, if the "
       "algorithm in question accepted the event, they should be also stored" };
   Gaudi::Property<bool>                     m_doPreLoad{ this, "Preload", true,
-                                     "flag indicating whether data pre-loading should be performed" };
+                                     "flag indicating whether the objects of the items (up to their depth) should be "
+                                     "loaded, when the event is accepted" };
   Gaudi::Property<bool>                     m_doPreLoadOpt{ this, "PreloadOptItems", false,
-                                        "flag indicating whether optional items should be preloaded" };
+                                        "flag indicating whether the objects of the optional items should be loaded, "
+                                        "when the event is accepted" };
   Gaudi::Property<std::string>              m_output{ this, "Output", {}, "name of the output file specification" };
   Gaudi::Property<std::string>              m_outputName{ this, "OutputFile", {}, "name of the output file" };
   Gaudi::Property<std::string>              m_storeName{ this, "EvtDataSvc", "EventDataSvc",
@@ -104,6 +107,8 @@ protected:
   SmartIF<IConversionSvc> m_pConversionSvc;
   /// Keep track of the current item
   DataStoreItem* m_currentItem;
+  /// Load the objects of the current item that are not in the store yet (see Preload and PreloadOptItems)
+  bool m_loadCurrentItem = false;
   /// Vector of items to be saved to this stream
   Items m_itemList;
   /// Vector of optional items to be saved to this stream
@@ -112,6 +117,8 @@ protected:
   AlgDependentItems m_algDependentItems;
   /// Collection of objects being selected
   IDataSelector m_objects;
+  /// Objects already in m_objects, to select each of them once
+  std::unordered_set<DataObject*> m_selected;
   /// Number of events written to this output stream
   int m_events;
 
@@ -160,6 +167,10 @@ private:
   void clearItems( Items& itms );
   /// Add item to output streamer list
   void addItem( Items& itms, const std::string& descriptor );
+  /// Remove the redundant items, so that the subtrees are traversed only once per event
+  void compileItems();
+  /// Collect the objects of the given items, returning the failure of the first mandatory item not found
+  StatusCode collectItems( const Items& itms, bool mandatory, bool load, std::string_view what );
   /// Return the list of selected objects
   IDataSelector* selectedObjects() { return &m_objects; }
 
@@ -0,0 +1,164 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include <GaudiCommonSvc/ShadowBins.h>
+#include <TH1D.h>
+#include <TH2D.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#if __has_include( <catch2/catch.hpp>)
+// Catch2 v2
+#  include <catch2/catch.hpp>
+#else
+// Catch2 v3
+#  include <catch2/catch_approx.hpp>
+#  include <catch2/catch_test_macros.hpp>
+using Catch::Approx;
+#endif
+
+namespace {
+  void compare( const TH1& ref, const TH1& h ) {
+    REQUIRE( h.GetEntries() == ref.GetEntries() );
+    for ( int bin = 0; bin < ref.GetNcells(); ++bin ) {
+      CHECK( h.GetBinContent( bin ) == Approx( ref.GetBinContent( bin ) ) );
+      CHECK( h.GetBinError( bin ) == Approx( ref.GetBinError( bin ) ) );
+    }
+    std::array<double, 11> refStats{}, stats{};
+    ref.GetStats( refStats.data() );
+    h.GetStats( stats.data() );
+    for ( std::size_t i = 0; i < stats.size(); ++i ) CHECK( stats[i] == Approx( refStats[i] ).margin( 1e-9 ) );
+  }
+} // namespace
+
+TEST_CASE( "ShadowBins 1D" ) {
+  TH1D ref( "ref", "ref", 20, -1., 1. );
+  TH1D h( "h", "h", 20, -1., 1. );
+  ref.Sumw2();
+  h.Sumw2();
+  Gaudi::ShadowBins<1> shadow( h.GetNcells() );
+
+  // Catch2 assertions are not thread-safe
+  std::atomic<bool> ok{ true };
+  auto              fill = [&]( int t ) {
+    for ( int i = 0; i < 1000; ++i ) {
+      const double x   = -1.2 + 2.4 * ( ( i * 7 + t ) % 1000 ) / 1000.;
+      const int    bin = h.GetXaxis()->FindFixBin( x );
+      if ( !shadow.fill( bin, 0.5 + t, { x }, bin > 0 && bin <= h.GetNbinsX() ) ) ok = false;
+    }
+  };
+  std::vector<std::thread> threads;
+  for ( int t = 0; t < 4; ++t ) threads.emplace_back( fill, t );
+  for ( auto& t : threads ) t.join();
+  REQUIRE( ok );
+  // some fills before the first merge, some after
+  shadow.flush( h );
+  fill( 4 );
+  shadow.flush( h );
+
+  for ( int t = 0; t < 5; ++t ) {
+    for ( int i = 0; i < 1000; ++i ) ref.Fill( -1.2 + 2.4 * ( ( i * 7 + t ) % 1000 ) / 1000., 0.5 + t );
+  }
+  compare( ref, h );
+
+  // cleared buffers do not contribute anymore
+  fill( 0 );
+  shadow.clear();
+  shadow.flush( h );
+  compare( ref, h );
+}
+
+TEST_CASE( "ShadowBins 2D" ) {
+  TH2D ref( "ref2", "ref2", 10, 0., 1., 5, 0., 1. );
+  TH2D h( "h2", "h2", 10, 0., 1., 5, 0., 1. );
+  ref.Sumw2();
+  h.Sumw2();
+  Gaudi::ShadowBins<2> shadow( h.GetNcells() );
+
+  for ( int i = 0; i < 1000; ++i ) {
+    const double x = -0.1 + 1.2 * ( i % 100 ) / 100., y = -0.1 + 1.2 * ( i % 37 ) / 37.;
+    ref.Fill( x, y, 2. );
+    const int  binX    = h.GetXaxis()->FindFixBin( x );
+    const int  binY    = h.GetYaxis()->FindFixBin( y );
+    const bool inRange = binX > 0 && binX <= h.GetNbinsX() && binY > 0 && binY <= h.GetNbinsY();
+    REQUIRE( shadow.fill( h.GetBin( binX, binY ), 2., { x, y }, inRange ) );
+  }
+  shadow.flush( h );
+  compare( ref, h );
+}
+
+TEST_CASE( "ShadowBins disabled" ) {
+  Gaudi::ShadowBins<1> shadow;
+  REQUIRE( !shadow.enabled() );
+  REQUIRE( !shadow.fill( 1, 1., { 0. }, true ) );
+  shadow.reset( 12 );
+  REQUIRE( shadow.enabled() );
+  REQUIRE( shadow.fill( 1, 1., { 0. }, true ) );
+  shadow.reset( 0 );
+  REQUIRE( !shadow.fill( 1, 1., { 0. }, true ) );
+}
+
+TEST_CASE( "ShadowBins thread indices are recycled" ) {
+  TH1D                 h( "h3", "h3", 10, 0., 1. );
+  Gaudi::ShadowBins<1> shadow( h.GetNcells() );
+  // many more threads than buffers, but never more than two at the same time
+  int recorded = 0;
+  for ( std::size_t t = 0; t < 4 * Gaudi::ShadowBins<1>::maxThreads; ++t ) {
+    bool ok = false;
+    std::thread( [&] { ok = shadow.fill( 1, 1., { 0.05 }, true ); } ).join();
+    recorded += ok;
+  }
+  CHECK( recorded == 4 * Gaudi::ShadowBins<1>::maxThreads );
+  shadow.flush( h );
+  CHECK( h.GetEntries() == recorded );
+}
+
+TEST_CASE( "ShadowBins memory is bounded" ) {
+  // large enough for only one buffer
+  constexpr std::size_t nCells = Gaudi::ShadowBins<1>::maxBytes / ( 2 * sizeof( double ) );
+  Gaudi::ShadowBins<1>  shadow( nCells );
+  std::atomic<int>      recorded{ 0 };
+  std::atomic<int>      started{ 0 };
+  auto                  fill = [&] {
+    ++started;
+    // keep all the threads alive until every one has tried, so that they have different indices
+    while ( started < 3 ) std::this_thread::yield();
+    recorded += shadow.fill( 1, 1., { 0. }, true );
+  };
+  std::thread t1( fill ), t2( fill );
+  fill();
+  t1.join();
+  t2.join();
+  CHECK( recorded == 1 );
+}
+
+TEST_CASE( "ShadowBins reshaped while filling" ) {
+  TH1D                 h( "h4", "h4", 20, -1., 1. );
+  Gaudi::ShadowBins<1> shadow( h.GetNcells() );
+  std::atomic<bool>    stop{ false };
+  std::atomic<int>     recorded{ 0 };
+  auto                 fill = [&] {
+    while ( !stop ) recorded += shadow.fill( 3, 1., { -0.75 }, true );
+  };
+  std::vector<std::thread> threads;
+  for ( int t = 0; t < 4; ++t ) threads.emplace_back( fill );
+  // the buffers are deleted and recreated under the feet of the filling threads
+  for ( int i = 0; i < 1000; ++i ) {
+    shadow.reset( i % 2 ? 12 : h.GetNcells() );
+    shadow.flush( h );
+  }
+  stop = true;
+  for ( auto& t : threads ) t.join();
+  shadow.flush( h );
+  // the fills pending in the deleted buffers are lost
+  CHECK( h.GetEntries() <= recorded );
+  CHECK( h.GetBinContent( 3 ) <= recorded );
+}
@@ -15,15 +15,75 @@
 #include <GaudiKernel/IAlgManager.h>
 #include <GaudiKernel/ThreadLocalContext.h>
 
+#include <algorithm>
+#include <bit>
+
 DECLARE_COMPONENT( AlgExecStateSvc )
 
+AlgExecStateSvc::SubSlotStates::~SubSlotStates() {
+  for ( auto& chunk : m_chunks ) delete[] chunk.load();
+}
+
+std::pair<std::size_t, std::size_t> AlgExecStateSvc::SubSlotStates::locate( std::size_t subSlot ) {
+  // chunk c holds s_firstChunk * 2^c sub-slots, starting from s_firstChunk * ( 2^c - 1 )
+  const std::size_t chunk = std::bit_width( subSlot / s_firstChunk + 1 ) - 1;
+  return { chunk, subSlot - s_firstChunk * ( ( std::size_t{ 1 } << chunk ) - 1 ) };
+}
+
+AlgExecStateSvc::AlgExecStateInternal* AlgExecStateSvc::SubSlotStates::find( std::size_t subSlot ) const {
+  const auto [chunk, pos] = locate( subSlot );
+  if ( chunk >= s_maxChunks ) return nullptr;
+  auto states = m_chunks[chunk].load( std::memory_order_acquire );
+  return states ? states + pos * m_nAlgs.load( std::memory_order_relaxed ) : nullptr;
+}
+
+AlgExecStateSvc::AlgExecStateInternal* AlgExecStateSvc::SubSlotStates::allocate( std::size_t subSlot,
+                                                                                 std::size_t nAlgs ) {
+  const auto [chunk, pos] = locate( subSlot );
+  if ( chunk >= s_maxChunks ) {
+    throw GaudiException( "Too many subslots (" + std::to_string( subSlot ) + ")", "AlgExecStateSvc",
+                          StatusCode::FAILURE );
+  }
+  auto states = m_chunks[chunk].load( std::memory_order_acquire );
+  if ( !states ) {
+    std::scoped_lock lock( m_mut );
+    states = m_chunks[chunk].load( std::memory_order_relaxed );
+    if ( !states ) {
+      // all the sub-slots have room for the same number of algorithms, so that they are found without locking:
+      // the algorithms added after the first allocation cannot have a state in a sub-slot
+      std::size_t expected = 0;
+      if ( !m_nAlgs.compare_exchange_strong( expected, nAlgs, std::memory_order_acq_rel ) && expected != nAlgs ) {
+        throw GaudiException( "Cannot allocate subslot " + std::to_string( subSlot ) + " for " +
+                                  std::to_string( nAlgs ) + " algorithms, the subslots were allocated for " +
+                                  std::to_string( expected ),
+                              "AlgExecStateSvc", StatusCode::FAILURE );
+      }
+      states = new AlgExecStateInternal[( s_firstChunk << chunk ) * m_nAlgs.load( std::memory_order_relaxed )];
+      m_chunks[chunk].store( states, std::memory_order_release );
+    }
+  }
+  // remember how many sub-slots have to be reset at the end of the event
+  auto used = m_used.load( std::memory_order_relaxed );
+  while ( used <= subSlot && !m_used.compare_exchange_weak( used, subSlot + 1, std::memory_order_relaxed ) ) {}
+  return states + pos * m_nAlgs.load( std::memory_order_relaxed );
+}
+
+void AlgExecStateSvc::SubSlotStates::reset() {
+  const auto n = m_nAlgs.load( std::memory_order_acquire );
+  for ( std::size_t subSlot = 0, used = m_used.exchange( 0 ); subSlot < used; ++subSlot ) {
+    if ( auto states = find( subSlot ) ) std::for_each( states, states + n, []( auto& s ) { s.reset(); } );
+  }
+}
+
 void AlgExecStateSvc::init() {
 
   const std::size_t slots = Gaudi::Concurrency::ConcurrencyFlags::concurrent()
                                 ? std::max( (size_t)1, Gaudi::Concurrency::ConcurrencyFlags::numConcurrentEvents() )
                                 : 1;
   m_algStates.resize( slots );
-  m_eventStatus.resize( slots );
+  m_algSubSlotStates = std::make_unique<SubSlotStates[]>( slots );
+  m_eventStatus      = std::make_unique<std::atomic<EventStatus::Status>[]>( slots );
+  for ( std::size_t i = 0; i < slots; ++i ) m_eventStatus[i] = EventStatus::Invalid;
 
   if ( msgLevel( MSG::DEBUG ) ) debug() << "resizing state containers to : " << slots << endmsg;
 
@@ -54,6 +114,11 @@ AlgExecStateRef::AlgKey AlgExecStateSvc::addAlg( const Gaudi::StringKey& alg ) {
   auto [it, b] =
       m_algNameToIndex.try_emplace( alg, static_cast<AlgExecStateRef::AlgKey>( m_algStates.front().size() ) );
   if ( b ) {
+    if ( std::any_of( m_algSubSlotStates.get(), m_algSubSlotStates.get() + m_algStates.size(),
+                      []( const auto& s ) { return s.nAlgs() > 0; } ) ) {
+      warning() << "adding alg " << alg.str() << " after the allocation of subslots: it cannot run in event views"
+                << endmsg;
+    }
     // create default state for all slots
     for ( auto& a : m_algStates ) a.emplace_back();
     m_errorCount.emplace( it->second, 0 );
@@ -67,22 +132,17 @@ AlgExecStateRef::AlgKey AlgExecStateSvc::addAlg( const Gaudi::StringKey& alg ) {
 AlgExecStateSvc::AlgExecStateInternal& AlgExecStateSvc::getInternalState( const EventContext&     ctx,
                                                                           AlgExecStateRef::AlgKey k ) {
   std::call_once( m_initFlag, &AlgExecStateSvc::init, this );
-  // Sub-slots are dynamic
-  // Assuming the alg is known, look for a subslot
-  // Return the existing state, or create a new one
+  // Sub-slots are normally allocated when the view is scheduled (see allocateSubSlot),
+  // otherwise they are allocated on first use
   if ( ctx.usesSubSlot() ) {
-    // Use mutex since dynamic
-    std::scoped_lock lock( m_mut );
-
-    // Check that there is any sub-slot information for this slot
-    if ( ctx.slot() >= m_algSubSlotStates.size() ) m_algSubSlotStates.resize( ctx.slot() + 1 );
-
-    // Check that there is information for this sub-slot
+    assert( ctx.slot() < m_algStates.size() );
     auto& subSlots = m_algSubSlotStates[ctx.slot()];
-    if ( ctx.subSlot() >= subSlots.size() ) subSlots.resize( ctx.subSlot() + 1 );
-
-    // Find (and potentially extend) the AlgStates
-    return subSlots[ctx.subSlot()].try_emplace( k ).first->second;
+    auto  states   = subSlots.allocate( ctx.subSlot(), m_algNames.size() );
+    if ( static_cast<size_t>( k ) >= subSlots.nAlgs() ) {
+      throw GaudiException( "Algorithm " + algName( k ) + " added after the allocation of subslots", "AlgExecStateSvc",
+                            StatusCode::FAILURE );
+    }
+    return states[static_cast<size_t>( k )];
   }
   // regular case with no subslot
   assert( ctx.slot() < m_algStates.size() );
@@ -94,45 +154,49 @@ AlgExecStateSvc::AlgExecStateInternal const& AlgExecStateSvc::getInternalState(
                                                                                 AlgExecStateRef::AlgKey k ) const {
   assert( m_isInit );
 
-  // Sub-slots are dynamic
-  // Assuming the alg is known, look for a subslot
-  // Return the existing state, or create a new one
   if ( ctx.usesSubSlot() ) {
-    // Use mutex since dynamic
-    std::scoped_lock lock( m_mut );
     // Check that there is any sub-slot information for this slot
-    if ( ctx.slot() >= m_algSubSlotStates.size() ) {
+    if ( ctx.slot() >= m_algStates.size() ) {
       throw GaudiException( "Could not find slot in m_algSubSlotStates", "AlgExecStateSvc", StatusCode::FAILURE );
     }
     // Check that there is information for this sub-slot
-    auto& subSlots = m_algSubSlotStates[ctx.slot()];
-    if ( ctx.subSlot() >= subSlots.size() ) {
+    const auto& subSlots = m_algSubSlotStates[ctx.slot()];
+    auto        states   = subSlots.find( ctx.subSlot() );
+    if ( !states ) {
       throw GaudiException( "Could not find subslot in m_algSubSlotStates", "AlgExecStateSvc", StatusCode::FAILURE );
     }
-    // Find the AlgStates
-    return subSlots[ctx.subSlot()].at( k );
+    if ( static_cast<size_t>( k ) >= subSlots.nAlgs() ) {
+      throw GaudiException( "Could not find algorithm in m_algSubSlotStates", "AlgExecStateSvc", StatusCode::FAILURE );
+    }
+    return states[static_cast<size_t>( k )];
   }
   // regular case with no subslot
   return m_algStates.at( ctx.slot() )[static_cast<size_t>( k )];
 }
 
-const EventStatus::Status& AlgExecStateSvc::eventStatus( const EventContext& ctx ) const {
+EventStatus::Status AlgExecStateSvc::eventStatus( const EventContext& ctx ) const {
   assert( m_isInit );
-  return m_eventStatus.at( ctx.slot() );
+  assert( ctx.slot() < m_algStates.size() );
+  return m_eventStatus[ctx.slot()].load( std::memory_order_acquire );
 }
 
 void AlgExecStateSvc::setEventStatus( const EventStatus::Status& sc, const EventContext& ctx ) {
   std::call_once( m_initFlag, &AlgExecStateSvc::init, this );
-  m_eventStatus.at( ctx.slot() ) = sc;
+  assert( ctx.slot() < m_algStates.size() );
+  m_eventStatus[ctx.slot()].store( sc, std::memory_order_release );
 }
 
 void AlgExecStateSvc::updateEventStatus( const bool& fail, const EventContext& ctx ) {
   std::call_once( m_initFlag, &AlgExecStateSvc::init, this );
-  auto& status = m_eventStatus.at( ctx.slot() );
-  if ( status == EventStatus::Success ) {
-    if ( fail ) status = EventStatus::AlgFail;
-  } else if ( status == EventStatus::Invalid ) {
-    status = ( fail ? EventStatus::AlgFail : EventStatus::Success );
+  assert( ctx.slot() < m_algStates.size() );
+  auto& status  = m_eventStatus[ctx.slot()];
+  auto  current = status.load( std::memory_order_acquire );
+  // only Invalid and Success can be updated, other states are final
+  while ( current == EventStatus::Invalid || ( current == EventStatus::Success && fail ) ) {
+    if ( status.compare_exchange_weak( current, fail ? EventStatus::AlgFail : EventStatus::Success,
+                                       std::memory_order_acq_rel ) ) {
+      break;
+    }
   }
 }
 
@@ -187,11 +251,11 @@ const std::string& AlgExecStateSvc::algName( AlgExecStateRef::AlgKey k ) const {
 }
 
 void AlgExecStateSvc::dump( std::ostream& ost, const EventContext& ctx ) const {
-  const size_t slotID = ctx.valid() ? ctx.slot() : 0;
-  ost << "  [slot: " << slotID << ", incident: " << m_eventStatus.at( slotID ) << "]:\n\n";
-  auto& algState = m_algStates.at( slotID );
-  auto  ml       = std::accumulate( begin( m_algNames ), end( m_algNames ), size_t{ 0 },
-                                    []( size_t m, const auto& as ) { return std::max( m, as.length() ); } );
+  const size_t slotID   = ctx.valid() ? ctx.slot() : 0;
+  auto&        algState = m_algStates.at( slotID );
+  ost << "  [slot: " << slotID << ", incident: " << m_eventStatus[slotID].load() << "]:\n\n";
+  auto ml = std::accumulate( begin( m_algNames ), end( m_algNames ), size_t{ 0 },
+                             []( size_t m, const auto& as ) { return std::max( m, as.length() ); } );
   for ( size_t k = 0; const auto& e : algState )
     ost << "  + " << std::setw( ml ) << algName( static_cast<AlgExecStateRef::AlgKey>( k++ ) ) << "  " << e << '\n';
 }
@@ -207,11 +271,14 @@ void AlgExecStateSvc::reset( const EventContext& ctx ) {
   for ( auto& it : m_algStates.at( ctx.slot() ) ) it.reset();
 
   // Also clear sub slots
-  if ( ctx.slot() < m_algSubSlotStates.size() ) {
-    for ( auto& subSlot : m_algSubSlotStates[ctx.slot()] ) {
-      for ( auto& it : subSlot ) it.second.reset();
-    }
-  }
+  m_algSubSlotStates[ctx.slot()].reset();
 
-  m_eventStatus.at( ctx.slot() ) = EventStatus::Invalid;
+  m_eventStatus[ctx.slot()] = EventStatus::Invalid;
+}
+
+void AlgExecStateSvc::allocateSubSlot( const EventContext& ctx ) {
+  std::call_once( m_initFlag, &AlgExecStateSvc::init, this );
+  assert( ctx.usesSubSlot() );
+  assert( ctx.slot() < m_algStates.size() );
+  m_algSubSlotStates[ctx.slot()].allocate( ctx.subSlot(), m_algNames.size() );
 }
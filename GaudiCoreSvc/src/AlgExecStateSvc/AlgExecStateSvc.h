@@ -16,6 +16,9 @@
 
 #include <fmt/format.h>
 
+#include <array>
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
@@ -61,8 +64,44 @@ class AlgExecStateSvc : public extends<Service, IAlgExecStateSvc> {
     StatusCode             m_execStatus{ StatusCode::FAILURE };
   };
 
-  using AlgStates            = std::vector<AlgExecStateInternal>;
-  using AlgStatesWithSubSlot = std::unordered_map<AlgExecStateRef::AlgKey, AlgExecStateInternal>;
+  using AlgStates = std::vector<AlgExecStateInternal>;
+
+  /**
+   *  states of the algorithms in the sub-slots (event views) of an event slot
+   *
+   *  The states of each sub-slot are a contiguous array indexed by AlgKey. They are stored in chunks of
+   *  increasing size, allocated when a sub-slot is first used and kept for the following events, so that
+   *  the states of an allocated sub-slot can be found without locking. The number of algorithms is fixed by
+   *  the first allocation: the algorithms added later cannot be used in sub-slots.
+   */
+  class SubSlotStates {
+  public:
+    SubSlotStates() = default;
+    ~SubSlotStates();
+    SubSlotStates( const SubSlotStates& )            = delete;
+    SubSlotStates& operator=( const SubSlotStates& ) = delete;
+
+    /// states of the given sub-slot, or nullptr if it was not allocated
+    AlgExecStateInternal* find( std::size_t subSlot ) const;
+    /// states of the given sub-slot, allocating them for nAlgs algorithms if needed
+    AlgExecStateInternal* allocate( std::size_t subSlot, std::size_t nAlgs );
+    /// number of algorithms in each sub-slot (0 until the first allocation)
+    std::size_t nAlgs() const { return m_nAlgs.load( std::memory_order_acquire ); }
+    /// reset the states of the sub-slots used since the last reset
+    void reset();
+
+  private:
+    static constexpr std::size_t s_firstChunk = 16; ///< number of sub-slots in the first chunk
+    static constexpr std::size_t s_maxChunks  = 32;
+
+    /// chunk containing the given sub-slot, and position of the sub-slot in the chunk
+    static std::pair<std::size_t, std::size_t> locate( std::size_t subSlot );
+
+    std::array<std::atomic<AlgExecStateInternal*>, s_maxChunks> m_chunks{};
+    std::atomic<std::size_t>                                     m_nAlgs{ 0 };
+    std::atomic<std::size_t>                                     m_used{ 0 };
+    std::mutex                                                   m_mut;
+  };
 
 public:
   using extends::extends;
@@ -80,13 +119,14 @@ public:
     return { *this, ctx, algKey( algName ) };
   }
   void reset( const EventContext& ctx ) override;
+  void allocateSubSlot( const EventContext& ctx ) override;
 
   using IAlgExecStateSvc::addAlg;
   AlgExecStateRef::AlgKey addAlg( const Gaudi::StringKey& ) override;
 
-  const EventStatus::Status& eventStatus( const EventContext& ctx ) const override;
-  void                       setEventStatus( const EventStatus::Status& sc, const EventContext& ctx ) override;
-  void                       updateEventStatus( const bool& b, const EventContext& ctx ) override;
+  EventStatus::Status eventStatus( const EventContext& ctx ) const override;
+  void                setEventStatus( const EventStatus::Status& sc, const EventContext& ctx ) override;
+  void                updateEventStatus( const bool& b, const EventContext& ctx ) override;
 
   unsigned int algErrorCount( const IAlgorithm* iAlg ) const override;
   void         resetErrorCount() override;
@@ -112,12 +152,13 @@ private:
 
   // one vector entry per event slot
   std::vector<AlgStates> m_algStates;
-  // one map entry per event slot and subslot, with AlgKey as a key, for sparse storage
-  std::vector<std::vector<AlgStatesWithSubSlot>> m_algSubSlotStates;
+  // one entry per event slot, with the states of all its subslots
+  std::unique_ptr<SubSlotStates[]> m_algSubSlotStates;
   // algorithm name to slot (with heterogeneous lookup), needed to regognize double addition
   std::unordered_map<Gaudi::StringKey, AlgExecStateRef::AlgKey, Gaudi::StringKeyHash, std::equal_to<>> m_algNameToIndex;
 
-  std::vector<EventStatus::Status> m_eventStatus;
+  // one entry per event slot
+  std::unique_ptr<std::atomic<EventStatus::Status>[]> m_eventStatus;
   std::vector<Gaudi::StringKey>    m_preInitAlgs;
   // keep the names of the algorithms by AlgKey for logging purposes
   std::vector<std::string> m_algNames;
@@ -129,6 +170,4 @@ private:
   void           checkInit() const;
   std::once_flag m_initFlag;
   bool           m_isInit{ false };
-
-  mutable std::mutex m_mut;
 };
@@ -17,13 +17,19 @@
 #include <GaudiKernel/MsgStream.h>
 #include <GaudiKernel/Service.h>
 #include <algorithm>
+#include <atomic>
 #include <boost/circular_buffer.hpp>
 #include <cassert>
+#include <chrono>
+#include <format>
 #include <functional>
 #include <map>
 #include <mutex>
 #include <numeric>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #define ON_DEBUG if ( msgLevel( MSG::DEBUG ) )
@@ -108,33 +114,82 @@ private:
       {},
       "if non-empty, block the creation of public tools that are not listed in the set" };
 
-  /// Common Tools
+  Gaudi::Property<bool> m_reportCreationTimes{ this, "ReportCreationTimes", false,
+                                               "print at finalize the time spent creating the tools, per tool type" };
+
+  /** Common Tools
+   *
+   *  The changes of the list are done with ToolSvc::m_mut held, as well as most of the accesses, but the tools
+   *  completely created (published) can also be looked up and acquired with ToolList::acquire, which only takes
+   *  a shared lock.
+   */
   class ToolList {
     std::vector<IAlgTool*> m_tools; // List of all instances of tools
+    struct Entry {
+      IAlgTool*    tool;
+      mutable bool published = false;
+    };
     struct Hash {
       using is_transparent = void;
-      std::size_t operator()( IAlgTool const* s ) const noexcept { return std::hash<std::string_view>{}( s->name() ); }
+      std::size_t operator()( Entry const& e ) const noexcept {
+        return std::hash<std::string_view>{}( e.tool->name() );
+      }
       std::size_t operator()( std::string_view s ) const noexcept { return std::hash<std::string_view>{}( s ); }
     };
     struct Equal {
       using is_transparent = void;
-      bool operator()( IAlgTool const* lhs, IAlgTool const* rhs ) const { return lhs->name() == rhs->name(); }
-      bool operator()( IAlgTool const* lhs, std::string_view rhs ) const { return lhs->name() == rhs; }
-      bool operator()( std::string_view lhs, IAlgTool const* rhs ) const { return lhs == rhs->name(); }
+      bool operator()( Entry const& lhs, Entry const& rhs ) const { return lhs.tool->name() == rhs.tool->name(); }
+      bool operator()( Entry const& lhs, std::string_view rhs ) const { return lhs.tool->name() == rhs; }
+      bool operator()( std::string_view lhs, Entry const& rhs ) const { return lhs == rhs.tool->name(); }
     };
-    std::unordered_multiset<IAlgTool*, Hash, Equal> m_map;
+    std::unordered_multiset<Entry, Hash, Equal> m_map;
+    mutable std::shared_mutex                    m_lookupMut; // exclusive for changes, shared for acquire()
 
-  public:
-    void remove( IAlgTool* tool ) {
+    auto entry( std::string_view name, const IInterface* parent ) const {
+      auto range = m_map.equal_range( name );
+      auto it    = std::find_if( range.first, range.second,
+                                 [&]( auto const& e ) { return e.tool->parent() == parent; } );
+      return it != range.second ? &*it : nullptr;
+    }
+    void erase( IAlgTool* tool ) {
       m_tools.erase( std::remove( std::begin( m_tools ), std::end( m_tools ), tool ), std::end( m_tools ) );
       auto range = m_map.equal_range( tool->name() );
-      auto itm   = std::find_if( range.first, range.second, [&]( auto const& p ) { return p == tool; } );
+      auto itm   = std::find_if( range.first, range.second, [&]( auto const& e ) { return e.tool == tool; } );
       if ( itm != range.second ) m_map.erase( itm );
     }
+
+  public:
+    void remove( IAlgTool* tool ) {
+      auto lock = std::unique_lock{ m_lookupMut };
+      erase( tool );
+    }
     void push_back( IAlgTool* tool ) {
+      auto lock = std::unique_lock{ m_lookupMut };
       m_tools.push_back( tool );
       m_map.emplace( tool );
     }
+    /// allow acquire() to find a tool (to be called when its creation is completed)
+    void publish( IAlgTool* tool ) {
+      auto lock = std::unique_lock{ m_lookupMut };
+      if ( auto e = entry( tool->name(), tool->parent() ); e && e->tool == tool ) e->published = true;
+    }
+    /// remove the tool if the caller holds the only reference to it, so that nobody can acquire it any more
+    bool removeIfLast( IAlgTool* tool ) {
+      auto lock = std::unique_lock{ m_lookupMut };
+      if ( tool->refCount() != 1 ) return false;
+      erase( tool );
+      return true;
+    }
+    /// look for a published tool and call `f` on it while it cannot be removed (e.g. to increment its reference
+    /// count), returning false if there is no such tool
+    template <typename F>
+    bool acquire( std::string_view name, const IInterface* parent, F&& f ) const {
+      auto lock = std::shared_lock{ m_lookupMut };
+      auto e    = entry( name, parent );
+      if ( !e || !e->published ) return false;
+      std::invoke( std::forward<F>( f ), e->tool );
+      return true;
+    }
 
     bool contains( std::string_view name ) const { return m_map.find( name ) != m_map.end(); }
     bool contains( IAlgTool const* tool ) const {
@@ -144,12 +199,12 @@ private:
     auto size() const { return m_tools.size(); }
     auto begin() const { return m_tools.begin(); }
     auto end() const { return m_tools.end(); }
-    auto find( std::string_view name, const IInterface* parent ) const {
-      auto range = m_map.equal_range( name );
-      auto it    = std::find_if( range.first, range.second, [&]( auto const& p ) { return p->parent() == parent; } );
-      return it != range.second ? *it : nullptr;
+    IAlgTool* find( std::string_view name, const IInterface* parent ) const {
+      auto e = entry( name, parent );
+      return e ? e->tool : nullptr;
     }
     std::vector<IAlgTool*> grab() && {
+      auto lock = std::unique_lock{ m_lookupMut };
       m_map.clear();
       auto tools = std::move( m_tools );
       return tools;
@@ -162,6 +217,15 @@ private:
   SmartIF<IHistorySvc> m_pHistorySvc;
 
   std::vector<IToolSvc::Observer*> m_observers;
+  /// set when the first observer is registered, as the observers disable the lookups without m_mut
+  std::atomic<bool> m_hasObservers{ false };
+
+  /// Number of tools created and time spent in their creation (including the tools they create)
+  struct CreationStats {
+    std::size_t                         count = 0;
+    std::chrono::steady_clock::duration time{};
+  };
+  std::unordered_map<std::string, CreationStats> m_creationStats; // protected by m_mut
 };
 
 namespace {
@@ -214,6 +278,20 @@ StatusCode ToolSvc::finalize() {
         - explicitly release all tools, one release() on all tools per loop.
         -> tools are deleted in the order of increasing number of refCounts.
   */
+  if ( m_reportCreationTimes ) {
+    using ms = std::chrono::duration<double, std::milli>;
+    std::vector<std::pair<std::string, CreationStats>> stats{ begin( m_creationStats ), end( m_creationStats ) };
+    std::sort( begin( stats ), end( stats ), []( auto& a, auto& b ) { return a.second.time > b.second.time; } );
+    info() << "Creation time of the tools, per type (including the tools they create):" << endmsg;
+    info() << std::format( "{:<50.50} | {:>9} | {:>10} | {:>10}", "Type", "count", "total (ms)", "mean (ms)" )
+           << endmsg;
+    for ( const auto& [type, s] : stats ) {
+      info() << std::format( "{:<50.50} | {:9} | {:10.3f} | {:10.3f}", type, s.count, ms( s.time ).count(),
+                             ms( s.time ).count() / s.count )
+             << endmsg;
+    }
+  }
+
   info() << "Removing all tools created by ToolSvc" << endmsg;
   auto tools = std::move( m_instancesTools ).grab();
 
@@ -376,37 +454,58 @@ StatusCode ToolSvc::retrieve( std::string_view tooltype, std::string_view toolna
   if ( !parent ) parent = this;
   const std::string fullname = nameTool( toolname, parent );
 
-  // Find tool in list of those already existing, and tell its
-  // interface that it has been used one more time
-  auto      lock  = std::scoped_lock{ m_mut };
-  IAlgTool* itool = m_instancesTools.find( fullname, parent );
-  if ( itool ) { ON_DEBUG debug() << "Retrieved tool " << toolname << " with parent " << parent << endmsg; }
+  // Get the right interface of a tool and tell it that it has been used one more time
+  IAlgTool* itool   = nullptr;
+  auto      acquire = [&]( IAlgTool* t ) {
+    itool = t;
+    tool  = reinterpret_cast<IAlgTool*>( t->i_cast( iid ) );
+    if ( tool ) tool->addRef();
+  };
+
+  // Find tool in list of those already existing, without taking the lock
+  // unless the observers have to be notified
+  auto lock  = std::unique_lock{ m_mut, std::defer_lock };
+  bool found = !m_hasObservers.load( std::memory_order_acquire ) &&
+               m_instancesTools.acquire( fullname, parent, acquire );
+  if ( !found ) {
+    lock.lock();
+    found = m_instancesTools.acquire( fullname, parent, acquire );
+    // tools still being created can only be seen by the thread creating them (e.g. circular dependencies)
+    if ( !found ) {
+      if ( auto t = m_instancesTools.find( fullname, parent ) ) {
+        acquire( t );
+        found = true;
+      }
+    }
+  }
+  if ( found ) { ON_DEBUG debug() << "Retrieved tool " << toolname << " with parent " << parent << endmsg; }
 
-  if ( !itool ) {
+  if ( !found ) {
     // Instances of this tool do not exist, create an instance if desired
     // otherwise return failure
     if ( !createIf ) {
       warning() << "Tool " << toolname << " not found and creation not requested" << endmsg;
       return StatusCode::FAILURE;
     }
-    auto sc = create( std::string{ tooltype }, std::string{ toolname }, parent, itool );
+    IAlgTool* created = nullptr;
+    auto      sc      = create( std::string{ tooltype }, std::string{ toolname }, parent, created );
     if ( sc.isFailure() ) { return sc; }
+    acquire( created );
   }
 
-  // Get the right interface of it
-  tool = reinterpret_cast<IAlgTool*>( itool->i_cast( iid ) );
   if ( !tool ) {
     error() << "Tool " << toolname << " either does not implement the correct interface, or its version is incompatible"
             << endmsg;
     return StatusCode::FAILURE;
   }
-  tool->addRef();
 
   ///////////////
   /// invoke retrieve callbacks...
   ///////////////
-  std::for_each( std::begin( m_observers ), std::end( m_observers ),
-                 [&]( IToolSvc::Observer* obs ) { obs->onRetrieve( itool ); } );
+  if ( lock.owns_lock() ) {
+    std::for_each( std::begin( m_observers ), std::end( m_observers ),
+                   [&]( IToolSvc::Observer* obs ) { obs->onRetrieve( itool ); } );
+  }
   return StatusCode::SUCCESS;
 }
 
@@ -438,22 +537,20 @@ StatusCode ToolSvc::releaseTool( IAlgTool* tool ) {
   StatusCode sc( StatusCode::SUCCESS );
   // test if tool is in known list (protect trying to access a previously deleted tool)
   if ( m_instancesTools.contains( tool ) ) {
-    unsigned long count = tool->refCount();
-    if ( count == 1 ) {
+    // remove from known tools if this is the last reference, before it can be retrieved again
+    if ( m_instancesTools.removeIfLast( tool ) ) {
       // finalize the tool
 
       if ( Gaudi::StateMachine::OFFLINE == m_targetState ) {
         // We are being called during ToolSvc::finalize()
         // message format matches the one in ToolSvc::finalize()
-        debug() << "  Performing finalization of " << tool->name() << " (refCount " << count << ")" << endmsg;
+        debug() << "  Performing finalization of " << tool->name() << " (refCount 1)" << endmsg;
         // message format matches the one in ToolSvc::finalize()
         debug() << "  Performing     deletion of " << tool->name() << endmsg;
       } else {
         debug() << "Performing finalization and deletion of " << tool->name() << endmsg;
       }
       sc = finalizeTool( tool );
-      // remove from known tools...
-      m_instancesTools.remove( tool );
     }
     tool->release();
   }
@@ -533,21 +630,20 @@ StatusCode ToolSvc::create( const std::string& tooltype, const std::string& tool
   // The tool is removed from the list of known tools too.
   auto lock      = std::scoped_lock{ m_mut };
   auto toolguard = make_toolCreateGuard( m_instancesTools );
+  auto start     = std::chrono::steady_clock::now();
 
   // Check if the tool already exist : this could happen with clones
   std::string fullname = nameTool( toolname, parent );
   if ( existsTool( fullname ) ) {
     // Now check if the parent is the same. This allows for clones
-    for ( IAlgTool* iAlgTool : m_instancesTools ) {
-      if ( iAlgTool->name() == toolname && iAlgTool->parent() == parent ) {
-        // The tool exist with this name, type and parent: this is bad!
-        // This excludes the possibility of cloning public tools intrinsecally
-        error() << "Tool " << fullname << " already exists with the same parent" << endmsg;
-        if ( parent == this )
-          error() << "... In addition, the parent is the ToolSvc: public tools cannot be cloned!" << endmsg;
-
-        return StatusCode::FAILURE;
-      }
+    if ( m_instancesTools.find( fullname, parent ) ) {
+      // The tool exist with this name, type and parent: this is bad!
+      // This excludes the possibility of cloning public tools intrinsecally
+      error() << "Tool " << fullname << " already exists with the same parent" << endmsg;
+      if ( parent == this )
+        error() << "... In addition, the parent is the ToolSvc: public tools cannot be cloned!" << endmsg;
+
+      return StatusCode::FAILURE;
     }
     ON_DEBUG debug() << "Creating clone of " << fullname << endmsg;
   }
@@ -648,6 +744,11 @@ StatusCode ToolSvc::create( const std::string& tooltype, const std::string& tool
   // The tool has been successfully created and initialized,
   // so we inform the guard that it can release it
   tool = toolguard.release();
+  m_instancesTools.publish( tool );
+
+  auto& stats = m_creationStats[tooltype];
+  ++stats.count;
+  stats.time += std::chrono::steady_clock::now() - start;
 
   ///////////////
   /// invoke create callbacks...
@@ -712,6 +813,7 @@ void ToolSvc::registerObserver( IToolSvc::Observer* obs ) {
   if ( !obs ) throw GaudiException( "Received NULL pointer", this->name() + "::registerObserver", StatusCode::FAILURE );
 
   auto lock = std::scoped_lock{ m_mut };
+  m_hasObservers.store( true, std::memory_order_release );
   obs->setUnregister( [this, obs]() {
     auto lock = std::scoped_lock{ m_mut };
     auto i    = std::find( m_observers.begin(), m_observers.end(), obs );
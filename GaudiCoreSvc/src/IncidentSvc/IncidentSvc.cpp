@@ -18,6 +18,7 @@
 #include <GaudiKernel/LockedChrono.h>
 #include <GaudiKernel/MsgStream.h>
 #include <GaudiKernel/SmartIF.h>
+#include <thread>
 
 DECLARE_COMPONENT( IncidentSvc )
 
@@ -28,6 +29,23 @@ namespace {
     SmartIF<INamedInterface> iNamed( lis );
     return iNamed ? iNamed->name() : s_unknown;
   }
+  /// Counters of the calls to listeners in progress in the current thread (see IncidentSvc::removeListener)
+  thread_local std::vector<const std::atomic<int>*> s_activeCalls;
+
+  /// Record a call to a listener in its counter of calls in progress, for the duration of the scope
+  class ActiveCall {
+    std::atomic<int>& m_count;
+
+  public:
+    ActiveCall( std::atomic<int>& count ) : m_count( count ) {
+      ++m_count;
+      s_activeCalls.push_back( &m_count );
+    }
+    ~ActiveCall() {
+      s_activeCalls.pop_back();
+      --m_count;
+    }
+  };
 } // namespace
 
 #define ON_DEBUG if ( msgLevel( MSG::DEBUG ) )
@@ -36,7 +54,12 @@ namespace {
 #define DEBMSG ON_DEBUG debug()
 #define VERMSG ON_VERBOSE verbose()
 
-IncidentSvc::IncidentSvc( const std::string& name, ISvcLocator* svc ) : base_class( name, svc ) {}
+IncidentSvc::IncidentSvc( const std::string& name, ISvcLocator* svc ) : base_class( name, svc ) {
+  m_concurrent.declareUpdateHandler( [this]( Gaudi::Details::PropertyBase& ) {
+    auto lock = std::scoped_lock{ m_listenerMapMutex };
+    updateSnapshot();
+  } );
+}
 IncidentSvc::~IncidentSvc() { auto lock = std::scoped_lock{ m_listenerMapMutex }; }
 StatusCode IncidentSvc::finalize() {
   DEBMSG << m_timer.outputUserTime( "Incident  timing: Mean(+-rms)/Min/Max:%3%(+-%4%)/%6%/%7%[ms] ", System::milliSec )
@@ -72,6 +95,7 @@ void IncidentSvc::addListener( IIncidentListener* lis, const std::string& type,
   // We insert before the current position
   DEBMSG << "Adding [" << type << "] listener '" << getListenerName( lis ) << "' with priority " << prio << endmsg;
   llist.emplace( i, IIncidentSvc::Listener{ lis, prio, rethrow, singleShot } );
+  updateSnapshot( ltype );
 }
 IncidentSvc::ListenerMap::iterator
 IncidentSvc::removeListenerFromList( ListenerMap::iterator i, IIncidentListener* item, bool scheduleRemoval ) {
@@ -92,16 +116,77 @@ IncidentSvc::removeListenerFromList( ListenerMap::iterator i, IIncidentListener*
   return c.empty() ? m_listenerMap.erase( i ) : std::next( i );
 }
 void IncidentSvc::removeListener( IIncidentListener* lis, const std::string& type ) {
-  auto lock = std::scoped_lock{ m_listenerMapMutex };
+  std::vector<std::shared_ptr<ListenerState>> removed;
+  {
+    auto lock = std::scoped_lock{ m_listenerMapMutex };
+
+    // prevent new concurrent calls to the listeners being removed
+    for ( const auto& [key, state] : m_listenerStates ) {
+      if ( ( !lis || key.second == lis ) && ( type.empty() || key.first == type ) ) {
+        state->removed = true;
+        removed.push_back( state );
+      }
+    }
 
-  bool scheduleForRemoval = ( m_currentIncidentType && type == *m_currentIncidentType );
-  if ( type.empty() ) {
-    auto i = std::begin( m_listenerMap );
-    while ( i != std::end( m_listenerMap ) ) { i = removeListenerFromList( i, lis, scheduleForRemoval ); }
-  } else {
-    auto i = m_listenerMap.find( type );
-    if ( i != m_listenerMap.end() ) removeListenerFromList( i, lis, scheduleForRemoval );
+    bool scheduleForRemoval = ( m_currentIncidentType && type == *m_currentIncidentType );
+    if ( type.empty() ) {
+      auto i = std::begin( m_listenerMap );
+      while ( i != std::end( m_listenerMap ) ) { i = removeListenerFromList( i, lis, scheduleForRemoval ); }
+      updateSnapshot();
+    } else {
+      auto i = m_listenerMap.find( type );
+      if ( i != m_listenerMap.end() ) removeListenerFromList( i, lis, scheduleForRemoval );
+      updateSnapshot( type );
+    }
+  }
+  // the listener may be deleted as soon as we return, so wait for the calls to it still in progress in other
+  // threads (not for the ones in this thread, i.e. if we are called by a handler, which would never end)
+  for ( const auto& state : removed ) {
+    const auto own = std::count( begin( s_activeCalls ), end( s_activeCalls ), &state->active );
+    while ( state->active.load() > own ) std::this_thread::yield();
+  }
+}
+void IncidentSvc::updateSnapshot() {
+  for ( std::size_t shard = 0; shard < s_nShards; ++shard ) updateShard( shard );
+}
+void IncidentSvc::updateSnapshot( const std::string& type ) { updateShard( shardOf( type ) ); }
+void IncidentSvc::updateShard( std::size_t shard ) {
+  auto inShard = [shard]( const auto& entry ) { return shardOf( entry.first.first ) == shard; };
+  if ( !m_concurrent ) {
+    // the snapshots are only used by the concurrent dispatch
+    if ( m_snapshots[shard].load() ) {
+      std::erase_if( m_listenerStates, inShard );
+      m_snapshots[shard].store( nullptr );
+    }
+    return;
   }
+
+  auto snapshot = std::make_shared<ListenerSnapshot>();
+  // the states (e.g. the single shot flags) are kept for the listeners still registered
+  decltype( m_listenerStates ) states;
+  for ( const auto& [type, listeners] : m_listenerMap ) {
+    if ( shardOf( type ) != shard ) continue;
+    auto& entries = ( *snapshot )[type];
+    entries.reserve( listeners->size() );
+    for ( const auto& l : *listeners ) {
+      std::pair<std::string, IIncidentListener*> key{ type, l.iListener };
+      auto& state = states[key];
+      if ( !state ) {
+        if ( auto old = m_listenerStates.find( key ); old != m_listenerStates.end() ) {
+          state = old->second;
+        } else {
+          // thread-safe listeners do not need to be serialized
+          state             = std::make_shared<ListenerState>();
+          state->serialized = !l.iListener->isThreadSafe();
+        }
+      }
+      entries.push_back( { l, state } );
+    }
+  }
+  // forget about the listeners of the shard that were removed
+  std::erase_if( m_listenerStates, inShard );
+  m_listenerStates.merge( states );
+  m_snapshots[shard].store( std::move( snapshot ) );
 }
 namespace {
   /// Helper class to identify a singleShot Listener
@@ -113,63 +198,19 @@ void IncidentSvc::i_fireIncident( const Incident& incident, const std::string& l
 
   auto lock = std::scoped_lock{ m_listenerMapMutex };
 
-  // Wouldn't it be better to write a small 'ReturnCode' service which
-  // looks for these 'special' incidents and does whatever needs to
-  // be done instead of making a special case here?
-
-  // Special case: FailInputFile incident must set the application return code
-  if ( incident.type() == IncidentType::FailInputFile || incident.type() == IncidentType::CorruptedInputFile ) {
-    auto appmgr = serviceLocator()->as<IProperty>();
-    Gaudi::setAppReturnCode( appmgr, incident.type() == IncidentType::FailInputFile
-                                         ? Gaudi::ReturnCode::FailInput
-                                         : Gaudi::ReturnCode::CorruptedInput )
-        .ignore();
-  }
-
   auto ilisteners = m_listenerMap.find( listenerType );
   if ( m_listenerMap.end() == ilisteners ) return;
 
   // setting this pointer will avoid that a call to removeListener() during
   // the loop triggers a segfault
   m_currentIncidentType = &incident.type();
-  std::string curIncTyp;
-  if ( m_currentIncidentType != nullptr ) {
-    curIncTyp = *m_currentIncidentType;
-  } else {
-    curIncTyp = "UNKNOWN";
-  }
 
   bool firedSingleShot = false;
 
   auto& listeners = *ilisteners->second;
 
   for ( auto& listener : listeners ) {
-
-    VERMSG << "Calling '" << getListenerName( listener.iListener ) << "' for incident [" << incident.type() << "]"
-           << endmsg;
-
-    // handle exceptions if they occur
-    try {
-      listener.iListener->handle( incident );
-    } catch ( const GaudiException& exc ) {
-      error() << "Exception with tag=" << exc.tag()
-              << " is caught"
-                 " handling incident "
-              << curIncTyp << " in listener " << getListenerName( listener.iListener ) << endmsg;
-      error() << exc << endmsg;
-      if ( listener.rethrow ) { throw exc; }
-    } catch ( const std::exception& exc ) {
-      error() << "Standard std::exception is caught"
-                 " handling incident "
-              << curIncTyp << " in listener " << getListenerName( listener.iListener ) << endmsg;
-      error() << exc.what() << endmsg;
-      if ( listener.rethrow ) { throw exc; }
-    } catch ( ... ) {
-      error() << "UNKNOWN Exception is caught"
-                 " handling incident "
-              << curIncTyp << " in listener " << getListenerName( listener.iListener ) << endmsg;
-      if ( listener.rethrow ) { throw; }
-    }
+    callListener( listener, incident );
     // check wheter one of the listeners is singleShot
     firedSingleShot |= listener.singleShot;
   }
@@ -178,11 +219,97 @@ void IncidentSvc::i_fireIncident( const Incident& incident, const std::string& l
     listeners.erase( std::remove_if( std::begin( listeners ), std::end( listeners ), isSingleShot ),
                      std::end( listeners ) );
     if ( listeners.empty() ) m_listenerMap.erase( ilisteners );
+    updateSnapshot( listenerType );
   }
 
   m_currentIncidentType = nullptr;
 }
+void IncidentSvc::i_fireIncidentConcurrent( const Incident& incident, const std::string& listenerType ) {
+  const auto snapshot = m_snapshots[shardOf( listenerType )].load();
+  if ( !snapshot ) return;
+  auto ilisteners = snapshot->find( listenerType );
+  if ( snapshot->end() == ilisteners ) return;
+
+  std::vector<IIncidentListener*> firedSingleShot;
+  for ( const auto& entry : ilisteners->second ) {
+    auto& state = *entry.state;
+    if ( entry.listener.singleShot && state.fired.exchange( true ) ) continue; // already fired by another thread
+    // a single (recursive) lock for all the listeners that are not thread-safe, so that a handler firing an
+    // incident cannot deadlock with another thread doing the same
+    std::unique_lock<std::recursive_mutex> lock;
+    if ( state.serialized ) lock = std::unique_lock{ m_serialMutex };
+    // the call is counted before checking for the removal, so that removeListener() waits for it, but only once
+    // the lock is taken, as the thread removing the listener may hold it
+    ActiveCall call( state.active );
+    if ( state.removed ) continue;
+    callListener( entry.listener, incident );
+    if ( entry.listener.singleShot ) firedSingleShot.push_back( entry.listener.iListener );
+  }
+
+  if ( !firedSingleShot.empty() ) {
+    // remove all the singleshot listeners that got their shot...
+    auto lock = std::scoped_lock{ m_listenerMapMutex };
+    auto i    = m_listenerMap.find( listenerType );
+    if ( i != m_listenerMap.end() ) {
+      auto gotShot = [&]( const Listener& l ) {
+        return l.singleShot && std::find( begin( firedSingleShot ), end( firedSingleShot ), l.iListener ) !=
+                                   end( firedSingleShot );
+      };
+      auto& listeners = *i->second;
+      listeners.erase( std::remove_if( std::begin( listeners ), std::end( listeners ), gotShot ),
+                       std::end( listeners ) );
+      if ( listeners.empty() ) m_listenerMap.erase( i );
+      updateSnapshot( listenerType );
+    }
+  }
+}
+void IncidentSvc::callListener( const Listener& listener, const Incident& incident ) {
+  VERMSG << "Calling '" << getListenerName( listener.iListener ) << "' for incident [" << incident.type() << "]"
+         << endmsg;
+
+  // handle exceptions if they occur
+  try {
+    listener.iListener->handle( incident );
+  } catch ( const GaudiException& exc ) {
+    error() << "Exception with tag=" << exc.tag()
+            << " is caught"
+               " handling incident "
+            << incident.type() << " in listener " << getListenerName( listener.iListener ) << endmsg;
+    error() << exc << endmsg;
+    if ( listener.rethrow ) { throw exc; }
+  } catch ( const std::exception& exc ) {
+    error() << "Standard std::exception is caught"
+               " handling incident "
+            << incident.type() << " in listener " << getListenerName( listener.iListener ) << endmsg;
+    error() << exc.what() << endmsg;
+    if ( listener.rethrow ) { throw exc; }
+  } catch ( ... ) {
+    error() << "UNKNOWN Exception is caught"
+               " handling incident "
+            << incident.type() << " in listener " << getListenerName( listener.iListener ) << endmsg;
+    if ( listener.rethrow ) { throw; }
+  }
+}
 void IncidentSvc::fireIncident( const Incident& incident ) {
+  // Wouldn't it be better to write a small 'ReturnCode' service which
+  // looks for these 'special' incidents and does whatever needs to
+  // be done instead of making a special case here?
+
+  // Special case: FailInputFile incident must set the application return code
+  if ( incident.type() == IncidentType::FailInputFile || incident.type() == IncidentType::CorruptedInputFile ) {
+    auto appmgr = serviceLocator()->as<IProperty>();
+    Gaudi::setAppReturnCode( appmgr, incident.type() == IncidentType::FailInputFile
+                                         ? Gaudi::ReturnCode::FailInput
+                                         : Gaudi::ReturnCode::CorruptedInput )
+        .ignore();
+  }
+
+  if ( m_concurrent ) {
+    // the timer is not thread-safe, so no timing in this mode
+    i_fireIncidentConcurrent( incident, incident.type() );
+    if ( incident.type() != "ALL" ) i_fireIncidentConcurrent( incident, "ALL" );
+    return;
+  }
 
   Gaudi::Utils::LockedChrono timer( m_timer, m_timerLock );
 
@@ -15,9 +15,18 @@
 #include <GaudiKernel/IIncidentSvc.h>
 #include <GaudiKernel/Service.h>
 #include <GaudiKernel/StringKey.h>
+#include <array>
+#include <atomic>
+#include <functional>
 #include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string_view>
 #include <tbb/concurrent_queue.h>
 #include <tbb/concurrent_unordered_map.h>
+#include <unordered_map>
+#include <vector>
 
 /**
  * @class IncidentSvc
@@ -28,6 +37,16 @@
  *    synchronized across threads.
  *  - Calls to IIncidentListener::handle() are serialized, i.e. at any time
  *    there is at most one incident handler being executed across all threads.
+ *
+ * If the property `ConcurrentDispatch` is set, fireIncident() does not take the
+ * global lock: the listeners are taken from read-only snapshots of the lists,
+ * sharded by incident type so that addListener() and removeListener() only
+ * rebuild the shard of the type they change. The listeners declaring
+ * IIncidentListener::isThreadSafe() are invoked concurrently, while the calls to
+ * the other listeners are still serialized, with a single recursive lock: a
+ * handler can fire incidents from within handle() as in the default mode.
+ * removeListener() returns only when the calls in progress to the removed listener
+ * (in other threads) are over.
  */
 
 struct isSingleShot_t;
@@ -58,9 +77,44 @@ public:
   IIncidentSvc::IncidentPack getIncidents( const EventContext* ctx ) override;
 
 private:
+  /// State of a registered listener for the concurrent dispatch, kept across the rebuilds of the snapshot
+  struct ListenerState {
+    /// whether the calls to the listener are serialized with m_serialMutex
+    bool serialized = true;
+    /// number of calls to the listener in progress
+    std::atomic<int> active{ 0 };
+    /// flag set when the listener is removed, so that no new call is started
+    std::atomic<bool> removed{ false };
+    /// flag set when a single shot listener got its shot
+    std::atomic<bool> fired{ false };
+  };
+  /// Listener as seen by the concurrent dispatch
+  struct SnapshotEntry {
+    Listener                       listener;
+    std::shared_ptr<ListenerState> state;
+  };
+  typedef std::unordered_map<std::string, std::vector<SnapshotEntry>> ListenerSnapshot;
+
   ListenerMap::iterator removeListenerFromList( ListenerMap::iterator, IIncidentListener* item, bool scheduleRemoval );
   /// Internal function to allow incidents listening to all events
   void i_fireIncident( const Incident& incident, const std::string& type );
+  /// Internal function dispatching an incident without the global lock (see ConcurrentDispatch)
+  void i_fireIncidentConcurrent( const Incident& incident, const std::string& type );
+  /// Invoke a listener, handling the exceptions it may throw
+  void callListener( const Listener& listener, const Incident& incident );
+  /// Rebuild the snapshots of the listener lists, if the concurrent dispatch is enabled
+  /// (m_listenerMapMutex must be held)
+  void updateSnapshot();
+  /// Rebuild the snapshot of the shard of the given incident type (m_listenerMapMutex must be held)
+  void updateSnapshot( const std::string& type );
+  /// Rebuild the snapshot of a shard (m_listenerMapMutex must be held)
+  void updateShard( std::size_t shard );
+  /// Shard of the snapshots holding the listeners of an incident type
+  static std::size_t shardOf( std::string_view type ) { return std::hash<std::string_view>{}( type ) % s_nShards; }
+
+  Gaudi::Property<bool> m_concurrent{
+      this, "ConcurrentDispatch", false,
+      "do not serialize all the incident handlers, only the ones of listeners that are not thread-safe" };
 
   /// List of auditor names
   ListenerMap m_listenerMap;
@@ -72,6 +126,15 @@ private:
   /// Mutex to synchronize access to m_listenerMap
   mutable std::recursive_mutex m_listenerMapMutex;
 
+  /// Number of shards of the snapshots
+  static constexpr std::size_t s_nShards = 16;
+  /// Read-only copies of m_listenerMap used by the concurrent dispatch, sharded by incident type
+  std::array<std::atomic<std::shared_ptr<const ListenerSnapshot>>, s_nShards> m_snapshots;
+  /// Lock serializing the calls to the listeners that are not thread-safe in the concurrent dispatch
+  std::recursive_mutex m_serialMutex;
+  /// State of the registered listeners, per incident type (protected by m_listenerMapMutex)
+  std::map<std::pair<std::string, IIncidentListener*>, std::shared_ptr<ListenerState>> m_listenerStates;
+
   /// timer & it's lock
   mutable ChronoEntity m_timer;
   mutable bool         m_timerLock = false;
@@ -12,6 +12,7 @@
 #include "Catalog.h"
 #include "Messages.h"
 #include "Node.h"
+#include "OptionsSnapshot.h"
 #include "PragmaOptions.h"
 #include "PropertyId.h"
 #include "PythonConfig.h"
@@ -34,6 +35,7 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace Gaudi {
@@ -49,9 +51,25 @@ public:
 private:
   using PropertyId  = Gaudi::Details::PropertyId;
   using StorageType = std::unordered_map<PropertyId, Gaudi::Details::WeakPropertyRef>;
+  using Snapshot    = Gaudi::Details::OptionsSnapshot;
 
   StorageType m_options;
 
+  /// Binary snapshots of options, in the order they were read.
+  /// Options explicitly set in m_options take precedence over the snapshots, and later snapshots take precedence
+  /// over earlier ones.
+  std::vector<std::unique_ptr<Snapshot>> m_snapshots;
+  /// Kind of the properties bound so far, recorded only if a binary dump is requested.
+  std::unordered_map<std::string, Snapshot::Kind> m_boundKinds;
+
+  /// Look for a key in the binary snapshots, returning the snapshot and the index in it (or nullptr).
+  std::pair<Snapshot*, std::size_t> findInSnapshots( std::string_view key ) const {
+    for ( auto snapshot = m_snapshots.rbegin(); snapshot != m_snapshots.rend(); ++snapshot ) {
+      if ( auto idx = ( *snapshot )->find( key ); idx != Snapshot::npos ) return { snapshot->get(), idx };
+    }
+    return { nullptr, Snapshot::npos };
+  }
+
   mutable std::map<std::string, std::unique_ptr<Gaudi::Details::PropertyBase>> m_old_iface_compat;
   mutable std::map<std::string, PropertiesT>                                   m_old_iface_compat_2;
 
@@ -60,29 +78,30 @@ protected:
   void        set( const std::string& key, const std::string& value ) override { m_options[key] = value; }
   std::string get( const std::string& key, const std::string& default_ = {} ) const override {
     auto item = m_options.find( key );
+    if ( item != m_options.end() && ( item->second.isSet() || item->second.isBound() ) ) {
+      return std::string{ item->second };
+    }
+    if ( auto [snapshot, idx] = findInSnapshots( key ); snapshot ) return std::string{ snapshot->value( idx ) };
     return item != m_options.end() ? std::string{ item->second } : default_;
   }
   std::string pop( const std::string& key, const std::string& default_ = {} ) override {
-    std::string result = default_;
+    std::string result = get( key, default_ );
 
     auto item = m_options.find( key );
-    if ( item != m_options.end() ) {
-      result = std::move( item->second );
-      m_options.erase( item );
+    if ( item != m_options.end() ) m_options.erase( item );
+    for ( auto& snapshot : m_snapshots ) {
+      if ( auto idx = snapshot->find( key ); idx != Snapshot::npos ) snapshot->erase( idx );
     }
     return result;
   }
-  bool has( const std::string& key ) const override { return m_options.find( key ) != m_options.end(); }
-  std::vector<std::tuple<std::string, std::string>> items() const override {
-    std::vector<std::tuple<std::string, std::string>> v;
-    v.reserve( m_options.size() );
-    std::for_each( begin( m_options ), end( m_options ), [&v]( const auto& item ) { v.emplace_back( item ); } );
-    std::sort( begin( v ), end( v ) );
-    return v;
+  bool has( const std::string& key ) const override {
+    return m_options.find( key ) != m_options.end() || findInSnapshots( key ).first;
   }
+  std::vector<std::tuple<std::string, std::string>> items() const override;
+
   bool isSet( const std::string& key ) const override {
     auto item = m_options.find( key );
-    return item != m_options.end() && item->second.isSet();
+    return ( item != m_options.end() && item->second.isSet() ) || findInSnapshots( key ).first;
   }
 
   void bind( const std::string& prefix, Gaudi::Details::PropertyBase* property ) override;
@@ -112,12 +131,20 @@ private:
   /// dump properties catalog to file
   void dump( const std::string& file, const Gaudi::Parsers::Catalog& catalog ) const;
   void dump( const std::string& file ) const;
+  /// dump the current options as a binary snapshot
+  void dumpSnapshot( const std::string& file ) const;
+
+  /// map a binary snapshot of options and add it to the known options
+  StatusCode readSnapshot( const std::string& file );
 
 private:
   Gaudi::Property<std::string> m_source_type{ this, "TYPE" };
   Gaudi::Property<std::string> m_source_path{ this, "PATH" };
   Gaudi::Property<std::string> m_dir_search_path{ this, "SEARCHPATH" };
   Gaudi::Property<std::string> m_dump{ this, "DUMPFILE" };
+  Gaudi::Property<std::string> m_binaryDump{
+      this, "BinaryDumpFile", "",
+      "Write the options at start in a binary snapshot file that can be used as options file (extension .gopts)" };
   Gaudi::Property<std::string> m_pythonAction{ this, "PYTHONACTION" };
   Gaudi::Property<std::string> m_pythonParams{ this, "PYTHONPARAMS" };
 
@@ -172,6 +199,13 @@ StatusCode JobOptionsSvc::stop() {
     for ( const auto& p : m_options ) {
       if ( !p.second.isBound() ) unused.emplace_back( p.first );
     }
+    for ( const auto& snapshot : m_snapshots ) {
+      for ( std::size_t idx = 0; idx < snapshot->size(); ++idx ) {
+        if ( snapshot->erased( idx ) ) continue;
+        const auto key = snapshot->key( idx );
+        if ( m_options.find( key ) == m_options.end() ) unused.emplace_back( key );
+      }
+    }
 
     if ( !unused.empty() ) {
       std::sort( unused.begin(), unused.end() );
@@ -189,9 +223,31 @@ StatusCode JobOptionsSvc::stop() {
 
 StatusCode JobOptionsSvc::start() {
   if ( !m_dump.empty() ) { dump( m_dump ); }
+  if ( !m_binaryDump.empty() ) { dumpSnapshot( m_binaryDump ); }
   return StatusCode::SUCCESS;
 }
 
+std::vector<std::tuple<std::string, std::string>> JobOptionsSvc::items() const {
+  std::vector<std::tuple<std::string, std::string>> v;
+  v.reserve( m_options.size() );
+  std::for_each( begin( m_options ), end( m_options ), [&v]( const auto& item ) { v.emplace_back( item ); } );
+  if ( !m_snapshots.empty() ) {
+    // options from snapshots that were not bound or overridden, without duplicates across snapshots
+    std::unordered_set<std::string_view> seen;
+    for ( auto snapshot = m_snapshots.rbegin(); snapshot != m_snapshots.rend(); ++snapshot ) {
+      for ( std::size_t idx = 0; idx < ( *snapshot )->size(); ++idx ) {
+        if ( ( *snapshot )->erased( idx ) ) continue;
+        const auto key = ( *snapshot )->key( idx );
+        if ( seen.insert( key ).second && m_options.find( key ) == m_options.end() ) {
+          v.emplace_back( key, ( *snapshot )->value( idx ) );
+        }
+      }
+    }
+  }
+  std::sort( begin( v ), end( v ) );
+  return v;
+}
+
 void JobOptionsSvc::dump( const std::string& file, const gp::Catalog& catalog ) const {
   std::ofstream out( file, std::ios_base::out | std::ios_base::trunc );
   if ( !out ) {
@@ -217,6 +273,41 @@ void JobOptionsSvc::dump( const std::string& file ) const {
   }
 }
 
+void JobOptionsSvc::dumpSnapshot( const std::string& file ) const {
+  std::vector<Snapshot::Item> snapshotItems;
+  for ( auto& [key, value] : items() ) {
+    auto kind = m_boundKinds.find( key );
+    snapshotItems.push_back(
+        { std::move( key ), std::move( value ), kind != m_boundKinds.end() ? kind->second : Snapshot::Kind::Repr } );
+  }
+  try {
+    Snapshot::write( file, snapshotItems );
+    info() << "Properties are dumped into binary snapshot \"" + file + "\"" << endmsg;
+  } catch ( const GaudiException& err ) {
+    error() << "Unable to write binary snapshot \"" + file + "\": " << err.message() << endmsg;
+  }
+}
+
+StatusCode JobOptionsSvc::readSnapshot( const std::string& file ) {
+  try {
+    auto snapshot = std::make_unique<Snapshot>( file );
+    // options already known are overridden by the snapshot
+    for ( auto& [key, value] : m_options ) {
+      if ( auto idx = snapshot->find( key.str() ); idx != Snapshot::npos ) {
+        value = std::string{ snapshot->value( idx ) };
+        snapshot->erase( idx );
+      }
+    }
+    info() << "Job options successfully mapped from binary snapshot " << file << " (" << snapshot->size()
+           << " entries)" << endmsg;
+    m_snapshots.push_back( std::move( snapshot ) );
+  } catch ( const GaudiException& err ) {
+    fatal() << "Job options errors: " << err.message() << endmsg;
+    return StatusCode::FAILURE;
+  }
+  return StatusCode::SUCCESS;
+}
+
 void JobOptionsSvc::fillServiceCatalog( const gp::Catalog& catalog ) {
   for ( const auto& client : catalog ) {
     for ( const auto& current : client.second ) {
@@ -240,6 +331,10 @@ StatusCode JobOptionsSvc::readOptions( std::string_view file, std::string_view p
     for ( auto item = opts.begin(); item != opts.end(); ++item ) { set( item.key(), item.value().get<std::string>() ); }
     return StatusCode::SUCCESS;
   }
+  if ( file.ends_with( ".gopts" ) ) {
+    auto resolved = System::PathResolver::find_file_from_list( std::string( file ), search_path );
+    return readSnapshot( resolved.empty() ? std::string( file ) : resolved );
+  }
 
   gp::Messages      messages( msgStream() );
   gp::Catalog       catalog;
@@ -264,6 +359,23 @@ StatusCode JobOptionsSvc::readOptions( std::string_view file, std::string_view p
 void JobOptionsSvc::bind( const std::string& prefix, Gaudi::Details::PropertyBase* property ) {
   const std::string key = prefix + '.' + property->name();
 
+  if ( !m_binaryDump.empty() ) m_boundKinds[key] = Snapshot::kindOf( *property->type_info() );
+
+  if ( auto [snapshot, idx] = findInSnapshots( key ); snapshot ) {
+    // values from snapshots are used only if not overridden
+    if ( auto item = m_options.find( key ); item == m_options.end() || !item->second.isSet() ) {
+      m_options[key] = *property; // nothing to parse, the option is not set in the catalog
+      bool adopted   = false;
+      try {
+        adopted = snapshot->adopt( idx, *property );
+      } catch ( const std::exception& ) {
+        // fall back on the string representation
+      }
+      if ( !adopted ) property->fromString( std::string{ snapshot->value( idx ) } ).ignore();
+      return;
+    }
+  }
+
   std::tuple<bool, std::string_view> defaultValue{ false, "" };
   if ( !has( key ) && !m_globalDefaults.empty() ) { // look for a global default only if it was not set
     std::smatch match;
@@ -283,7 +395,21 @@ void JobOptionsSvc::broadcast( const std::regex& filter, const std::string& valu
   for ( auto& p : m_options ) {
     if ( !defaults_only || !p.second.isSet() ) {
       const auto s = p.first.str();
+      // options bound to values from a snapshot count as set
+      if ( defaults_only && findInSnapshots( s ).first ) continue;
       if ( regex_match( s, match, filter ) ) { p.second = value; }
     }
   }
+  if ( !defaults_only ) {
+    // options only known to the snapshots are set values, so they are overridden only on request
+    std::vector<std::string> matching;
+    for ( const auto& snapshot : m_snapshots ) {
+      for ( std::size_t idx = 0; idx < snapshot->size(); ++idx ) {
+        if ( snapshot->erased( idx ) ) continue;
+        std::string s{ snapshot->key( idx ) };
+        if ( m_options.find( s ) == m_options.end() && regex_match( s, match, filter ) ) matching.push_back( s );
+      }
+    }
+    for ( const auto& s : matching ) set( s, value );
+  }
 }
@@ -0,0 +1,390 @@
+/***********************************************************************************\
+* (c) Copyright 1998-2026 CERN for the benefit of the LHCb and ATLAS collaborations *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include "OptionsSnapshot.h"
+#include <Gaudi/Parsers/CommonParsers.h>
+#include <Gaudi/Property.h>
+#include <GaudiKernel/GaudiException.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <numeric>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+using Gaudi::Details::OptionsSnapshot;
+
+struct OptionsSnapshot::Header {
+  char          magic[8];
+  std::uint32_t version;
+  std::uint32_t nEntries;
+  std::uint32_t nBuckets;
+  std::uint32_t nSlots;
+  std::uint64_t entriesOffset;
+  std::uint64_t seedsOffset;
+  std::uint64_t slotsOffset;
+  std::uint64_t blobOffset;
+  std::uint64_t blobSize;
+};
+
+struct OptionsSnapshot::Entry {
+  std::uint32_t keyOffset;
+  std::uint32_t keyLength;
+  std::uint32_t valueOffset;
+  std::uint32_t valueLength;
+  std::uint32_t payloadOffset;
+  std::uint32_t payloadLength;
+  Kind          kind;
+  std::uint32_t reserved;
+};
+
+namespace {
+  constexpr char          s_magic[8]  = { 'G', 'A', 'U', 'D', 'I', 'O', 'P', 'T' };
+  constexpr std::uint32_t s_version   = 1;
+  constexpr std::uint32_t s_emptySlot = 0xFFFFFFFF;
+  /// maximum number of displacement seeds tried for a bucket before giving up
+  constexpr std::uint32_t s_maxSeed = 1u << 20;
+
+  /// FNV-1a, used because the hash must be stable across processes and platforms
+  std::uint64_t hashKey( std::string_view key ) {
+    std::uint64_t h = 14695981039346656037ull;
+    for ( unsigned char c : key ) {
+      h ^= c;
+      h *= 1099511628211ull;
+    }
+    return h;
+  }
+  /// derive a new hash value from the key hash and the bucket displacement seed (splitmix64 finalizer)
+  std::uint64_t displace( std::uint64_t h, std::uint32_t seed ) {
+    h += seed * 0x9E3779B97F4A7C15ull;
+    h = ( h ^ ( h >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+    h = ( h ^ ( h >> 27 ) ) * 0x94D049BB133111EBull;
+    return h ^ ( h >> 31 );
+  }
+
+  template <typename T>
+  void append( std::string& out, const T& value ) {
+    out.append( reinterpret_cast<const char*>( &value ), sizeof( T ) );
+  }
+  template <typename T>
+  T extract( std::string_view& in ) {
+    T value{};
+    if ( in.size() < sizeof( T ) ) throw GaudiException( "truncated payload", "OptionsSnapshot", StatusCode::FAILURE );
+    std::memcpy( &value, in.data(), sizeof( T ) );
+    in.remove_prefix( sizeof( T ) );
+    return value;
+  }
+
+  /// Convert the string representation of a value to the binary payload for the given kind.
+  /// Return false if the string cannot be parsed.
+  bool encode( OptionsSnapshot::Kind kind, const std::string& value, std::string& out ) {
+    using Kind = OptionsSnapshot::Kind;
+    using Gaudi::Parsers::parse;
+    switch ( kind ) {
+    case Kind::Bool: {
+      bool v{};
+      if ( !parse( v, value ) ) return false;
+      append( out, static_cast<std::uint8_t>( v ) );
+      return true;
+    }
+    case Kind::Int: {
+      long long v{};
+      if ( !parse( v, value ) ) return false;
+      append( out, static_cast<std::int64_t>( v ) );
+      return true;
+    }
+    case Kind::UInt: {
+      unsigned long long v{};
+      if ( !parse( v, value ) ) return false;
+      append( out, static_cast<std::uint64_t>( v ) );
+      return true;
+    }
+    case Kind::Float: {
+      float v{};
+      if ( !parse( v, value ) ) return false;
+      append( out, v );
+      return true;
+    }
+    case Kind::Double: {
+      double v{};
+      if ( !parse( v, value ) ) return false;
+      append( out, v );
+      return true;
+    }
+    case Kind::Text: {
+      std::string v;
+      if ( !parse( v, value ) ) return false;
+      out += v;
+      return true;
+    }
+    case Kind::TextList: {
+      std::vector<std::string> v;
+      if ( !parse( v, value ) ) return false;
+      append( out, static_cast<std::uint32_t>( v.size() ) );
+      for ( const auto& s : v ) {
+        append( out, static_cast<std::uint32_t>( s.size() ) );
+        out += s;
+      }
+      return true;
+    }
+    default:
+      return false;
+    }
+  }
+
+  /// Assign a value to a property if it is a plain Gaudi::Property of the requested type.
+  template <typename T, typename V>
+  bool assignTo( Gaudi::Details::PropertyBase& property, V&& value ) {
+    auto p = dynamic_cast<Gaudi::Property<T>*>( &property );
+    if ( !p ) return false;
+    *p = static_cast<T>( std::forward<V>( value ) );
+    return true;
+  }
+
+  /// Assign an integral value to an integral property of one of the types in the list, checking the range.
+  template <typename... Ts, typename V>
+  bool assignIntegral( Gaudi::Details::PropertyBase& property, V value ) {
+    const auto& type = *property.type_info();
+    return ( ( type == typeid( Ts ) && std::in_range<Ts>( value ) && assignTo<Ts>( property, value ) ) || ... );
+  }
+} // namespace
+
+OptionsSnapshot::OptionsSnapshot( const std::string& path ) {
+  int fd = ::open( path.c_str(), O_RDONLY );
+  if ( fd < 0 ) {
+    throw GaudiException( "cannot open " + path + ": " + std::strerror( errno ), "OptionsSnapshot",
+                          StatusCode::FAILURE );
+  }
+  struct stat st {};
+  if ( ::fstat( fd, &st ) != 0 || static_cast<std::size_t>( st.st_size ) < sizeof( Header ) ) {
+    ::close( fd );
+    throw GaudiException( "invalid options snapshot " + path, "OptionsSnapshot", StatusCode::FAILURE );
+  }
+  m_size    = st.st_size;
+  void* ptr = ::mmap( nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+  ::close( fd );
+  if ( ptr == MAP_FAILED ) {
+    throw GaudiException( "cannot map " + path + ": " + std::strerror( errno ), "OptionsSnapshot",
+                          StatusCode::FAILURE );
+  }
+  m_data   = static_cast<const char*>( ptr );
+  m_header = reinterpret_cast<const Header*>( m_data );
+
+  // validate the layout before trusting any offset
+  auto fits = [this]( std::uint64_t offset, std::uint64_t length ) {
+    return offset <= m_size && length <= m_size - offset;
+  };
+  const auto& h = *m_header;
+  if ( std::memcmp( h.magic, s_magic, sizeof( s_magic ) ) != 0 || h.version != s_version ||
+       !fits( h.entriesOffset, std::uint64_t{ h.nEntries } * sizeof( Entry ) ) ||
+       !fits( h.seedsOffset, std::uint64_t{ h.nBuckets } * sizeof( std::uint32_t ) ) ||
+       !fits( h.slotsOffset, std::uint64_t{ h.nSlots } * sizeof( std::uint32_t ) ) ||
+       !fits( h.blobOffset, h.blobSize ) || ( h.nEntries && ( !h.nBuckets || !h.nSlots ) ) ) {
+    ::munmap( ptr, m_size );
+    throw GaudiException( "invalid options snapshot " + path, "OptionsSnapshot", StatusCode::FAILURE );
+  }
+  m_nEntries = h.nEntries;
+  m_erased.resize( m_nEntries, false );
+}
+
+OptionsSnapshot::~OptionsSnapshot() {
+  if ( m_data ) ::munmap( const_cast<char*>( m_data ), m_size );
+}
+
+const OptionsSnapshot::Entry& OptionsSnapshot::entry( std::size_t idx ) const {
+  return reinterpret_cast<const Entry*>( m_data + m_header->entriesOffset )[idx];
+}
+
+std::string_view OptionsSnapshot::blob( std::uint32_t offset, std::uint32_t length ) const {
+  if ( std::uint64_t{ offset } + length > m_header->blobSize ) {
+    throw GaudiException( "corrupted options snapshot", "OptionsSnapshot", StatusCode::FAILURE );
+  }
+  return { m_data + m_header->blobOffset + offset, length };
+}
+
+std::size_t OptionsSnapshot::find( std::string_view key ) const {
+  if ( !m_nEntries ) return npos;
+  const auto  h     = hashKey( key );
+  const auto* seeds = reinterpret_cast<const std::uint32_t*>( m_data + m_header->seedsOffset );
+  const auto* slots = reinterpret_cast<const std::uint32_t*>( m_data + m_header->slotsOffset );
+  const auto  idx   = slots[displace( h, seeds[h % m_header->nBuckets] ) % m_header->nSlots];
+  if ( idx >= m_nEntries || m_erased[idx] || this->key( idx ) != key ) return npos;
+  return idx;
+}
+
+std::string_view OptionsSnapshot::key( std::size_t idx ) const {
+  const auto& e = entry( idx );
+  return blob( e.keyOffset, e.keyLength );
+}
+
+std::string_view OptionsSnapshot::value( std::size_t idx ) const {
+  const auto& e = entry( idx );
+  return blob( e.valueOffset, e.valueLength );
+}
+
+std::string_view OptionsSnapshot::payload( std::size_t idx ) const {
+  const auto& e = entry( idx );
+  return blob( e.payloadOffset, e.payloadLength );
+}
+
+OptionsSnapshot::Kind OptionsSnapshot::kind( std::size_t idx ) const { return entry( idx ).kind; }
+
+bool OptionsSnapshot::adopt( std::size_t idx, Gaudi::Details::PropertyBase& property ) const {
+  auto data = payload( idx );
+  switch ( kind( idx ) ) {
+  case Kind::Bool:
+    return assignTo<bool>( property, extract<std::uint8_t>( data ) != 0 );
+  case Kind::Int:
+    return assignIntegral<int, long, long long, short, signed char>( property, extract<std::int64_t>( data ) );
+  case Kind::UInt:
+    return assignIntegral<unsigned int, unsigned long, unsigned long long, unsigned short, unsigned char>(
+        property, extract<std::uint64_t>( data ) );
+  case Kind::Float:
+    return assignTo<float>( property, extract<float>( data ) );
+  case Kind::Double:
+    return assignTo<double>( property, extract<double>( data ) );
+  case Kind::Text:
+    return assignTo<std::string>( property, std::string{ data } );
+  case Kind::TextList: {
+    std::vector<std::string> v( extract<std::uint32_t>( data ) );
+    for ( auto& s : v ) {
+      const auto length = extract<std::uint32_t>( data );
+      if ( data.size() < length ) return false;
+      s.assign( data.substr( 0, length ) );
+      data.remove_prefix( length );
+    }
+    return assignTo<std::vector<std::string>>( property, std::move( v ) );
+  }
+  default:
+    return false;
+  }
+}
+
+OptionsSnapshot::Kind OptionsSnapshot::kindOf( const std::type_info& type ) {
+  if ( type == typeid( bool ) ) return Kind::Bool;
+  if ( type == typeid( int ) || type == typeid( long ) || type == typeid( long long ) || type == typeid( short ) ||
+       type == typeid( signed char ) )
+    return Kind::Int;
+  if ( type == typeid( unsigned int ) || type == typeid( unsigned long ) || type == typeid( unsigned long long ) ||
+       type == typeid( unsigned short ) || type == typeid( unsigned char ) )
+    return Kind::UInt;
+  if ( type == typeid( float ) ) return Kind::Float;
+  if ( type == typeid( double ) ) return Kind::Double;
+  if ( type == typeid( std::string ) ) return Kind::Text;
+  if ( type == typeid( std::vector<std::string> ) ) return Kind::TextList;
+  return Kind::Repr;
+}
+
+void OptionsSnapshot::write( const std::string& path, const std::vector<Item>& items ) {
+  if ( items.size() >= s_emptySlot ) {
+    throw GaudiException( "too many options for a snapshot", "OptionsSnapshot", StatusCode::FAILURE );
+  }
+  const auto nEntries = static_cast<std::uint32_t>( items.size() );
+
+  // fill the entries and the string blob
+  std::vector<Entry> entries( nEntries );
+  std::string        blob;
+  auto               store = [&blob]( std::string_view s ) {
+    const auto offset = static_cast<std::uint32_t>( blob.size() );
+    blob.append( s );
+    return offset;
+  };
+  for ( std::uint32_t i = 0; i < nEntries; ++i ) {
+    const auto& item = items[i];
+    auto&       e    = entries[i];
+    e.keyOffset      = store( item.key );
+    e.keyLength      = item.key.size();
+    e.valueOffset    = store( item.value );
+    e.valueLength    = item.value.size();
+    e.kind           = Kind::Repr;
+    e.payloadOffset  = blob.size();
+    e.payloadLength  = 0;
+    e.reserved       = 0;
+    if ( item.kind != Kind::Repr ) {
+      std::string data;
+      if ( encode( item.kind, item.value, data ) ) {
+        e.kind          = item.kind;
+        e.payloadOffset = store( data );
+        e.payloadLength = data.size();
+      }
+    }
+  }
+  if ( blob.size() >= s_emptySlot ) {
+    throw GaudiException( "options too large for a snapshot", "OptionsSnapshot", StatusCode::FAILURE );
+  }
+
+  // build the perfect hash: keys are distributed in buckets (about 4 keys per bucket) and, starting from the
+  // largest bucket, we look for a seed that places all the keys of the bucket in free slots
+  const std::uint32_t nBuckets = nEntries / 4 + 1;
+  const std::uint32_t nSlots   = nEntries + nEntries / 8 + 1;
+
+  std::vector<std::uint64_t>              hashes( nEntries );
+  std::vector<std::vector<std::uint32_t>> buckets( nBuckets );
+  for ( std::uint32_t i = 0; i < nEntries; ++i ) {
+    hashes[i] = hashKey( items[i].key );
+    buckets[hashes[i] % nBuckets].push_back( i );
+  }
+  std::vector<std::uint32_t> order( nBuckets );
+  std::iota( order.begin(), order.end(), 0 );
+  std::stable_sort( order.begin(), order.end(),
+                    [&buckets]( auto a, auto b ) { return buckets[a].size() > buckets[b].size(); } );
+
+  std::vector<std::uint32_t> seeds( nBuckets, 0 );
+  std::vector<std::uint32_t> slots( nSlots, s_emptySlot );
+  std::vector<std::uint32_t> candidate;
+  for ( auto b : order ) {
+    const auto& bucket = buckets[b];
+    if ( bucket.empty() ) break; // buckets are sorted by size
+    std::uint32_t seed = 1;
+    for ( ; seed < s_maxSeed; ++seed ) {
+      candidate.clear();
+      bool ok = true;
+      for ( auto i : bucket ) {
+        const auto slot = static_cast<std::uint32_t>( displace( hashes[i], seed ) % nSlots );
+        if ( slots[slot] != s_emptySlot || std::find( candidate.begin(), candidate.end(), slot ) != candidate.end() ) {
+          ok = false;
+          break;
+        }
+        candidate.push_back( slot );
+      }
+      if ( ok ) break;
+    }
+    if ( seed == s_maxSeed ) {
+      throw GaudiException( "cannot build the options index (duplicated keys?)", "OptionsSnapshot",
+                            StatusCode::FAILURE );
+    }
+    seeds[b] = seed;
+    for ( std::size_t k = 0; k < bucket.size(); ++k ) slots[candidate[k]] = bucket[k];
+  }
+
+  Header header{};
+  std::memcpy( header.magic, s_magic, sizeof( s_magic ) );
+  header.version       = s_version;
+  header.nEntries      = nEntries;
+  header.nBuckets      = nBuckets;
+  header.nSlots        = nSlots;
+  header.entriesOffset = sizeof( Header );
+  header.seedsOffset   = header.entriesOffset + nEntries * sizeof( Entry );
+  header.slotsOffset   = header.seedsOffset + nBuckets * sizeof( std::uint32_t );
+  header.blobOffset    = header.slotsOffset + nSlots * sizeof( std::uint32_t );
+  header.blobSize      = blob.size();
+
+  std::ofstream out( path, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary );
+  out.write( reinterpret_cast<const char*>( &header ), sizeof( Header ) );
+  out.write( reinterpret_cast<const char*>( entries.data() ), entries.size() * sizeof( Entry ) );
+  out.write( reinterpret_cast<const char*>( seeds.data() ), seeds.size() * sizeof( std::uint32_t ) );
+  out.write( reinterpret_cast<const char*>( slots.data() ), slots.size() * sizeof( std::uint32_t ) );
+  out.write( blob.data(), blob.size() );
+  if ( !out ) throw GaudiException( "cannot write " + path, "OptionsSnapshot", StatusCode::FAILURE );
+}
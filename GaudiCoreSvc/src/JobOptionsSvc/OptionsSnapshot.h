@@ -0,0 +1,102 @@
+/***********************************************************************************\
+* (c) Copyright 1998-2026 CERN for the benefit of the LHCb and ATLAS collaborations *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <vector>
+
+namespace Gaudi::Details {
+  class PropertyBase;
+
+  /** Read-only, memory mapped, binary snapshot of job options.
+   *
+   *  A snapshot is produced once (see JobOptionsSvc property `BinaryDumpFile`) from a fully configured job and
+   *  contains, for each option, the string representation of the value and, when the type of the bound property
+   *  is known, a pre-parsed copy of the value that can be assigned to a matching `Gaudi::Property` without going
+   *  through the string parsers.
+   *
+   *  Keys are indexed with a perfect hash (hash and displace), so that a lookup costs two hash evaluations
+   *  and one string comparison, without any allocation.
+   *
+   *  The file layout is (native byte order, all offsets relative to the beginning of the file):
+   *  - header (magic, version, counts and offsets of the sections)
+   *  - array of fixed size entries (key, value and payload locations in the string blob)
+   *  - array of per-bucket displacement seeds
+   *  - array of slots mapping the perfect hash value to the entry index
+   *  - string blob
+   */
+  class OptionsSnapshot final {
+  public:
+    /// Kind of pre-parsed payload stored with an option.
+    enum class Kind : std::uint32_t { Repr = 0, Bool, Int, UInt, Float, Double, Text, TextList };
+
+    /// Value returned by find() when the key is not in the snapshot.
+    static constexpr std::size_t npos = static_cast<std::size_t>( -1 );
+
+    /// Information needed to write an entry of the snapshot.
+    struct Item {
+      std::string key;
+      std::string value;
+      Kind        kind = Kind::Repr;
+    };
+
+    /// Map the snapshot file at the given path (throws GaudiException on failure).
+    explicit OptionsSnapshot( const std::string& path );
+    OptionsSnapshot( const OptionsSnapshot& )            = delete;
+    OptionsSnapshot& operator=( const OptionsSnapshot& ) = delete;
+    ~OptionsSnapshot();
+
+    /// Number of entries in the file (including erased ones).
+    std::size_t size() const { return m_nEntries; }
+
+    /// Index of the entry for the given key, or npos if not present (or erased).
+    std::size_t find( std::string_view key ) const;
+    /// Mark an entry as removed (the file is not modified).
+    void erase( std::size_t idx ) { m_erased[idx] = true; }
+    /// Tell if an entry was removed with erase().
+    bool erased( std::size_t idx ) const { return m_erased[idx]; }
+
+    std::string_view key( std::size_t idx ) const;
+    /// String representation of the value, as understood by `PropertyBase::fromString`.
+    std::string_view value( std::size_t idx ) const;
+    Kind             kind( std::size_t idx ) const;
+
+    /// Assign the pre-parsed value of an entry to a property.
+    /// Return false if the payload cannot be used directly with the property instance, in which case the
+    /// string representation must be used.
+    bool adopt( std::size_t idx, PropertyBase& property ) const;
+
+    /// Kind of payload that can be used for properties of the given type.
+    static Kind kindOf( const std::type_info& type );
+
+    /// Write a snapshot file with the given options (throws GaudiException on failure).
+    /// Values that cannot be parsed according to the requested kind are stored as plain string representations.
+    static void write( const std::string& path, const std::vector<Item>& items );
+
+  private:
+    struct Header;
+    struct Entry;
+
+    const Entry&     entry( std::size_t idx ) const;
+    std::string_view blob( std::uint32_t offset, std::uint32_t length ) const;
+    std::string_view payload( std::size_t idx ) const;
+
+    const char*       m_data     = nullptr;
+    std::size_t       m_size     = 0;
+    std::size_t       m_nEntries = 0;
+    const Header*     m_header   = nullptr;
+    std::vector<bool> m_erased;
+  };
+} // namespace Gaudi::Details
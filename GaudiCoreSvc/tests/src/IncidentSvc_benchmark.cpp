@@ -0,0 +1,109 @@
+/***********************************************************************************\
+* (c) Copyright 1998-2026 CERN for the benefit of the LHCb and ATLAS collaborations *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "COPYING".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+// Measure the contention of IncidentSvc when incidents are fired from many threads, with the default
+// (serialized) dispatch and with the concurrent dispatch.
+//
+// usage: IncidentSvc_benchmark [n_threads [n_incidents_per_thread [n_listeners [thread_safe_fraction]]]]
+#include <Gaudi/Interfaces/IOptionsSvc.h>
+#include <Gaudi/PluginService.h>
+#include <GaudiKernel/Bootstrap.h>
+#include <GaudiKernel/IAppMgrUI.h>
+#include <GaudiKernel/IIncidentListener.h>
+#include <GaudiKernel/IIncidentSvc.h>
+#include <GaudiKernel/IProperty.h>
+#include <GaudiKernel/ISvcLocator.h>
+#include <GaudiKernel/Incident.h>
+#include <GaudiKernel/SmartIF.h>
+#include <GaudiKernel/implements.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+  /// Listener doing a fixed amount of work per incident.
+  struct BusyListener : implements<IIncidentListener> {
+    BusyListener( bool threadSafe ) : m_threadSafe{ threadSafe } {}
+
+    void handle( const Incident& ) override {
+      // some work that cannot be optimized away
+      volatile double x = 1;
+      for ( int i = 0; i < 200; ++i ) x = x * 1.000001 + 0.5;
+      ++calls;
+    }
+    bool isThreadSafe() const override { return m_threadSafe; }
+
+    std::atomic<long> calls{ 0 };
+
+  private:
+    bool m_threadSafe;
+  };
+
+  void run( const std::string& svcName, bool concurrent, int nThreads, int nIncidents, int nListeners,
+            double threadSafeFraction ) {
+    auto svcLoc = Gaudi::svcLocator();
+    svcLoc->getOptsSvc().set( svcName + ".ConcurrentDispatch", concurrent ? "True" : "False" );
+    auto incSvc = svcLoc->service<IIncidentSvc>( "IncidentSvc/" + svcName );
+
+    std::vector<std::unique_ptr<BusyListener>> listeners;
+    for ( int i = 0; i < nListeners; ++i ) {
+      listeners.push_back( std::make_unique<BusyListener>( i < nListeners * threadSafeFraction ) );
+      incSvc->addListener( listeners.back().get(), IncidentType::BeginEvent );
+    }
+
+    const auto               start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for ( int t = 0; t < nThreads; ++t ) {
+      threads.emplace_back( [&]() {
+        for ( int i = 0; i < nIncidents; ++i ) {
+          incSvc->fireIncident( Incident( "benchmark", IncidentType::BeginEvent ) );
+        }
+      } );
+    }
+    for ( auto& t : threads ) t.join();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    long calls = 0;
+    for ( auto& l : listeners ) {
+      calls += l->calls;
+      incSvc->removeListener( l.get() );
+    }
+    std::cout << svcName << ": " << nThreads * nIncidents << " incidents (" << calls << " calls) in " << elapsed.count()
+              << " s, " << nThreads * nIncidents / elapsed.count() << " incidents/s" << std::endl;
+  }
+} // namespace
+
+int main( int argc, char* argv[] ) {
+  const int    nThreads           = argc > 1 ? std::atoi( argv[1] ) : std::thread::hardware_concurrency();
+  const int    nIncidents         = argc > 2 ? std::atoi( argv[2] ) : 10000;
+  const int    nListeners         = argc > 3 ? std::atoi( argv[3] ) : 10;
+  const double threadSafeFraction = argc > 4 ? std::atof( argv[4] ) : 1.0;
+
+  Gaudi::PluginService::v2::Details::Registry::instance().loadPluginLibrary( "libGaudiCoreSvc.so" );
+  auto               app = Gaudi::createApplicationMgr();
+  SmartIF<IProperty> appProp{ app };
+  appProp->setProperty( "JobOptionsType", "NONE" ).ignore();
+  appProp->setPropertyRepr( "AppName", "''" ).ignore();
+  appProp->setProperty( "OutputLevel", 6 ).ignore();
+  if ( !app->configure() ) return 1;
+
+  std::cout << nThreads << " threads, " << nListeners << " listeners (" << threadSafeFraction * 100
+            << "% thread-safe)" << std::endl;
+  run( "SerialIncidentSvc", false, nThreads, nIncidents, nListeners, threadSafeFraction );
+  run( "ConcurrentIncidentSvc", true, nThreads, nIncidents, nListeners, threadSafeFraction );
+
+  return app->terminate().isSuccess() ? 0 : 1;
+}
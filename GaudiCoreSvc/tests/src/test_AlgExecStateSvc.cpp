@@ -0,0 +1,71 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE test_AlgExecStateSvc
+#include <boost/test/unit_test.hpp>
+
+#include "test_JOS/fixture.h"
+
+#include <GaudiKernel/EventContext.h>
+#include <GaudiKernel/GaudiException.h>
+#include <GaudiKernel/IAlgExecStateSvc.h>
+#include <GaudiKernel/ISvcLocator.h>
+
+namespace {
+  /// more sub-slots than in the first chunks of states (16, then 32)
+  constexpr std::size_t s_nSubSlots = 100;
+
+  EventContext subSlotContext( std::size_t subSlot ) { return EventContext{ 0, 0, subSlot }; }
+} // namespace
+
+BOOST_TEST_GLOBAL_FIXTURE( Fixture );
+
+BOOST_AUTO_TEST_CASE( sub_slots ) {
+  auto svc = Gaudi::svcLocator()->service<IAlgExecStateSvc>( "AlgExecStateSvc/SubSlots" );
+  BOOST_REQUIRE( svc );
+  svc->addAlg( "A" );
+  svc->addAlg( "B" );
+
+  for ( std::size_t i = 0; i < s_nSubSlots; ++i ) {
+    const auto ctx = subSlotContext( i );
+    if ( i % 2 ) svc->allocateSubSlot( ctx ); // the others are allocated on first use
+    svc->algExecState( "A", ctx ).setState( AlgExecStateRef::State::Done, StatusCode::SUCCESS );
+    svc->algExecState( "B", ctx ).setFilterPassed( i % 3 != 0 );
+  }
+  // each sub-slot has its own states
+  for ( std::size_t i = 0; i < s_nSubSlots; ++i ) {
+    const auto  ctx  = subSlotContext( i );
+    const auto& csvc = *svc;
+    BOOST_CHECK( csvc.algExecState( "A", ctx ).state() == AlgExecStateRef::State::Done );
+    BOOST_CHECK( csvc.algExecState( "A", ctx ).filterPassed() );
+    BOOST_CHECK( csvc.algExecState( "B", ctx ).state() == AlgExecStateRef::State::None );
+    BOOST_CHECK_EQUAL( csvc.algExecState( "B", ctx ).filterPassed(), i % 3 != 0 );
+  }
+  // the states of the slot are not affected
+  const EventContext slotCtx{ 0, 0 };
+  BOOST_CHECK( svc->algExecState( "A", slotCtx ).state() == AlgExecStateRef::State::None );
+
+  // the reset of the slot resets all the sub-slots used
+  svc->reset( slotCtx );
+  for ( std::size_t i = 0; i < s_nSubSlots; ++i ) {
+    const auto  ctx  = subSlotContext( i );
+    const auto& csvc = *svc;
+    BOOST_CHECK( csvc.algExecState( "A", ctx ).state() == AlgExecStateRef::State::None );
+    BOOST_CHECK( csvc.algExecState( "B", ctx ).filterPassed() );
+  }
+
+  // an algorithm added after the allocation of the sub-slots can be used in the slot, not in the sub-slots
+  svc->addAlg( "C" );
+  svc->algExecState( "C", slotCtx ).setState( AlgExecStateRef::State::Done );
+  const auto ctx = subSlotContext( 0 );
+  BOOST_CHECK_THROW( svc->algExecState( "C", ctx ).setState( AlgExecStateRef::State::Done ), GaudiException );
+  BOOST_CHECK_THROW( svc->allocateSubSlot( subSlotContext( 10 * s_nSubSlots ) ), GaudiException );
+}
@@ -0,0 +1,205 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE test_IncidentSvc
+#include <boost/test/unit_test.hpp>
+
+#include "test_JOS/fixture.h"
+
+#include <Gaudi/Interfaces/IOptionsSvc.h>
+#include <GaudiKernel/IIncidentListener.h>
+#include <GaudiKernel/IIncidentSvc.h>
+#include <GaudiKernel/ISvcLocator.h>
+#include <GaudiKernel/Incident.h>
+#include <GaudiKernel/implements.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+  /// Listener counting its calls and checking whether they overlap.
+  struct CountingListener : implements<IIncidentListener> {
+    CountingListener( bool threadSafe = false, std::function<void()> action = {} )
+        : m_threadSafe{ threadSafe }, m_action{ std::move( action ) } {}
+
+    void handle( const Incident& ) override {
+      if ( ++inside > 1 ) overlapping = true;
+      if ( m_action ) m_action();
+      ++calls;
+      --inside;
+    }
+    bool isThreadSafe() const override { return m_threadSafe; }
+
+    std::atomic<int>  calls{ 0 };
+    std::atomic<int>  inside{ 0 };
+    std::atomic<bool> overlapping{ false };
+
+  private:
+    bool                  m_threadSafe;
+    std::function<void()> m_action;
+  };
+
+  /// Get a new IncidentSvc instance with the concurrent dispatch enabled.
+  SmartIF<IIncidentSvc> concurrentIncidentSvc( const std::string& name ) {
+    auto svcLoc = Gaudi::svcLocator();
+    svcLoc->getOptsSvc().set( name + ".ConcurrentDispatch", "True" );
+    return svcLoc->service<IIncidentSvc>( "IncidentSvc/" + name );
+  }
+
+  void fireFromThreads( IIncidentSvc& incSvc, int nThreads, int nIncidents ) {
+    std::vector<std::thread> threads;
+    for ( int t = 0; t < nThreads; ++t ) {
+      threads.emplace_back( [&]() {
+        for ( int i = 0; i < nIncidents; ++i ) incSvc.fireIncident( Incident( "test", IncidentType::BeginEvent ) );
+      } );
+    }
+    for ( auto& t : threads ) t.join();
+  }
+
+  void spin() {
+    volatile double x = 1;
+    for ( int i = 0; i < 1000; ++i ) x = x * 1.000001 + 0.5;
+  }
+} // namespace
+
+BOOST_TEST_GLOBAL_FIXTURE( Fixture );
+
+BOOST_AUTO_TEST_CASE( concurrent_dispatch ) {
+  auto incSvc = concurrentIncidentSvc( "Dispatch" );
+  BOOST_REQUIRE( incSvc );
+
+  CountingListener safe( true, spin ), unsafe( false, spin ), all( false );
+  incSvc->addListener( &safe, IncidentType::BeginEvent );
+  incSvc->addListener( &unsafe, IncidentType::BeginEvent );
+  incSvc->addListener( &all );
+
+  fireFromThreads( *incSvc, 8, 1000 );
+
+  BOOST_CHECK_EQUAL( safe.calls, 8000 );
+  BOOST_CHECK_EQUAL( unsafe.calls, 8000 );
+  BOOST_CHECK_EQUAL( all.calls, 8000 );
+  // the calls to a listener that is not thread-safe are serialized
+  BOOST_CHECK( !unsafe.overlapping );
+  BOOST_CHECK( !all.overlapping );
+
+  incSvc->removeListener( &safe );
+  incSvc->removeListener( &unsafe );
+  incSvc->removeListener( &all );
+  incSvc->fireIncident( Incident( "test", IncidentType::BeginEvent ) );
+  BOOST_CHECK_EQUAL( safe.calls + unsafe.calls + all.calls, 3 * 8000 );
+}
+
+BOOST_AUTO_TEST_CASE( single_shot ) {
+  auto incSvc = concurrentIncidentSvc( "SingleShot" );
+  BOOST_REQUIRE( incSvc );
+
+  for ( int attempt = 0; attempt < 20; ++attempt ) {
+    CountingListener once( true );
+    incSvc->addListener( &once, IncidentType::BeginEvent, 0, false, true );
+
+    // keep rebuilding the listener lists while the incidents are fired
+    std::atomic<bool>                              done{ false };
+    std::vector<std::unique_ptr<CountingListener>> others;
+    std::thread                                    churn( [&]() {
+      while ( !done ) {
+        others.push_back( std::make_unique<CountingListener>( true ) );
+        incSvc->addListener( others.back().get(), IncidentType::EndEvent );
+        if ( others.size() > 10 ) {
+          incSvc->removeListener( others.front().get() );
+          others.erase( others.begin() );
+        }
+      }
+    } );
+    fireFromThreads( *incSvc, 4, 200 );
+    done = true;
+    churn.join();
+    for ( auto& l : others ) incSvc->removeListener( l.get() );
+
+    BOOST_CHECK_EQUAL( once.calls, 1 );
+    incSvc->removeListener( &once );
+  }
+}
+
+BOOST_AUTO_TEST_CASE( remove_waits_for_calls ) {
+  auto incSvc = concurrentIncidentSvc( "RemoveWaits" );
+  BOOST_REQUIRE( incSvc );
+
+  std::atomic<bool> started{ false };
+  auto              slow = std::make_unique<CountingListener>( true, [&started]() {
+    started = true;
+    std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+  } );
+  incSvc->addListener( slow.get(), IncidentType::BeginEvent );
+
+  std::thread firing( [&]() { incSvc->fireIncident( Incident( "test", IncidentType::BeginEvent ) ); } );
+  while ( !started ) std::this_thread::yield();
+  incSvc->removeListener( slow.get() );
+  // the call in progress must be over, so that the listener can be deleted
+  BOOST_CHECK_EQUAL( slow->inside, 0 );
+  BOOST_CHECK_EQUAL( slow->calls, 1 );
+  slow.reset();
+  firing.join();
+}
+
+BOOST_AUTO_TEST_CASE( remove_from_handler ) {
+  auto incSvc = concurrentIncidentSvc( "RemoveFromHandler" );
+  BOOST_REQUIRE( incSvc );
+
+  // a listener removing itself while handling an incident must not wait for itself
+  CountingListener* self = nullptr;
+  CountingListener  listener( false, [&]() { incSvc->removeListener( self ); } );
+  self = &listener;
+  incSvc->addListener( &listener, IncidentType::BeginEvent );
+
+  fireFromThreads( *incSvc, 4, 10 );
+  // the calls are serialized, so after the first one the listener is gone
+  BOOST_CHECK_EQUAL( listener.calls, 1 );
+}
+
+BOOST_AUTO_TEST_CASE( fire_from_handler ) {
+  auto incSvc = concurrentIncidentSvc( "FireFromHandler" );
+  BOOST_REQUIRE( incSvc );
+
+  // two listeners that are not thread-safe, each firing the incident of the other from its handler, invoked from
+  // two threads: the nested calls must not deadlock
+  thread_local bool nested = false;
+  auto              fire   = [&]( const std::string& type ) {
+    return [&incSvc, type]() {
+      if ( nested ) return;
+      nested = true;
+      incSvc->fireIncident( Incident( "test", type ) );
+      nested = false;
+    };
+  };
+  CountingListener x( false, fire( "Y" ) ), y( false, fire( "X" ) );
+  incSvc->addListener( &x, "X" );
+  incSvc->addListener( &y, "Y" );
+
+  std::thread tx( [&]() {
+    for ( int i = 0; i < 1000; ++i ) incSvc->fireIncident( Incident( "test", "X" ) );
+  } );
+  std::thread ty( [&]() {
+    for ( int i = 0; i < 1000; ++i ) incSvc->fireIncident( Incident( "test", "Y" ) );
+  } );
+  tx.join();
+  ty.join();
+
+  BOOST_CHECK_EQUAL( x.calls, 2000 );
+  BOOST_CHECK_EQUAL( y.calls, 2000 );
+  BOOST_CHECK( !x.overlapping );
+  BOOST_CHECK( !y.overlapping );
+  incSvc->removeListener( &x );
+  incSvc->removeListener( &y );
+}
@@ -0,0 +1,103 @@
+/***********************************************************************************\
+* (c) Copyright 1998-2026 CERN for the benefit of the LHCb and ATLAS collaborations *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "COPYING".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE test_JOS
+#include <boost/test/unit_test.hpp>
+
+#include "fixture.h"
+
+#include <Gaudi/Interfaces/IOptionsSvc.h>
+#include <Gaudi/Property.h>
+#include <GaudiKernel/IService.h>
+#include <GaudiKernel/ISvcLocator.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+  struct SnapshotTestHolder : TestPropertyHolder {
+    Gaudi::Property<bool>                     pBool{ this, "pBool", false };
+    Gaudi::Property<int>                      pInt{ this, "pInt", 0 };
+    Gaudi::Property<unsigned int>             pUInt{ this, "pUInt", 0 };
+    Gaudi::Property<float>                    pFloat{ this, "pFloat", 0 };
+    Gaudi::Property<double>                   pDouble{ this, "pDouble", 0 };
+    Gaudi::Property<std::string>              pString{ this, "pString", "" };
+    Gaudi::Property<std::vector<std::string>> pStrings{ this, "pStrings", {} };
+    Gaudi::Property<std::vector<int>>         pInts{ this, "pInts", {} };
+  };
+} // namespace
+
+BOOST_AUTO_TEST_CASE( BinarySnapshot ) {
+  Fixture f;
+
+  const std::string snapshotFile = "test_JOS_snapshot.gopts";
+
+  auto& jos = Gaudi::svcLocator()->getOptsSvc();
+  {
+    // produce the snapshot from the configured options
+    jos.set( "JobOptionsSvc.BinaryDumpFile", "'" + snapshotFile + "'" );
+
+    SnapshotTestHolder ph;
+    jos.set( "test.pBool", "True" );
+    jos.set( "test.pInt", "-42" );
+    jos.set( "test.pUInt", "42" );
+    jos.set( "test.pFloat", "1.5" );
+    jos.set( "test.pDouble", "2.25" );
+    jos.set( "test.pString", "'some text'" );
+    jos.set( "test.pStrings", "['a', 'b', 'c']" );
+    jos.set( "test.pInts", "[1, 2, 3]" );
+    jos.set( "other.Unbound", "'not bound'" );
+    ph.bindPropertiesTo( jos );
+
+    auto svc = Gaudi::svcLocator()->service<IService>( "JobOptionsSvc" );
+    BOOST_REQUIRE( svc );
+    BOOST_CHECK( svc->sysStart() );
+    BOOST_CHECK( svc->sysStop() );
+
+    // forget about the options, so that they come only from the snapshot
+    jos.set( "JobOptionsSvc.BinaryDumpFile", "''" );
+    for ( const auto& [key, value] : jos.items( std::regex{ "(test|other)\\..*" } ) ) jos.pop( key );
+    BOOST_CHECK( !jos.has( "test.pInt" ) );
+  }
+
+  BOOST_REQUIRE( jos.readOptions( snapshotFile ) );
+
+  BOOST_CHECK( jos.has( "test.pInt" ) );
+  BOOST_CHECK( jos.isSet( "test.pInt" ) );
+  BOOST_CHECK_EQUAL( jos.get( "test.pInt" ), "-42" );
+  BOOST_CHECK_EQUAL( jos.get( "other.Unbound" ), "'not bound'" );
+  BOOST_CHECK( !jos.has( "other.Missing" ) );
+
+  // explicit settings take precedence over the snapshot
+  jos.set( "test.pDouble", "3.5" );
+
+  SnapshotTestHolder ph;
+  ph.bindPropertiesTo( jos );
+
+  BOOST_CHECK_EQUAL( ph.pBool.value(), true );
+  BOOST_CHECK_EQUAL( ph.pInt.value(), -42 );
+  BOOST_CHECK_EQUAL( ph.pUInt.value(), 42u );
+  BOOST_CHECK_EQUAL( ph.pFloat.value(), 1.5f );
+  BOOST_CHECK_EQUAL( ph.pDouble.value(), 3.5 );
+  BOOST_CHECK_EQUAL( ph.pString.value(), "some text" );
+  BOOST_CHECK( ph.pStrings.value() == ( std::vector<std::string>{ "a", "b", "c" } ) );
+  BOOST_CHECK( ph.pInts.value() == ( std::vector<int>{ 1, 2, 3 } ) );
+
+  // bound options reflect the value of the properties
+  ph.pInt = 7;
+  BOOST_CHECK_EQUAL( jos.get( "test.pInt" ), "7" );
+  BOOST_CHECK( jos.isSet( "test.pInt" ) );
+
+  BOOST_CHECK_EQUAL( jos.pop( "other.Unbound" ), "'not bound'" );
+  BOOST_CHECK( !jos.has( "other.Unbound" ) );
+
+  std::remove( snapshotFile.c_str() );
+}
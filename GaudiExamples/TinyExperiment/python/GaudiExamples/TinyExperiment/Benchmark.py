@@ -0,0 +1,436 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+"""
+End-to-end throughput benchmark of the multithreaded event processing.
+
+The workload is either the TinyExperiment pipeline ("tiny", or "tiny-soa" for
+its structure of arrays version) or one of the CPUCruncher scenarios of GaudiHive ("atlas", "cms", "lhcb"), with the timing of
+the algorithms scaled by a configurable factor.
+
+Every configuration (scenario, event store, number of threads and of event
+slots) is run in a separate gaudirun.py process, with the TimelineSvc recording
+the execution of the algorithms. For each run the benchmark reports:
+
+- throughput: events per second between the first algorithm start and the last
+  algorithm end (initialization and finalization excluded)
+- occupancy: fraction of the worker threads time spent in algorithms
+- scheduler_gap_us: median time between the end of an algorithm and the start of
+  the next one on the same thread
+- max_rss_mb: peak resident memory of the process
+- efficiency: throughput relative to the run with the smallest number of threads
+  for the same scenario, store (and number of slots, if given explicitly),
+  divided by the ratio of the number of threads
+
+Usage::
+
+    python -m GaudiExamples.TinyExperiment.Benchmark --scenarios tiny,lhcb \\
+        --stores HiveWhiteBoard,EvtStoreSvc --threads 1,2,4,8 -n 2000 -o results.json
+
+The results are printed as a table and written as JSON, to be compared between
+releases.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+import time
+from statistics import median
+
+# CPUCruncher scenarios: precedence graphs and algorithm timings (relative to GaudiHive/data)
+CRUNCHER_SCENARIOS = {
+    "atlas": dict(
+        timing="atlas/mcreco/averageTiming.mcreco.TriggerOff.json",
+        cfgPath="atlas/mcreco/cf.mcreco.TriggerOff.graphml",
+        dfgPath="atlas/mcreco/df.mcreco.TriggerOff.3rdEvent.graphml",
+        topSequencer="AthSequencer/AthMasterSeq",
+    ),
+    "cms": dict(
+        timing="cms/reco/algs-time.json",
+        cfgPath="cms/reco/cf.graphml",
+        dfgPath="cms/reco/df.graphml",
+        topSequencer="TopSequencer",
+    ),
+    "lhcb": dict(
+        timing="lhcb/reco/timing.Brunel.1kE.json",
+        cfgPath="lhcb/reco/cf.Brunel.graphml",
+        dfgPath="lhcb/reco/df.Brunel.graphml",
+        topSequencer="BrunelSequencer",
+    ),
+}
+
+SCENARIOS = ["tiny", "tiny-soa"] + list(CRUNCHER_SCENARIOS)
+STORES = ["HiveWhiteBoard", "EvtStoreSvc"]
+
+
+def _tinyExperiment(soa=False):
+    from Configurables import RandomGenSvc
+    from Configurables import Gaudi__Example__TinyExperiment__CheckerAlg as CheckerAlg
+    from Configurables import (
+        Gaudi__Example__TinyExperiment__GeneratorAlg as GeneratorAlg,
+    )
+
+    if soa:
+        from Configurables import (
+            Gaudi__Example__TinyExperiment__DigitizationSoAAlg as DigitizationAlg,
+        )
+        from Configurables import (
+            Gaudi__Example__TinyExperiment__SimulationSoAAlg as SimulationAlg,
+        )
+        from Configurables import (
+            Gaudi__Example__TinyExperiment__TrackingSoAAlg as TrackingAlg,
+        )
+    else:
+        from Configurables import (
+            Gaudi__Example__TinyExperiment__DigitizationAlg as DigitizationAlg,
+        )
+        from Configurables import (
+            Gaudi__Example__TinyExperiment__SimulationAlg as SimulationAlg,
+        )
+        from Configurables import (
+            Gaudi__Example__TinyExperiment__TrackingAlg as TrackingAlg,
+        )
+
+    RandomGenSvc(RandomSeed=1234)
+    gen = GeneratorAlg("GeneratorAlg", NbTracksToGenerate=10)
+    sim = SimulationAlg(
+        "SimulationAlg", NbHitsPerTrack=15, MCTracksLocation=gen.MCTracksLocation
+    )
+    digi = DigitizationAlg(
+        "DigitizationAlg", SigmaNoise=0.1, MCHitsLocation=sim.MCHitsLocation
+    )
+    track = TrackingAlg(
+        "TrackingAlg", NumberBins=100, Sensibility=6, HitsLocation=digi.HitsLocation
+    )
+    check = CheckerAlg(
+        "CheckerAlg", DeltaThetaMax=0.01, TracksLocation=track.TracksLocation
+    )
+    return [gen, sim, digi, track, check]
+
+
+def _cruncherScenario(name, timeScale):
+    from Configurables import CPUCrunchSvc
+
+    from GaudiHive import precedence
+
+    CPUCrunchSvc(shortCalib=True)
+    scenario = CRUNCHER_SCENARIOS[name]
+    return [
+        precedence.CruncherSequence(
+            precedence.RealTimeValue(
+                path=scenario["timing"], defaultTime=0.0, factor=timeScale
+            ),
+            precedence.UniformBooleanValue(False),
+            sleepFraction=0.0,
+            cfgPath=scenario["cfgPath"],
+            dfgPath=scenario["dfgPath"],
+            topSequencer=scenario["topSequencer"],
+        ).get()
+    ]
+
+
+def config(
+    scenario="tiny",
+    store="HiveWhiteBoard",
+    threads=4,
+    slots=4,
+    events=1000,
+    timeScale=0.01,
+    timeline="timeline.csv",
+):
+    """
+    Configure one run of the benchmark (to be used with gaudirun.py --option).
+    """
+    from Configurables import (
+        ApplicationMgr,
+        AvalancheSchedulerSvc,
+        EvtStoreSvc,
+        HiveSlimEventLoopMgr,
+        HiveWhiteBoard,
+        TimelineSvc,
+    )
+
+    from Gaudi.Configuration import WARNING
+
+    if store == "HiveWhiteBoard":
+        whiteboard = HiveWhiteBoard("EventDataSvc", EventSlots=slots)
+    elif store == "EvtStoreSvc":
+        whiteboard = EvtStoreSvc("EventDataSvc", EventSlots=slots)
+    else:
+        raise ValueError("unknown event store %r" % store)
+
+    scheduler = AvalancheSchedulerSvc(ThreadPoolSize=threads, OutputLevel=WARNING)
+    slimeventloopmgr = HiveSlimEventLoopMgr(
+        SchedulerName=scheduler.name(), OutputLevel=WARNING
+    )
+    TimelineSvc(RecordTimeline=True, DumpTimeline=True, TimelineFile=timeline)
+
+    if scenario in ("tiny", "tiny-soa"):
+        algs = _tinyExperiment(soa=scenario == "tiny-soa")
+    else:
+        algs = _cruncherScenario(scenario, timeScale)
+
+    ApplicationMgr(
+        ExtSvc=[whiteboard],
+        TopAlg=algs,
+        EvtMax=events,
+        EvtSel="NONE",
+        EventLoop=slimeventloopmgr,
+        MessageSvcType="InertMessageSvc",
+        OutputLevel=WARNING,
+    )
+
+
+def analyseTimeline(path, threads):
+    """
+    Extract throughput, occupancy and scheduling gaps from a TimelineSvc dump.
+    """
+    records = []
+    with open(path) as f:
+        for line in f:
+            if line.startswith("#"):
+                continue
+            start, end, _alg, thread, _slot, event = line.split()
+            records.append((int(start), int(end), thread, int(event)))
+    if not records:
+        return None
+
+    first = min(r[0] for r in records)
+    last = max(r[1] for r in records)
+    span = (last - first) * 1e-9
+    busy = sum(r[1] - r[0] for r in records) * 1e-9
+    nEvents = len(set(r[3] for r in records))
+
+    gaps = []
+    byThread = {}
+    for start, end, thread, _ in records:
+        byThread.setdefault(thread, []).append((start, end))
+    for tasks in byThread.values():
+        tasks.sort()
+        gaps.extend(b[0] - a[1] for a, b in zip(tasks, tasks[1:]) if b[0] >= a[1])
+
+    return {
+        "events": nEvents,
+        "tasks": len(records),
+        "span_s": span,
+        "throughput": nEvents / span if span > 0 else 0.0,
+        "occupancy": busy / (threads * span) if span > 0 else 0.0,
+        "scheduler_gap_us": median(gaps) * 1e-3 if gaps else 0.0,
+    }
+
+
+def runOne(scenario, store, threads, slots, events, timeScale, workdir):
+    """
+    Run one configuration in a separate process and return its measurements.
+    """
+    timeline = os.path.join(
+        workdir, "timeline_%s_%s_t%d_s%d.csv" % (scenario, store, threads, slots)
+    )
+    option = (
+        "from GaudiExamples.TinyExperiment.Benchmark import config; "
+        "config(scenario=%r, store=%r, threads=%d, slots=%d, events=%d, "
+        "timeScale=%r, timeline=%r)"
+        % (scenario, store, threads, slots, events, timeScale, timeline)
+    )
+    log = os.path.splitext(timeline)[0] + ".log"
+    with open(log, "w") as out:
+        start = time.time()
+        proc = subprocess.Popen(
+            ["gaudirun.py", "--option", option], stdout=out, stderr=subprocess.STDOUT
+        )
+        # os.wait4 gives the resource usage of this child only
+        _, status, usage = os.wait4(proc.pid, 0)
+        wallTime = time.time() - start
+
+    result = {
+        "scenario": scenario,
+        "store": store,
+        "threads": threads,
+        "slots": slots,
+        "wall_time_s": wallTime,
+        # ru_maxrss is in KiB on Linux
+        "max_rss_mb": usage.ru_maxrss / 1024.0,
+        "exit_code": os.waitstatus_to_exitcode(status),
+    }
+    if result["exit_code"] != 0:
+        with open(log) as f:
+            sys.stderr.write(f.read())
+    elif os.path.exists(timeline):
+        result.update(analyseTimeline(timeline, threads) or {})
+    return result
+
+
+def addEfficiency(results, sameSlots=True):
+    """
+    Compute the scaling efficiency with respect to the run with the fewest
+    threads of the same scenario and store (and number of slots, if sameSlots).
+    """
+
+    def key(r):
+        return (r["scenario"], r["store"]) + ((r["slots"],) if sameSlots else ())
+
+    for r in results:
+        same = [o for o in results if o.get("throughput") and key(o) == key(r)]
+        if not r.get("throughput") or not same:
+            continue
+        base = min(same, key=lambda o: o["threads"])
+        r["efficiency"] = (r["throughput"] / base["throughput"]) / (
+            r["threads"] / base["threads"]
+        )
+
+
+def printTable(results):
+    header = "%-6s %-15s %7s %5s %12s %9s %10s %8s %10s" % (
+        "scen.",
+        "store",
+        "threads",
+        "slots",
+        "events/s",
+        "occupancy",
+        "gap [us]",
+        "effic.",
+        "RSS [MB]",
+    )
+    print(header)
+    print("-" * len(header))
+    for r in results:
+        if r["exit_code"] != 0:
+            print(
+                "%-6s %-15s %7d %5d   failed (exit code %d)"
+                % (r["scenario"], r["store"], r["threads"], r["slots"], r["exit_code"])
+            )
+            continue
+        print(
+            "%-6s %-15s %7d %5d %12.1f %9.2f %10.1f %8.2f %10.1f"
+            % (
+                r["scenario"],
+                r["store"],
+                r["threads"],
+                r["slots"],
+                r.get("throughput", 0.0),
+                r.get("occupancy", 0.0),
+                r.get("scheduler_gap_us", 0.0),
+                r.get("efficiency", 0.0),
+                r["max_rss_mb"],
+            )
+        )
+
+
+def _intList(value):
+    return [int(v) for v in value.split(",")]
+
+
+def _choiceList(choices):
+    def parse(value):
+        values = value.split(",")
+        for v in values:
+            if v not in choices:
+                raise argparse.ArgumentTypeError(
+                    "invalid choice %r (choose from %s)" % (v, ", ".join(choices))
+                )
+        return values
+
+    return parse
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(
+        description=__doc__.split("\n\n")[0].strip(),
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+    )
+    parser.add_argument(
+        "--scenarios",
+        type=_choiceList(SCENARIOS),
+        default=["tiny"],
+        help="comma separated list of workloads (%s) [default: %%(default)s]"
+        % ", ".join(SCENARIOS),
+    )
+    parser.add_argument(
+        "--stores",
+        type=_choiceList(STORES),
+        default=STORES,
+        help="comma separated list of event stores [default: %(default)s]",
+    )
+    parser.add_argument(
+        "--threads",
+        type=_intList,
+        default=[1, 2, 4, 8],
+        help="comma separated list of thread pool sizes [default: %(default)s]",
+    )
+    parser.add_argument(
+        "--slots",
+        type=_intList,
+        default=None,
+        help="comma separated list of numbers of event slots "
+        "[default: same as the number of threads]",
+    )
+    parser.add_argument(
+        "-n", "--events", type=int, default=1000, help="events per run [%(default)s]"
+    )
+    parser.add_argument(
+        "--time-scale",
+        type=float,
+        default=0.01,
+        help="scale factor for the algorithm times of the CPUCruncher scenarios "
+        "[%(default)s]",
+    )
+    parser.add_argument(
+        "-o", "--output", help="file where to write the results (JSON)"
+    )
+    parser.add_argument(
+        "--keep-timelines",
+        metavar="DIR",
+        help="directory where to keep the timelines and the logs of the runs",
+    )
+    args = parser.parse_args(argv)
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        workdir = args.keep_timelines or tmpdir
+        os.makedirs(workdir, exist_ok=True)
+        results = []
+        for scenario in args.scenarios:
+            for store in args.stores:
+                for threads in args.threads:
+                    for slots in args.slots or [threads]:
+                        results.append(
+                            runOne(
+                                scenario,
+                                store,
+                                threads,
+                                slots,
+                                args.events,
+                                args.time_scale,
+                                workdir,
+                            )
+                        )
+
+    addEfficiency(results, sameSlots=args.slots is not None)
+    printTable(results)
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(
+                {
+                    "events": args.events,
+                    "time_scale": args.time_scale,
+                    "host": os.uname().nodename,
+                    "cpus": os.cpu_count(),
+                    "results": results,
+                },
+                f,
+                indent=2,
+            )
+    return 0 if all(r["exit_code"] == 0 for r in results) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -11,7 +11,7 @@
 import sys
 
 
-def config(evtslots=12, threads=10):
+def config(evtslots=12, threads=10, soa=False):
     from Configurables import (
         ApplicationMgr,
         AvalancheSchedulerSvc,
@@ -20,18 +20,33 @@ def config(evtslots=12, threads=10):
         RandomGenSvc,
     )
     from Configurables import Gaudi__Example__TinyExperiment__CheckerAlg as CheckerAlg
-    from Configurables import (
-        Gaudi__Example__TinyExperiment__DigitizationAlg as DigitizationAlg,
-    )
     from Configurables import (
         Gaudi__Example__TinyExperiment__GeneratorAlg as GeneratorAlg,
     )
-    from Configurables import (
-        Gaudi__Example__TinyExperiment__SimulationAlg as SimulationAlg,
-    )
-    from Configurables import Gaudi__Example__TinyExperiment__TrackingAlg as TrackingAlg
     from Configurables import Gaudi__Monitoring__MessageSvcSink as MessageSvcSink
 
+    if soa:
+        # structure of arrays versions of the event model and of the algorithms
+        from Configurables import (
+            Gaudi__Example__TinyExperiment__DigitizationSoAAlg as DigitizationAlg,
+        )
+        from Configurables import (
+            Gaudi__Example__TinyExperiment__SimulationSoAAlg as SimulationAlg,
+        )
+        from Configurables import (
+            Gaudi__Example__TinyExperiment__TrackingSoAAlg as TrackingAlg,
+        )
+    else:
+        from Configurables import (
+            Gaudi__Example__TinyExperiment__DigitizationAlg as DigitizationAlg,
+        )
+        from Configurables import (
+            Gaudi__Example__TinyExperiment__SimulationAlg as SimulationAlg,
+        )
+        from Configurables import (
+            Gaudi__Example__TinyExperiment__TrackingAlg as TrackingAlg,
+        )
+
     evtslots = 12
     threads = 10
 
@@ -70,3 +85,10 @@ def config(evtslots=12, threads=10):
         EvtSel="NONE",
         EventLoop=slimeventloopmgr,
     )
+
+
+def configSoA():
+    """
+    Same as config, using the structure of arrays event model.
+    """
+    config(soa=True)
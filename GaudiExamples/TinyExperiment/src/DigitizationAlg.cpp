@@ -15,6 +15,7 @@
 
 #include <Gaudi/Accumulators.h>
 #include <Gaudi/Functional/Transformer.h>
+#include <Gaudi/Functional/zip.h>
 
 #include <random>
 
@@ -57,4 +58,51 @@ namespace Gaudi::Example::TinyExperiment {
 
   DECLARE_COMPONENT( DigitizationAlg )
 
+  /**
+   * Same as DigitizationAlg, working on structures of arrays
+   */
+  class DigitizationSoAAlg : public Functional::Transformer<HitsSoA( EventContext const&, MCHitsSoA const& )> {
+  public:
+    DigitizationSoAAlg( const std::string& name, ISvcLocator* pSvcLocator )
+        : Transformer( name, pSvcLocator, { { "MCHitsLocation", "/Event/MCHitsSoA" } },
+                       { "HitsLocation", "/Event/HitsSoA" } ) {}
+
+    HitsSoA operator()( const EventContext& ctx, MCHitsSoA const& mcHits ) const override {
+      const std::size_t n = mcHits.size();
+      HitsSoA           hits( n );
+      auto [x, y]         = hits.columns();
+      // the noise is drawn in the same order as in DigitizationAlg, so that the hits are the same
+      std::normal_distribution dist( 0.0f, m_sigmaNoise.value() ); // µ, σ
+      auto                     engine = m_rndSvc->getEngine( ctx.evt() );
+      for ( std::size_t i = 0; i < n; ++i ) {
+        x[i] = dist( engine );
+        y[i] = dist( engine );
+      }
+      for ( auto&& [nx, ny, mcx, mcy] :
+            Functional::details::zip::range( x, y, mcHits.column<MCHitSoA::X>(), mcHits.column<MCHitSoA::Y>() ) ) {
+        nx += mcx;
+        ny += mcy;
+      }
+      // ignore negative axis, compacting the columns without branches
+      std::size_t kept = 0;
+      for ( std::size_t i = 0; i < n; ++i ) {
+        x[kept] = x[i];
+        y[kept] = y[i];
+        kept += x[i] > 0;
+      }
+      hits.resize( kept );
+      n_hits += kept;
+      return hits;
+    };
+
+  private:
+    ServiceHandle<IRandomGenSvc>           m_rndSvc{ this, "RandomGenSvc", "RandomGenSvc",
+                                           "A service providing a thread safe random number generator" };
+    Gaudi::Property<float>                 m_sigmaNoise{ this, "SigmaNoise", 1.f,
+                                         "Sigma of the noise (a normal distribution centered on 0)" };
+    mutable Gaudi::Accumulators::Counter<> n_hits{ this, "Number of Hits" };
+  };
+
+  DECLARE_COMPONENT( DigitizationSoAAlg )
+
 } // namespace Gaudi::Example::TinyExperiment
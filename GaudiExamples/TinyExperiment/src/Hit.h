@@ -10,6 +10,8 @@
 \***********************************************************************************/
 #pragma once
 
+#include <Gaudi/SOACollection.h>
+
 #include <vector>
 
 namespace Gaudi::Example::TinyExperiment {
@@ -26,4 +28,14 @@ namespace Gaudi::Example::TinyExperiment {
 
   using Hits = std::vector<Hit>;
 
+  namespace HitSoA {
+    struct X : Gaudi::SOAField<float> {};
+    struct Y : Gaudi::SOAField<float> {};
+  } // namespace HitSoA
+
+  /**
+   * same hits stored as a structure of arrays, for vectorized processing
+   */
+  using HitsSoA = Gaudi::SOACollection<HitSoA::X, HitSoA::Y>;
+
 } // namespace Gaudi::Example::TinyExperiment
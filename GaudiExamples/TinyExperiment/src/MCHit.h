@@ -10,6 +10,8 @@
 \***********************************************************************************/
 #pragma once
 
+#include <Gaudi/SOACollection.h>
+
 #include <vector>
 
 namespace Gaudi::Example::TinyExperiment {
@@ -26,4 +28,14 @@ namespace Gaudi::Example::TinyExperiment {
 
   using MCHits = std::vector<MCHit>;
 
+  namespace MCHitSoA {
+    struct X : Gaudi::SOAField<float> {};
+    struct Y : Gaudi::SOAField<float> {};
+  } // namespace MCHitSoA
+
+  /**
+   * same MC hits stored as a structure of arrays, for vectorized processing
+   */
+  using MCHitsSoA = Gaudi::SOACollection<MCHitSoA::X, MCHitSoA::Y>;
+
 } // namespace Gaudi::Example::TinyExperiment
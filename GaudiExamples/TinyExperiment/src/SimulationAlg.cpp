@@ -52,4 +52,39 @@ namespace Gaudi::Example::TinyExperiment {
 
   DECLARE_COMPONENT( SimulationAlg )
 
+  /**
+   * Same as SimulationAlg, producing the MC Hits as a structure of arrays
+   */
+  class SimulationSoAAlg : public Functional::Transformer<MCHitsSoA( MCTracks const& )> {
+  public:
+    SimulationSoAAlg( const std::string& name, ISvcLocator* pSvcLocator )
+        : Transformer( name, pSvcLocator, { { "MCTracksLocation", "/Event/MCTracks" } },
+                       { "MCHitsLocation", "/Event/MCHitsSoA" } ) {}
+
+    MCHitsSoA operator()( MCTracks const& tracks ) const override {
+      const unsigned int nHits = m_nbHitsPerTrack;
+      MCHitsSoA          hits( tracks.size() * nHits );
+      float*             x = hits.data<MCHitSoA::X>();
+      float*             y = hits.data<MCHitSoA::Y>();
+      for ( auto const& track : tracks ) {
+        auto [s, c] = sincos( track.theta );
+        // independent iterations on contiguous columns: vectorizable
+        for ( unsigned int i = 0; i < nHits; i++ ) {
+          x[i] = i * c;
+          y[i] = i * s;
+        }
+        x += nHits;
+        y += nHits;
+      }
+      n_hits += hits.size();
+      return hits;
+    };
+
+  private:
+    Gaudi::Property<unsigned int>          m_nbHitsPerTrack{ this, "NbHitsPerTrack", 10 };
+    mutable Gaudi::Accumulators::Counter<> n_hits{ this, "Number of MCHits" };
+  };
+
+  DECLARE_COMPONENT( SimulationSoAAlg )
+
 } // namespace Gaudi::Example::TinyExperiment
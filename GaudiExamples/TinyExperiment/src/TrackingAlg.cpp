@@ -15,6 +15,7 @@
 #include <Gaudi/Accumulators.h>
 #include <Gaudi/Functional/Transformer.h>
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 
@@ -59,4 +60,51 @@ namespace Gaudi::Example::TinyExperiment {
 
   DECLARE_COMPONENT( TrackingAlg )
 
+  /**
+   * Same as TrackingAlg, reading the hits from a structure of arrays.
+   *
+   * The bin of each hit is computed in a first loop without branches nor bounds checks, that the compiler can
+   * vectorize (for the calls to std::atan this requires a vector math library, e.g. glibc libmvec with
+   * -fno-math-errno), and the histogram is filled in a second, scalar, loop.
+   */
+  class TrackingSoAAlg : public Functional::Transformer<Tracks( HitsSoA const& )> {
+  public:
+    TrackingSoAAlg( const std::string& name, ISvcLocator* pSvcLocator )
+        : Transformer( name, pSvcLocator, { { "HitsLocation", "/Event/HitsSoA" } },
+                       { "TracksLocation", "/Event/Tracks" } ) {}
+
+    Tracks operator()( HitsSoA const& hits ) const override {
+      const unsigned int nBins = m_nBins;
+      const std::size_t  n     = hits.size();
+      const float*       x     = hits.data<HitSoA::X>();
+      const float*       y     = hits.data<HitSoA::Y>();
+      std::vector<unsigned int> index( n );
+      for ( std::size_t i = 0; i < n; ++i ) {
+        auto theta = std::atan( y[i] / x[i] );
+        // theta == pi/2 would be out of range
+        index[i] = std::min( static_cast<unsigned int>( ( theta + M_PI / 2 ) / M_PI * nBins ), nBins - 1 );
+      }
+      std::vector<unsigned int> bins( nBins, 0 );
+      for ( auto i : index ) ++bins[i];
+      // extract tracks
+      Tracks tracks;
+      tracks.reserve( n / 10 );
+      for ( unsigned int b = 0; b < nBins; b++ ) {
+        if ( bins[b] >= m_sensibility ) {
+          tracks.emplace_back( -M_PI / 2 + ( M_PI * ( b + 0.5f ) ) / nBins );
+          ++n_tracks;
+        }
+      }
+      return tracks;
+    };
+
+  private:
+    Gaudi::Property<unsigned int> m_nBins{ this, "NumberBins", 180, "Number of bins in the Hough Transform for theta" };
+    Gaudi::Property<unsigned int> m_sensibility{ this, "Sensibility", 6,
+                                                 "How many hits do we want for considering we have a track ?" };
+    mutable Gaudi::Accumulators::Counter<> n_tracks{ this, "Number of Tracks" };
+  };
+
+  DECLARE_COMPONENT( TrackingSoAAlg )
+
 } // namespace Gaudi::Example::TinyExperiment
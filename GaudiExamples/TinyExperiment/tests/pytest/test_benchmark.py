@@ -0,0 +1,46 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import json
+
+from GaudiTesting import GaudiExeTest
+
+
+class Test(GaudiExeTest):
+    """
+    Run a minimal sweep of the throughput benchmark and check its JSON report.
+    """
+
+    output = "benchmark.json"
+    command = [
+        "python3",
+        "-m",
+        "GaudiExamples.TinyExperiment.Benchmark",
+        "--threads",
+        "1,2",
+        "-n",
+        "20",
+        "-o",
+        output,
+    ]
+
+    def test_report(self, cwd):
+        with (cwd / self.output).open() as f:
+            report = json.load(f)
+        results = report["results"]
+        assert len(results) == 4
+        assert {r["store"] for r in results} == {"HiveWhiteBoard", "EvtStoreSvc"}
+        for r in results:
+            assert r["exit_code"] == 0
+            assert r["events"] == 20
+            assert r["throughput"] > 0
+            assert 0 < r["occupancy"] <= 1
+            assert r["max_rss_mb"] > 0
+            assert "efficiency" in r
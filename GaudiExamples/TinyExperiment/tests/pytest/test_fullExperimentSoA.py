@@ -0,0 +1,62 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import re
+from subprocess import check_output
+
+import pytest
+from GaudiTesting import GaudiExeTest
+
+ALGORITHMS = ["SimulationAlg", "DigitizationAlg", "TrackingAlg", "CheckerAlg"]
+
+
+def counters(out):
+    """
+    Extract the number of entries and the sum of the counters of each algorithm
+    from the output of a job.
+    """
+    result = {}
+    alg = None
+    for line in out.splitlines():
+        if m := re.match(r"^(\S+)\s+INFO Number of counters", line):
+            alg = m.group(1)
+        elif alg and (m := re.match(r'^\s*\|\*?\s*"([^"]+)"\s*\|(.*)', line)):
+            fields = [f.strip() for f in m.group(2).split("|")]
+            result[(alg, m.group(1))] = (int(fields[0]), float(fields[1]))
+    return result
+
+
+class Test(GaudiExeTest):
+    """
+    Run the TinyExperiment with the structure of arrays event model and check
+    that it gives the same results as the array of structures one.
+    """
+
+    command = ["gaudirun.py", "GaudiExamples.TinyExperiment.FullExperiment:configSoA"]
+
+    @pytest.fixture(scope="class")
+    def aos_counters(self):
+        return counters(
+            check_output(
+                ["gaudirun.py", "GaudiExamples.TinyExperiment.FullExperiment:config"],
+                text=True,
+            )
+        )
+
+    def test_counters(self, stdout, aos_counters):
+        soa_counters = counters(stdout.decode())
+        for alg in ALGORITHMS:
+            assert any(key[0] == alg for key in soa_counters), alg
+        # the events are seeded from their number, so the results do not depend
+        # on the scheduling
+        assert soa_counters.keys() == aos_counters.keys()
+        for key, (entries, total) in aos_counters.items():
+            assert soa_counters[key][0] == entries, key
+            assert soa_counters[key][1] == pytest.approx(total), key
@@ -0,0 +1,55 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+"""
+Coroutine algorithms reading blocks of a file through the AsyncFileSvc.
+
+The file (4 MB, where the byte at position p is p % 251) is written by this
+options file, and the content of each block read is checked by the algorithms.
+Its name can be set with the environment variable ASYNC_FILE_READER_DATA, so
+that jobs running in parallel do not overwrite the file of each other.
+"""
+
+import os
+
+from Configurables import (
+    AsyncFileReader,
+    AsyncFileSvc,
+    AvalancheSchedulerSvc,
+    HiveSlimEventLoopMgr,
+    HiveWhiteBoard,
+)
+from Gaudi.Configuration import *
+
+fileName = os.environ.get("ASYNC_FILE_READER_DATA", "async_file_reader.dat")
+fileSize = 4 * 1024 * 1024
+with open(fileName, "wb") as f:
+    f.write((bytes(range(251)) * (fileSize // 251 + 1))[:fileSize])
+
+evtslots = 8
+
+whiteboard = HiveWhiteBoard("EventDataSvc", EventSlots=evtslots)
+
+slimeventloopmgr = HiveSlimEventLoopMgr(OutputLevel=INFO)
+
+scheduler = AvalancheSchedulerSvc(ThreadPoolSize=2, OutputLevel=WARNING)
+
+AsyncFileSvc(QueueDepth=32)
+
+reader = AsyncFileReader("Reader", FileName=fileName, BlocksPerEvent=16)
+
+ApplicationMgr(
+    EvtMax=200,
+    EvtSel="NONE",
+    ExtSvc=[whiteboard],
+    EventLoop=slimeventloopmgr,
+    TopAlg=[reader],
+    MessageSvcType="InertMessageSvc",
+)
@@ -0,0 +1,53 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+"""
+Chains of coroutine algorithms waiting 100 ms each, run on a single thread.
+
+The suspended algorithms do not block the thread, so the events in flight are
+processed concurrently: executed one after the other the 400 algorithm
+executions would take 40 s.
+"""
+
+from Configurables import (
+    AvalancheSchedulerSvc,
+    CoroutineSleeper,
+    HiveSlimEventLoopMgr,
+    HiveWhiteBoard,
+)
+from Gaudi.Configuration import *
+
+evtslots = 20
+nAlgs = 10
+
+whiteboard = HiveWhiteBoard("EventDataSvc", EventSlots=evtslots)
+
+slimeventloopmgr = HiveSlimEventLoopMgr(OutputLevel=INFO)
+
+scheduler = AvalancheSchedulerSvc(ThreadPoolSize=1, OutputLevel=WARNING)
+
+algs = [
+    CoroutineSleeper(
+        "S%d" % i,
+        SleepTime=100.0,
+        Inputs=["/Event/S%d" % (i - 1)] if i else [],
+        Outputs=["/Event/S%d" % i],
+    )
+    for i in range(nAlgs)
+]
+
+ApplicationMgr(
+    EvtMax=40,
+    EvtSel="NONE",
+    ExtSvc=[whiteboard],
+    EventLoop=slimeventloopmgr,
+    TopAlg=algs,
+    MessageSvcType="InertMessageSvc",
+)
@@ -0,0 +1,38 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+"""
+Chain of coroutine algorithms waiting 10 ms each, run by the single-threaded
+EventLoopMgr on a plain EvtDataSvc: each coroutine is run to completion within
+execute().
+"""
+
+from Configurables import CoroutineSleeper, EventLoopMgr, EvtDataSvc
+from Gaudi.Configuration import *
+
+nAlgs = 3
+
+algs = [
+    CoroutineSleeper(
+        "S%d" % i,
+        SleepTime=10.0,
+        Inputs=["/Event/S%d" % (i - 1)] if i else [],
+        Outputs=["/Event/S%d" % i],
+    )
+    for i in range(nAlgs)
+]
+
+ApplicationMgr(
+    EvtMax=5,
+    EvtSel="NONE",
+    EventLoop=EventLoopMgr(),
+    TopAlg=algs,
+)
+EvtDataSvc("EventDataSvc")
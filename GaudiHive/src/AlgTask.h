@@ -15,6 +15,7 @@
 
 // Framework include files
 #include <Gaudi/Algorithm.h>
+#include <Gaudi/CoroutineAlgorithm.h>
 #include <GaudiKernel/EventContext.h>
 #include <GaudiKernel/IAlgExecStateSvc.h>
 #include <GaudiKernel/IMessageSvc.h>
@@ -76,6 +77,27 @@ public:
 
     // select the appropriate store
     this_algo->whiteboard()->selectStore( evtCtx.valid() ? evtCtx.slot() : 0 ).ignore();
+
+    // coroutine algorithms return at their first suspension, the task is completed when they are done
+    if ( auto coAlgo = dynamic_cast<Gaudi::CoroutineAlgorithm*>( this_algo ); coAlgo && !m_asynchronous ) {
+      coAlgo->sysExecuteAsync(
+          evtCtx, m_scheduler->m_coroutineExecutor,
+          [scheduler = m_scheduler, aess = m_aess, svcLocator = m_serviceLocator, ts]( StatusCode sc ) {
+            if ( sc.isFailure() ) {
+              MsgStream log( SmartIF<IMessageSvc>( svcLocator ), "AlgTask" );
+              log << MSG::WARNING << "Execution of algorithm " << ts.algName << " failed" << endmsg;
+            }
+            complete( scheduler, aess, ts, sc.isFailure() );
+          } );
+      Gaudi::Hive::setCurrentContextEvt( -1 );
+      return;
+    }
+
+    // the asynchronous (blocking) algorithms run on fibers sharing the threads
+    SlowEventWatchdog*         watchdog = m_scheduler->m_watchdog.get();
+    SlowEventWatchdog::Runner* runner   = watchdog ? &watchdog->algStarted( ts.algIndex, evtCtx, m_asynchronous )
+                                                   : nullptr;
+
     try {
       RetCodeGuard rcg( appmgr, Gaudi::ReturnCode::UnhandledException );
 
@@ -98,20 +120,27 @@ public:
       eventfailed = true;
     }
 
+    if ( runner ) watchdog->algFinished( *runner );
+
+    complete( m_scheduler, m_aess, std::move( ts ), eventfailed );
+
+    Gaudi::Hive::setCurrentContextEvt( -1 );
+  }
+
+private:
+  /// Report the outcome of the execution of an algorithm and release it
+  static void complete( AvalancheSchedulerSvc* scheduler, IAlgExecStateSvc* aess, AvalancheSchedulerSvc::TaskSpec ts,
+                        bool eventfailed ) {
     // A FAILURE in algorithm execution must be communicated to the framework
-    m_aess->updateEventStatus( eventfailed, evtCtx );
+    aess->updateEventStatus( eventfailed, *ts.contextPtr );
 
     // Release algorithm
-    m_scheduler->m_algResourcePool->releaseAlgorithm( ts.algName, iAlgoPtr ).ignore();
+    scheduler->m_algResourcePool->releaseAlgorithm( ts.algName, ts.algPtr ).ignore();
 
     // schedule a sign-off of the Algorithm execution
-    m_scheduler->m_actionsQueue.push(
-        [schdlr = this->m_scheduler, ts = std::move( ts )]() { return schdlr->signoff( ts ); } );
-
-    Gaudi::Hive::setCurrentContextEvt( -1 );
+    scheduler->m_actionsQueue.push( [scheduler, ts = std::move( ts )]() { return scheduler->signoff( ts ); } );
   }
 
-private:
   // Shortcuts to services
   AvalancheSchedulerSvc* m_scheduler;
   IAlgExecStateSvc*      m_aess;
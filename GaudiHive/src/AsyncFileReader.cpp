@@ -0,0 +1,118 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include <Gaudi/Accumulators.h>
+#include <Gaudi/CoroutineAlgorithm.h>
+#include <GaudiKernel/ConcurrencyFlags.h>
+#include <GaudiKernel/IAsyncFileSvc.h>
+#include <GaudiKernel/ServiceHandle.h>
+#include <GaudiKernel/ThreadLocalContext.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <unistd.h>
+#include <vector>
+
+/** Test algorithm reading, for each event, a few blocks of a file through the IAsyncFileSvc (suspending without
+ *  blocking a thread until the reads complete), then checking their content.
+ *
+ *  The byte at position `p` of the file is expected to be `p % 251`. Each event slot has its own destination
+ *  buffer, optionally registered in the service.
+ */
+class AsyncFileReader : public Gaudi::CoroutineAlgorithm {
+public:
+  using CoroutineAlgorithm::CoroutineAlgorithm;
+
+  StatusCode initialize() override {
+    return CoroutineAlgorithm::initialize().andThen( [&]() -> StatusCode {
+      m_fd = m_fileSvc->open( name(), m_fileName );
+      if ( m_fd < 0 ) return StatusCode::FAILURE;
+      const auto size = ::lseek( m_fd, 0, SEEK_END );
+      m_nBlocks       = size / m_blockSize;
+      if ( m_nBlocks < m_blocksPerEvent ) {
+        error() << m_fileName.value() << " is too small (" << size << " bytes)" << endmsg;
+        return StatusCode::FAILURE;
+      }
+      const std::size_t nSlots =
+          std::max<std::size_t>( 1, Gaudi::Concurrency::ConcurrencyFlags::numConcurrentEvents() );
+      m_buffers.assign( nSlots, std::vector<std::byte>( m_blocksPerEvent * m_blockSize ) );
+      if ( m_registerBuffers ) {
+        std::vector<std::span<std::byte>> buffers{ m_buffers.begin(), m_buffers.end() };
+        return m_fileSvc->registerBuffers( std::move( buffers ) );
+      }
+      return StatusCode::SUCCESS;
+    } );
+  }
+
+  StatusCode finalize() override {
+    if ( m_fd >= 0 ) m_fileSvc->close( m_fd, name() ).ignore();
+    m_fd = -1;
+    return CoroutineAlgorithm::finalize();
+  }
+
+  Gaudi::Coroutine::Task executeAsync( const EventContext& ctx ) const override {
+    const std::size_t slot   = ctx.valid() ? ctx.slot() : 0;
+    auto&             buffer = m_buffers[slot];
+
+    // spread the blocks of an event over the whole file
+    std::vector<IAsyncFileSvc::ReadRequest> requests;
+    requests.reserve( m_blocksPerEvent );
+    for ( std::size_t i = 0; i < m_blocksPerEvent; ++i ) {
+      const std::size_t block = ( ctx.evt() * m_blocksPerEvent + i ) * 7919 % m_nBlocks;
+      requests.push_back( { m_fd, block * m_blockSize,
+                            std::span<std::byte>{ buffer.data() + i * m_blockSize, m_blockSize },
+                            m_registerBuffers ? static_cast<int>( slot ) : -1 } );
+    }
+
+    const auto results = co_await read( *m_fileSvc, requests );
+
+    // we may be on another thread now
+    if ( Gaudi::Hive::currentContext().slot() != ctx.slot() ) {
+      ++m_wrongContext;
+      co_return StatusCode::FAILURE;
+    }
+    for ( std::size_t i = 0; i < results.size(); ++i ) {
+      if ( results[i] != static_cast<std::int64_t>( m_blockSize ) ) {
+        ++m_readErrors;
+        continue;
+      }
+      const auto& r    = requests[i];
+      const bool  good = std::ranges::all_of( std::views::iota( std::size_t{ 0 }, r.buffer.size() ), [&]( auto j ) {
+        return std::to_integer<unsigned>( r.buffer[j] ) == ( r.offset + j ) % 251;
+      } );
+      if ( !good ) ++m_corrupted;
+      m_bytes += results[i];
+    }
+    co_return StatusCode::SUCCESS;
+  }
+
+private:
+  ServiceHandle<IAsyncFileSvc> m_fileSvc{ this, "AsyncFileSvc", "AsyncFileSvc", "Service used to read the file" };
+
+  Gaudi::Property<std::string> m_fileName{ this, "FileName", "", "File to read" };
+  Gaudi::Property<std::size_t> m_blockSize{ this, "BlockSize", 4096, "Size (in bytes) of the blocks read" };
+  Gaudi::Property<std::size_t> m_blocksPerEvent{ this, "BlocksPerEvent", 16, "Number of blocks read per event" };
+  Gaudi::Property<bool>        m_registerBuffers{ this, "RegisterBuffers", true,
+                                          "Register the destination buffers in the AsyncFileSvc" };
+
+  Io::Fd      m_fd      = -1;
+  std::size_t m_nBlocks = 0;
+  /// destination of the reads, one buffer per event slot
+  mutable std::vector<std::vector<std::byte>> m_buffers;
+
+  mutable Gaudi::Accumulators::Counter<> m_bytes{ this, "Bytes read" };
+  mutable Gaudi::Accumulators::Counter<> m_readErrors{ this, "Read errors" };
+  mutable Gaudi::Accumulators::Counter<> m_corrupted{ this, "Corrupted blocks" };
+  mutable Gaudi::Accumulators::Counter<> m_wrongContext{ this, "Wrong context after resume" };
+};
+
+DECLARE_COMPONENT( AsyncFileReader )
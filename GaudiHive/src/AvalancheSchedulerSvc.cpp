@@ -414,6 +414,26 @@ StatusCode AvalancheSchedulerSvc::initialize() {
   // Simulate execution flow
   if ( m_simulateExecution ) sc = m_precSvc->simulate( m_eventSlots[0] );
 
+  if ( m_slowEventThreshold > 0 || m_slowAlgThreshold > 0 ) {
+    info() << "Starting the slow event watchdog (events: " << m_slowEventThreshold
+           << "s, algorithms: " << m_slowAlgThreshold << "s)" << endmsg;
+    SlowEventWatchdog::Config config;
+    config.eventThreshold = SlowEventWatchdog::duration( m_slowEventThreshold );
+    config.algThreshold   = SlowEventWatchdog::duration( m_slowAlgThreshold );
+    config.period         = SlowEventWatchdog::duration( m_watchdogPeriod );
+    config.stackTrace     = m_watchdogStackTrace;
+    config.eventsFile     = m_slowEventsFile;
+    // the state is dumped by the scheduler thread, which owns the slots, if the event is still there
+    auto dumpSlot = [this]( unsigned int slot ) {
+      m_actionsQueue.push( [this, slot]() {
+        if ( !m_eventSlots[slot].complete ) dumpSchedulerState( slot );
+        return StatusCode::SUCCESS;
+      } );
+    };
+    m_watchdog = std::make_unique<SlowEventWatchdog>( std::move( config ), m_maxEventsInFlight, m_algname_vect,
+                                                      msgSvc(), std::move( dumpSlot ) );
+  }
+
   return sc;
 }
 //---------------------------------------------------------------------------
@@ -426,6 +446,8 @@ StatusCode AvalancheSchedulerSvc::finalize() {
   StatusCode sc( Service::finalize() );
   if ( sc.isFailure() ) warning() << "Base class could not be finalized" << endmsg;
 
+  m_watchdog.reset();
+
   sc = deactivate();
   if ( sc.isFailure() ) warning() << "Scheduler could not be deactivated" << endmsg;
 
@@ -558,6 +580,8 @@ StatusCode AvalancheSchedulerSvc::pushNewEvent( EventContext* eventContext ) {
   // no problem as push new event is only called from one thread (event loop manager)
   --m_freeSlots;
 
+  if ( m_watchdog ) m_watchdog->eventStarted( *eventContext );
+
   auto action = [this, eventContext]() -> StatusCode {
     // Event processing slot forced to be the same as the wb slot
     const unsigned int thisSlotNum = eventContext->slot();
@@ -764,6 +788,7 @@ StatusCode AvalancheSchedulerSvc::iterate() {
          !thisSlot.complete ) {
 
       thisSlot.complete = true;
+      if ( m_watchdog ) m_watchdog->eventFinished( iSlot );
       // if the event did not fail, add it to the finished events
       // otherwise it is taken care of in the error handling
       if ( m_algExecStateSvc->eventStatus( *thisSlot.eventContext ) == EventStatus::Success ) {
@@ -868,6 +893,7 @@ void AvalancheSchedulerSvc::eventFailed( EventContext* eventContext ) {
 
   // Push into the finished events queue the failed context
   m_eventSlots[slotIdx].complete = true;
+  if ( m_watchdog ) m_watchdog->eventFinished( slotIdx );
   m_finishedEvents.push( m_eventSlots[slotIdx].eventContext.release() );
 }
 
@@ -939,6 +965,10 @@ void AvalancheSchedulerSvc::dumpSchedulerState( int iSlot ) {
     }
   }
 
+  if ( const auto nSuspended = m_coroutineExecutor.nSuspended(); nSuspended > 0 ) {
+    outputMS << "\nSuspended coroutine algorithms (waiting for asynchronous operations): " << nSuspended << "\n";
+  }
+
   //===========================================================================
 
   outputMS << "\n---------------------------- Task/CF/FSM Mapping "
@@ -1130,6 +1160,9 @@ StatusCode AvalancheSchedulerSvc::scheduleEventView( const EventContext* sourceC
 
   ON_VERBOSE verbose() << "Queuing a view for [" << viewContext.get() << "]" << endmsg;
 
+  // Allocate the states of the algorithms in the view now, so that they are accessed without locking
+  if ( viewContext ) m_algExecStateSvc->allocateSubSlot( *viewContext );
+
   // It's not possible to create an std::functional from a move-capturing lambda
   // So, we have to release the unique pointer
   auto action = [this, slotIndex = sourceContext->slot(), viewContextPtr = viewContext.release(),
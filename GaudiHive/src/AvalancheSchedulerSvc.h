@@ -15,8 +15,10 @@
 #include "EventSlot.h"
 #include "FiberManager.h"
 #include "PrecedenceSvc.h"
+#include "SlowEventWatchdog.h"
 
 // Framework include files
+#include <Gaudi/Coroutine.h>
 #include <GaudiKernel/IAlgExecStateSvc.h>
 #include <GaudiKernel/IAlgResourcePool.h>
 #include <GaudiKernel/ICondSvc.h>
@@ -25,6 +27,7 @@
 #include <GaudiKernel/IScheduler.h>
 #include <GaudiKernel/IThreadPoolSvc.h>
 #include <GaudiKernel/Service.h>
+#include <GaudiKernel/ThreadLocalContext.h>
 
 // C++ include files
 #include <functional>
@@ -233,6 +236,19 @@ private:
       this, "DataDepsGraphObjectPattern", ".*",
       "Regex pattern for selecting desired input or output by their full key" };
 
+  Gaudi::Property<double>      m_slowEventThreshold{
+      this, "SlowEventThreshold", 0,
+      "Number of seconds after which an event in flight is reported by the watchdog (0 to disable)" };
+  Gaudi::Property<double>      m_slowAlgThreshold{
+      this, "SlowAlgorithmThreshold", 0,
+      "Number of seconds after which an algorithm execution is reported by the watchdog (0 to disable)" };
+  Gaudi::Property<double>      m_watchdogPeriod{ this, "WatchdogPeriod", 1,
+                                                 "Number of seconds between two checks of the watchdog" };
+  Gaudi::Property<bool>        m_watchdogStackTrace{
+      this, "WatchdogStackTrace", true, "Sample the stacks of the threads running the reported algorithms" };
+  Gaudi::Property<std::string> m_slowEventsFile{ this, "SlowEventsFile", "",
+                                                 "Name of the file where the watchdog records the slow events" };
+
   // Utils and shortcuts ----------------------------------------------------
 
   /// Activate scheduler
@@ -368,9 +384,33 @@ private:
   tbb::task_arena*              m_arena{ nullptr };
   std::unique_ptr<FiberManager> m_fiberManager{ nullptr };
 
+  /// Executor resuming the suspended Gaudi::CoroutineAlgorithm executions as tasks of the TBB arena
+  class CoroutineExecutor : public Gaudi::Coroutine::Executor {
+  public:
+    CoroutineExecutor( AvalancheSchedulerSvc* scheduler ) : m_scheduler( scheduler ) {}
+    void post( std::function<void()> resume ) override {
+      --m_suspended;
+      m_scheduler->m_arena->enqueue( [resume = std::move( resume )]() {
+        resume();
+        // as at the end of AlgTask, do not leave the context of the coroutine to the next task of the worker
+        Gaudi::Hive::setCurrentContextEvt( -1 );
+      } );
+    }
+    void         suspended() override { ++m_suspended; }
+    unsigned int nSuspended() const { return m_suspended; }
+
+  private:
+    AvalancheSchedulerSvc*    m_scheduler;
+    std::atomic<unsigned int> m_suspended{ 0 };
+  };
+  CoroutineExecutor m_coroutineExecutor{ this };
+
   size_t m_maxEventsInFlight{ 0 };
   size_t m_maxAlgosInFlight{ 1 };
 
+  /// Watchdog reporting the slow events and algorithm executions (if enabled)
+  std::unique_ptr<SlowEventWatchdog> m_watchdog;
+
 public:
   // get next schedule-able TaskSpec
   bool next( TaskSpec& ts, bool asynchronous ) {
@@ -0,0 +1,69 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include <Gaudi/Accumulators.h>
+#include <Gaudi/CoroutineAlgorithm.h>
+#include <GaudiKernel/DataObjectHandle.h>
+#include <GaudiKernel/ThreadLocalContext.h>
+
+#include <chrono>
+
+/** Test algorithm suspending (without blocking a thread) for a given time, then checking that the event context
+ *  was restored and registering its outputs.
+ */
+class CoroutineSleeper : public Gaudi::CoroutineAlgorithm {
+public:
+  using CoroutineAlgorithm::CoroutineAlgorithm;
+
+  StatusCode initialize() override {
+    return CoroutineAlgorithm::initialize().andThen( [&] {
+      int i = 0;
+      for ( const auto& k : m_inputs ) {
+        m_inputHandles.emplace_back(
+            std::make_unique<DataObjectHandle<DataObject>>( k, Gaudi::DataHandle::Reader, this ) );
+        declareProperty( "dummy_in_" + std::to_string( i++ ), *( m_inputHandles.back() ) );
+      }
+      i = 0;
+      for ( const auto& k : m_outputs ) {
+        m_outputHandles.emplace_back(
+            std::make_unique<DataObjectHandle<DataObject>>( k, Gaudi::DataHandle::Writer, this ) );
+        declareProperty( "dummy_out_" + std::to_string( i++ ), *( m_outputHandles.back() ) );
+      }
+    } );
+  }
+
+  Gaudi::Coroutine::Task executeAsync( const EventContext& ctx ) const override {
+    for ( auto& handle : m_inputHandles ) handle->get();
+
+    co_await Gaudi::Coroutine::sleep_for( std::chrono::duration<double, std::milli>( m_sleepTime.value() ) );
+
+    // we may be on another thread now
+    if ( Gaudi::Hive::currentContext().slot() != ctx.slot() ) {
+      ++m_wrongContext;
+      co_return StatusCode::FAILURE;
+    }
+    for ( auto& handle : m_outputHandles ) handle->put( std::make_unique<DataObject>() );
+    ++m_executions;
+    co_return StatusCode::SUCCESS;
+  }
+
+private:
+  Gaudi::Property<double> m_sleepTime{ this, "SleepTime", 10., "Time (in ms) spent waiting in each execution" };
+  Gaudi::Property<std::vector<std::string>> m_inputs{ this, "Inputs", {}, "List of required inputs" };
+  Gaudi::Property<std::vector<std::string>> m_outputs{ this, "Outputs", {}, "List of provided outputs" };
+
+  std::vector<std::unique_ptr<DataObjectHandle<DataObject>>> m_inputHandles;
+  std::vector<std::unique_ptr<DataObjectHandle<DataObject>>> m_outputHandles;
+
+  mutable Gaudi::Accumulators::Counter<> m_executions{ this, "Executions" };
+  mutable Gaudi::Accumulators::Counter<> m_wrongContext{ this, "Wrong context after resume" };
+};
+
+DECLARE_COMPONENT( CoroutineSleeper )
@@ -1,5 +1,5 @@
 /***********************************************************************************\
-* (c) Copyright 1998-2025 CERN for the benefit of the LHCb and ATLAS collaborations *
+* (c) Copyright 1998-2026 CERN for the benefit of the LHCb and ATLAS collaborations *
 *                                                                                   *
 * This software is distributed under the terms of the Apache version 2 licence,     *
 * copied verbatim in the file "LICENSE".                                            *
@@ -14,18 +14,45 @@
 #include <GaudiKernel/StatusCode.h>
 
 // Framework includes
+#include <Gaudi/ReplayRecord.h>
 #include <GaudiKernel/AppReturnCode.h>
 #include <GaudiKernel/DataObject.h>
 #include <GaudiKernel/DataSvc.h>
 #include <GaudiKernel/EventContext.h>
+#include <GaudiKernel/IAlgManager.h>
+#include <GaudiKernel/IRndmEngine.h>
 #include <GaudiKernel/Incident.h>
+#include <GaudiKernel/ThreadLocalContext.h>
+#include <GaudiKernel/TypeNameString.h>
 
 // External libraries
 #include <chrono>
+#include <cstdint>
+#include <vector>
 
 // Instantiation of a static factory class used by clients to create instances of this service
 DECLARE_COMPONENT( HiveSlimEventLoopMgr )
 
+namespace {
+  /// Seeds of the random number engine for an event, from its run and event numbers if known, otherwise from its
+  /// number in the job. They are positive 31 bits values: a 0 would end the list of seeds of the HepRndm engines.
+  std::vector<long> eventSeeds( const EventContext& ctx ) {
+    const auto&   id = ctx.eventID();
+    std::uint64_t x  = id.isValid() ? ( std::uint64_t{ id.run_number() } << 32 ) ^ id.event_number() : ctx.evt();
+    std::vector<long> seeds;
+    for ( int i = 0; i < 2; ++i ) {
+      // splitmix64
+      x += 0x9e3779b97f4a7c15ULL;
+      std::uint64_t z = x;
+      z               = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+      z               = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebULL;
+      z ^= z >> 31;
+      seeds.push_back( static_cast<long>( z & 0x7fffffff ) | 1 );
+    }
+    return seeds;
+  }
+} // namespace
+
 #define ON_DEBUG if ( msgLevel( MSG::DEBUG ) )
 #define DEBUG_MSG ON_DEBUG debug()
 
@@ -128,6 +155,39 @@ StatusCode HiveSlimEventLoopMgr::initialize() {
   std::sort( m_eventNumberBlacklist.begin(), m_eventNumberBlacklist.end() );
   info() << "Found " << m_eventNumberBlacklist.size() << " events in black list" << endmsg;
 
+  // Setup the capture of events for replay
+  if ( !m_replayCaptureStream.empty() ) {
+    if ( m_replayReseed && m_whiteboard->getNumberOfStores() > 1 ) {
+      // the engine is shared: reseeding it for a new event would change the numbers of the events in flight
+      error() << "ReplayReseed requires a single event slot, not " << m_whiteboard->getNumberOfStores() << endmsg;
+      return StatusCode::FAILURE;
+    }
+    m_evtDataSvc = m_evtDataMgrSvc;
+    if ( !m_evtDataSvc ) {
+      fatal() << "Error retrieving EventDataSvc interface IDataProviderSvc." << endmsg;
+      return StatusCode::FAILURE;
+    }
+    auto                         algMan = serviceLocator()->as<IAlgManager>();
+    Gaudi::Utils::TypeNameString item( m_replayCaptureStream );
+    IAlgorithm*                  ialg = nullptr;
+    sc                                = algMan->createAlgorithm( item.type(), item.name(), ialg );
+    if ( !sc.isSuccess() ) {
+      error() << "Unable to create replay capture stream " << m_replayCaptureStream.value() << endmsg;
+      return sc;
+    }
+    m_replayStream = ialg;
+    sc             = m_replayStream->sysInitialize();
+    if ( !sc.isSuccess() ) {
+      error() << "Unable to initialize replay capture stream " << m_replayStream->name() << endmsg;
+      return sc;
+    }
+    m_slotSeeds.resize( m_whiteboard->getNumberOfStores() );
+    std::sort( m_replayCaptureEvents.begin(), m_replayCaptureEvents.end() );
+    info() << "Events captured for replay by " << m_replayStream->name() << ": "
+           << ( m_replayCaptureFailed ? "failed events and " : "" ) << m_replayCaptureEvents.size()
+           << " requested events" << endmsg;
+  }
+
   return StatusCode::SUCCESS;
 }
 //--------------------------------------------------------------------------------------------
@@ -187,6 +247,21 @@ StatusCode HiveSlimEventLoopMgr::reinitialize() {
   return StatusCode::SUCCESS;
 }
 
+//--------------------------------------------------------------------------------------------
+// implementation of IService::start
+//--------------------------------------------------------------------------------------------
+StatusCode HiveSlimEventLoopMgr::start() {
+  StatusCode sc = Service::start();
+  if ( !sc.isSuccess() ) return sc;
+  if ( m_replayStream ) {
+    // the random number service, if used, is instantiated by now
+    m_rndmGenSvc = serviceLocator()->service( "RndmGenSvc", false );
+    sc           = m_replayStream->sysStart();
+    if ( !sc.isSuccess() ) error() << "Unable to start replay capture stream " << m_replayStream->name() << endmsg;
+  }
+  return sc;
+}
+
 //--------------------------------------------------------------------------------------------
 // implementation of IService::stop
 //--------------------------------------------------------------------------------------------
@@ -197,6 +272,9 @@ StatusCode HiveSlimEventLoopMgr::stop() {
     m_incidentSvc->fireIncident( Incident( name(), IncidentType::EndEvent ) );
     m_endEventFired = true;
   }
+  if ( m_replayStream && m_replayStream->sysStop().isFailure() ) {
+    warning() << "Problems stopping replay capture stream " << m_replayStream->name() << endmsg;
+  }
   return StatusCode::SUCCESS;
 }
 
@@ -250,6 +328,20 @@ StatusCode HiveSlimEventLoopMgr::finalize() {
     m_evtContext = nullptr;
   }
 
+  // Close the replay capture stream
+  if ( m_replayStream ) {
+    if ( m_replayStream->sysFinalize().isFailure() ) {
+      scRet = StatusCode::FAILURE;
+      warning() << "Finalization of replay capture stream " << m_replayStream->name() << " failed" << endmsg;
+    }
+    if ( serviceLocator()->as<IAlgManager>()->removeAlgorithm( m_replayStream ).isFailure() ) {
+      warning() << "Problems removing replay capture stream " << m_replayStream->name() << endmsg;
+    }
+    m_replayStream.reset();
+  }
+  m_rndmGenSvc.reset();
+  m_evtDataSvc.reset();
+
   m_incidentSvc.reset();
 
   // Release all interfaces...
@@ -291,6 +383,20 @@ StatusCode HiveSlimEventLoopMgr::executeEvent( EventContext&& ctx ) {
     return StatusCode::SUCCESS;
   }
 
+  // Reseed the random number engine from the event, and keep the seeds in case the event has to be captured for
+  // replay (the engine only reports the seeds it was last given, not its current state)
+  if ( m_replayStream ) {
+    auto& seeds = m_slotSeeds[ctx.slot()];
+    seeds.clear();
+    if ( m_rndmGenSvc && m_replayReseed ) {
+      seeds = eventSeeds( ctx );
+      if ( m_rndmGenSvc->engine()->setSeeds( seeds ).isFailure() ) {
+        warning() << "Cannot reseed the random number engine for event " << ctx.evt() << endmsg;
+        seeds.clear();
+      }
+    }
+  }
+
   // Fire BeginEvent "Incident"
   m_incidentSvc->fireIncident( std::make_unique<Incident>( name(), IncidentType::BeginEvent, ctx ) );
 
@@ -533,10 +639,20 @@ StatusCode HiveSlimEventLoopMgr::drainScheduler( int& finishedEvts ) {
       finalSC = StatusCode::FAILURE;
       continue;
     }
-    if ( m_algExecStateSvc->eventStatus( *thisFinishedEvtContext ) != EventStatus::Success ) {
+    const bool failed = m_algExecStateSvc->eventStatus( *thisFinishedEvtContext ) != EventStatus::Success;
+    if ( failed ) {
       ( m_abortOnFailure ? fatal() : error() ) << "Failed event detected on " << thisFinishedEvtContext << endmsg;
       if ( m_abortOnFailure ) finalSC = StatusCode::FAILURE;
     }
+    if ( m_replayStream ) {
+      const bool requested = std::binary_search( m_replayCaptureEvents.begin(), m_replayCaptureEvents.end(),
+                                                 thisFinishedEvtContext->evt() );
+      if ( ( failed && m_replayCaptureFailed ) || requested ) {
+        if ( captureEvent( *thisFinishedEvtContext, failed ? "failed" : "requested" ).isFailure() ) {
+          error() << "Event " << thisFinishedEvtContext->evt() << " could not be captured for replay" << endmsg;
+        }
+      }
+    }
     // shouldn't these incidents move to the forward scheduler?
     // If we want to consume incidents with an algorithm at the end of the graph
     // we need to add this to forward scheduler lambda action,
@@ -560,6 +676,28 @@ StatusCode HiveSlimEventLoopMgr::drainScheduler( int& finishedEvts ) {
 
 //---------------------------------------------------------------------------
 
+StatusCode HiveSlimEventLoopMgr::captureEvent( const EventContext& ctx, const std::string& reason ) {
+  // the stream runs on this thread, on the store and with the context of the finished event
+  StatusCode sc = m_whiteboard->selectStore( ctx.slot() );
+  if ( sc.isFailure() ) return sc;
+  const EventContext previousCtx = Gaudi::Hive::currentContext();
+  Gaudi::Hive::setCurrentContext( ctx );
+
+  auto record = std::make_unique<Gaudi::ReplayRecord>( ctx, m_slotSeeds[ctx.slot()], reason );
+  sc          = m_evtDataSvc->registerObject( Gaudi::ReplayRecord::location(), record.get() );
+  if ( sc.isSuccess() ) {
+    record.release(); // owned by the event store
+    m_algExecStateSvc->algExecState( m_replayStream, ctx ).setFilterPassed( true );
+    sc = m_replayStream->sysExecute( ctx );
+    if ( sc.isSuccess() ) info() << "Event " << ctx.evt() << " (" << reason << ") captured for replay" << endmsg;
+  }
+
+  Gaudi::Hive::setCurrentContext( previousCtx );
+  return sc;
+}
+
+//---------------------------------------------------------------------------
+
 StatusCode HiveSlimEventLoopMgr::clearWBSlot( int evtSlot ) {
   StatusCode sc = m_whiteboard->clearStore( evtSlot );
   if ( !sc.isSuccess() ) warning() << "Clear of Event data store failed" << endmsg;
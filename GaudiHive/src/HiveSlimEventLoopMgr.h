@@ -1,5 +1,5 @@
 /***********************************************************************************\
-* (c) Copyright 1998-2025 CERN for the benefit of the LHCb and ATLAS collaborations *
+* (c) Copyright 1998-2026 CERN for the benefit of the LHCb and ATLAS collaborations *
 *                                                                                   *
 * This software is distributed under the terms of the Apache version 2 licence,     *
 * copied verbatim in the file "LICENSE".                                            *
@@ -13,11 +13,14 @@
 // Framework include files
 #include <GaudiKernel/IAlgExecStateSvc.h>
 #include <GaudiKernel/IAlgResourcePool.h>
+#include <GaudiKernel/IAlgorithm.h>
 #include <GaudiKernel/IDataManagerSvc.h>
+#include <GaudiKernel/IDataProviderSvc.h>
 #include <GaudiKernel/IEvtSelector.h>
 #include <GaudiKernel/IHiveWhiteBoard.h>
 #include <GaudiKernel/IIncidentListener.h>
 #include <GaudiKernel/IIncidentSvc.h>
+#include <GaudiKernel/IRndmGenSvc.h>
 #include <GaudiKernel/IScheduler.h>
 #include <GaudiKernel/MinimalEventLoopMgr.h>
 #include <GaudiKernel/SmartIF.h>
@@ -27,6 +30,8 @@
 
 // STL
 #include <memory>
+#include <string>
+#include <vector>
 
 class HiveSlimEventLoopMgr : public extends<Service, IEventProcessor> {
 
@@ -39,6 +44,20 @@ protected:
   Gaudi::Property<std::vector<unsigned int>> m_eventNumberBlacklist{ this, "EventNumberBlackList", {}, "" };
   Gaudi::Property<bool> m_abortOnFailure{ this, "AbortOnFailure", true, "Abort job on event failure" };
 
+  Gaudi::Property<std::string> m_replayCaptureStream{
+      this, "ReplayCaptureStream", "",
+      "Type/Name of the output stream writing the events captured for replay (e.g. InputCopyStream/ReplayCapture), "
+      "its ItemList must include the replay record (/Event/ReplayRecord#1); no capture if empty" };
+  Gaudi::Property<bool> m_replayCaptureFailed{ this, "ReplayCaptureFailed", true,
+                                               "Capture for replay the events that failed" };
+  Gaudi::Property<std::vector<unsigned int>> m_replayCaptureEvents{
+      this, "ReplayCaptureEvents", {}, "Numbers of the events to capture for replay (e.g. from a SlowEventsFile)" };
+  Gaudi::Property<bool> m_replayReseed{
+      this, "ReplayReseed", false,
+      "When capturing, reseed the random number engine at the beginning of each event from its run and event "
+      "numbers, so that a replay draws the same random numbers (this changes the random numbers of the job, and "
+      "requires a single event slot)" };
+
   /// Reference to the Event Data Service's IDataManagerSvc interface
   SmartIF<IDataManagerSvc> m_evtDataMgrSvc;
   /// Reference to the Event Selector
@@ -75,6 +94,17 @@ protected:
   /// Reference to the incident service
   SmartIF<IIncidentSvc> m_incidentSvc;
 
+  /// Output stream writing the events captured for replay
+  SmartIF<IAlgorithm> m_replayStream;
+  /// Reference to the Event Data Service's IDataProviderSvc interface (to record the captured events)
+  SmartIF<IDataProviderSvc> m_evtDataSvc;
+  /// Random number service, if any, whose seeds are recorded for the captured events
+  SmartIF<IRndmGenSvc> m_rndmGenSvc;
+  /// Seeds given to the random number engine at the beginning of the event in each slot (empty if not reseeded)
+  std::vector<std::vector<long>> m_slotSeeds;
+  /// Write the event to the replay capture stream, together with its Gaudi::ReplayRecord
+  StatusCode captureEvent( const EventContext& ctx, const std::string& reason );
+
   // if finite number of evts is processed use bitset
   std::unique_ptr<boost::dynamic_bitset<>> m_blackListBS;
 
@@ -92,6 +122,8 @@ public:
   StatusCode initialize() override;
   /// implementation of IService::reinitialize
   StatusCode reinitialize() override;
+  /// implementation of IService::start
+  StatusCode start() override;
   /// implementation of IService::stop
   StatusCode stop() override;
   /// implementation of IService::finalize
@@ -14,6 +14,7 @@
 //
 //====================================================================
 // Include files
+#include <Gaudi/Algorithm.h>
 #include <GaudiKernel/ConcurrencyFlags.h>
 #include <GaudiKernel/DataObjID.h>
 #include <GaudiKernel/DataObject.h>
@@ -24,13 +25,18 @@
 #include <GaudiKernel/TypeNameString.h>
 #include <Rtypes.h>
 #include <ThreadLocalStorage.h>
+#include <atomic>
 #include <boost/callable_traits.hpp>
+#include <memory>
 #include <mutex>
+#include <set>
 #include <tbb/concurrent_queue.h>
+#include <unordered_map>
 #include <utility>
 
 // Interfaces
 #include <GaudiKernel/IAddressCreator.h>
+#include <GaudiKernel/IAlgManager.h>
 #include <GaudiKernel/IConversionSvc.h>
 #include <GaudiKernel/IDataManagerSvc.h>
 #include <GaudiKernel/IDataProviderSvc.h>
@@ -111,6 +117,14 @@ namespace {
       return svc ? f( *svc ) : IDataProviderSvc::Status::INVALID_ROOT;
     } );
   }
+
+  /// Path of an object relative to the root of the store, the way DataSvc resolves it
+  /// ("/Event/A/B", "/Any/A/B" and "A/B" all refer to the same object).
+  std::string_view relativePath( std::string_view path ) {
+    if ( path.empty() || path.front() != '/' ) return path;
+    auto sep = path.find( '/', 1 );
+    return sep == std::string_view::npos ? std::string_view{} : path.substr( sep + 1 );
+  }
 } // namespace
 
 /**
@@ -136,6 +150,10 @@ protected:
   Gaudi::Property<bool>                     m_enableFaultHdlr{ this, "EnableFaultHandler", false,
                                            "enable incidents on data creation requests" };
   Gaudi::Property<std::vector<std::string>> m_inhibitPathes{ this, "InhibitPaths", {}, "inhibited leaves" };
+  Gaudi::Property<bool>                     m_indexObjects{
+      this, "IndexDataObjects", false,
+      "assign at start a dense index to the data objects declared by the algorithms, for direct access from the "
+      "data handles" };
 
   /// Pointer to data loader service
   SmartIF<IConversionSvc> m_dataLoader;
@@ -146,6 +164,34 @@ protected:
   /// fifo queue of free slots
   tbb::concurrent_queue<size_t> m_freeSlots;
 
+  /// Index of the known data objects (by path relative to the root)
+  std::unordered_map<std::string, size_t> m_objectIndex;
+  /// Per slot table of the indexed objects
+  std::vector<std::unique_ptr<std::atomic<DataObject*>[]>> m_indexedObjects;
+
+  /// Table of the indexed objects of the current slot
+  std::atomic<DataObject*>* currentIndexedObjects() const {
+    return ( s_current && !m_indexedObjects.empty() ) ? m_indexedObjects[s_current - m_partitions.data()].get()
+                                                      : nullptr;
+  }
+  /// Forget the indexed objects of a slot (to be called whenever objects may be removed from it)
+  void resetIndexedObjects( std::atomic<DataObject*>* objects ) {
+    if ( !objects ) return;
+    for ( size_t i = 0; i < m_objectIndex.size(); ++i ) objects[i].store( nullptr, std::memory_order_relaxed );
+  }
+  /// Call f on the current slot, then forget its indexed objects.
+  /// The table is reset after the removal and in the same critical section, so that no lookup can cache a pointer
+  /// to a removed object.
+  template <typename Fun>
+  StatusCode resetting( Fun f ) {
+    auto objects = currentIndexedObjects();
+    return fwd( [&]( std::decay_t<detail::argument_t<Fun>>& svc ) {
+      StatusCode sc = f( svc );
+      resetIndexedObjects( objects );
+      return sc;
+    } );
+  }
+
 public:
   /// Inherited constructor
   using extends::extends;
@@ -165,6 +211,43 @@ public:
   /// Get free slots number
   size_t freeSlots() override { return m_freeSlots.unsafe_size(); }
 
+  /// Get the index assigned at start to a data object (npos if not indexed)
+  size_t dataObjectIndex( const DataObjID& id ) const override {
+    // asked at every access by the handles of the objects that are not indexed
+    if ( m_objectIndex.empty() ) return std::string::npos;
+    auto i = m_objectIndex.find( std::string{ relativePath( id.key() ) } );
+    return i != m_objectIndex.end() ? i->second : std::string::npos;
+  }
+
+  /// Find an indexed object in the current store, looking it up by path (and caching it) the first time
+  StatusCode findIndexedObject( size_t index, std::string_view path, DataObject*& pObj ) override {
+    auto objects = currentIndexedObjects();
+    if ( !objects ) return IDataProviderSvc::Status::INVALID_ROOT;
+    pObj = objects[index].load( std::memory_order_acquire );
+    if ( pObj ) return StatusCode::SUCCESS;
+    // not registered through a handle (e.g. loaded from file or registered by path): cache it while holding the
+    // lock of the slot, so that it cannot be removed in between
+    return fwd( [&]( IDataProviderSvc& p ) {
+      auto sc = p.retrieveObject( path, pObj );
+      if ( sc.isSuccess() && pObj ) objects[index].store( pObj, std::memory_order_release );
+      return sc;
+    } );
+  }
+
+  /// Register an indexed object in the current store.
+  /// Only the lookups are lock-free: the registration goes through the store of the slot, under its lock.
+  StatusCode registerIndexedObject( size_t index, std::string_view path, DataObject* pObj ) override {
+    auto objects = currentIndexedObjects();
+    if ( !objects ) return IDataProviderSvc::Status::INVALID_ROOT;
+    // the store still owns the object and allows access by path; the object is published in the table only once
+    // registered, in the same critical section
+    return fwd( [&]( IDataProviderSvc& p ) {
+      auto sc = p.registerObject( path, pObj );
+      if ( sc.isSuccess() ) objects[index].store( pObj, std::memory_order_release );
+      return sc;
+    } );
+  }
+
   /// IDataManagerSvc: Accessor for root event CLID
   CLID rootCLID() const override { return (CLID)m_rootCLID; }
   /// Name for root Event
@@ -180,11 +263,11 @@ public:
   }
   /// IDataManagerSvc: Unregister object address from the data store.
   StatusCode unregisterAddress( std::string_view path ) override {
-    return fwd( [&]( IDataManagerSvc& p ) { return p.unregisterAddress( path ); } );
+    return resetting( [&]( IDataManagerSvc& p ) { return p.unregisterAddress( path ); } );
   }
   /// IDataManagerSvc: Unregister object address from the data store.
   StatusCode unregisterAddress( IRegistry* pParent, std::string_view path ) override {
-    return fwd( [&]( IDataManagerSvc& p ) { return p.unregisterAddress( pParent, path ); } );
+    return resetting( [&]( IDataManagerSvc& p ) { return p.unregisterAddress( pParent, path ); } );
   }
   /// Explore the object store: retrieve all leaves attached to the object
   StatusCode objectLeaves( const DataObject* pObject, std::vector<IRegistry*>& leaves ) override {
@@ -204,15 +287,15 @@ public:
   }
   /// Remove all data objects below the sub tree identified
   StatusCode clearSubTree( std::string_view path ) override {
-    return fwd( [&]( IDataManagerSvc& p ) { return p.clearSubTree( path ); } );
+    return resetting( [&]( IDataManagerSvc& p ) { return p.clearSubTree( path ); } );
   }
   /// Remove all data objects below the sub tree identified
   StatusCode clearSubTree( DataObject* pObject ) override {
-    return fwd( [&]( IDataManagerSvc& p ) { return p.clearSubTree( pObject ); } );
+    return resetting( [&]( IDataManagerSvc& p ) { return p.clearSubTree( pObject ); } );
   }
   /// IDataManagerSvc: Remove all data objects in the data store.
   StatusCode clearStore() override {
-    for_( m_partitions, []( Partition& p ) { p.dataManager->clearStore().ignore(); } );
+    for ( size_t i = 0; i < m_partitions.size(); ++i ) clearStore( i ).ignore();
     return StatusCode::SUCCESS;
   }
 
@@ -231,14 +314,14 @@ public:
   /** Initialize data store for new event by giving new event path and root
       object. Takes care to clear the store before reinitializing it  */
   StatusCode setRoot( std::string path, DataObject* pObj ) override {
-    return fwd(
+    return resetting(
         [pObj, path = std::move( path )]( IDataManagerSvc& p ) { return p.setRoot( std::move( path ), pObj ); } );
   }
 
   /** Initialize data store for new event by giving new event path and address
       of root object. Takes care to clear the store before reinitializing it */
   StatusCode setRoot( std::string path, IOpaqueAddress* pAddr ) override {
-    return fwd(
+    return resetting(
         [pAddr, path = std::move( path )]( IDataManagerSvc& p ) { return p.setRoot( std::move( path ), pAddr ); } );
   }
 
@@ -288,15 +371,15 @@ public:
   }
   /// Unregister object from the data store.
   StatusCode unregisterObject( std::string_view path ) override {
-    return fwd( [&]( IDataProviderSvc& p ) { return p.unregisterObject( path ); } );
+    return resetting( [&]( IDataProviderSvc& p ) { return p.unregisterObject( path ); } );
   }
   /// Unregister object from the data store.
   StatusCode unregisterObject( DataObject* pObj ) override {
-    return fwd( [&]( IDataProviderSvc& p ) { return p.unregisterObject( pObj ); } );
+    return resetting( [&]( IDataProviderSvc& p ) { return p.unregisterObject( pObj ); } );
   }
   /// Unregister object from the data store.
   StatusCode unregisterObject( DataObject* pObj, std::string_view path ) override {
-    return fwd( [&]( IDataProviderSvc& p ) { return p.unregisterObject( pObj, path ); } );
+    return resetting( [&]( IDataProviderSvc& p ) { return p.unregisterObject( pObj, path ); } );
   }
   /// Retrieve object from data store.
   StatusCode retrieveObject( IRegistry* parent, std::string_view path, DataObject*& pObj ) override {
@@ -320,15 +403,15 @@ public:
   }
   /// Remove a link to another object.
   StatusCode unlinkObject( IRegistry* from, std::string_view objPath ) override {
-    return fwd( [&]( IDataProviderSvc& p ) { return p.unlinkObject( from, objPath ); } );
+    return resetting( [&]( IDataProviderSvc& p ) { return p.unlinkObject( from, objPath ); } );
   }
   /// Remove a link to another object.
   StatusCode unlinkObject( DataObject* from, std::string_view objPath ) override {
-    return fwd( [&]( IDataProviderSvc& p ) { return p.unlinkObject( from, objPath ); } );
+    return resetting( [&]( IDataProviderSvc& p ) { return p.unlinkObject( from, objPath ); } );
   }
   /// Remove a link to another object.
   StatusCode unlinkObject( std::string_view path ) override {
-    return fwd( [&]( IDataProviderSvc& p ) { return p.unlinkObject( path ); } );
+    return resetting( [&]( IDataProviderSvc& p ) { return p.unlinkObject( path ); } );
   }
   /// Update object identified by its directory entry.
   StatusCode updateObject( IRegistry* pDirectory ) override {
@@ -345,7 +428,11 @@ public:
 
   /// Remove all data objects in one 'slot' of the data store.
   StatusCode clearStore( size_t partition ) override {
-    return m_partitions[partition].with_lock( []( Partition& p ) { return p.dataManager->clearStore(); } );
+    return m_partitions[partition].with_lock( [&]( Partition& p ) {
+      auto sc = p.dataManager->clearStore();
+      if ( !m_indexedObjects.empty() ) resetIndexedObjects( m_indexedObjects[partition].get() );
+      return sc;
+    } );
   }
 
   /// Activate a partition object. The  identifies the partition uniquely.
@@ -427,6 +514,30 @@ public:
     return sc;
   }
 
+  /// Assign an index to all the data objects declared by the algorithms and allocate the per slot tables.
+  void buildObjectIndex() {
+    auto algMgr = serviceLocator()->as<IAlgManager>();
+    // sort the paths to get reproducible indices
+    std::set<std::string> paths;
+    for ( IAlgorithm* ialg : algMgr->getAlgorithms() ) {
+      auto alg = dynamic_cast<Gaudi::Algorithm*>( ialg );
+      if ( !alg ) continue;
+      for ( const auto* ids :
+            { &alg->inputDataObjs(), &alg->outputDataObjs(), &alg->extraInputDeps(), &alg->extraOutputDeps() } ) {
+        for ( const DataObjID& id : *ids ) {
+          if ( auto path = relativePath( id.key() ); !path.empty() ) paths.emplace( path );
+        }
+      }
+    }
+    m_objectIndex.clear();
+    for ( auto& path : paths ) m_objectIndex.emplace( path, m_objectIndex.size() );
+    m_indexedObjects.clear();
+    for ( size_t i = 0; i < m_slots; ++i ) {
+      m_indexedObjects.push_back( std::make_unique<std::atomic<DataObject*>[]>( m_objectIndex.size() ) );
+    }
+    debug() << "Indexed " << m_objectIndex.size() << " data objects" << endmsg;
+  }
+
   StatusCode detachServices() {
     m_addrCreator.reset();
     m_dataLoader.reset();
@@ -497,10 +608,21 @@ public:
     return StatusCode::SUCCESS;
   }
 
+  /// Service start
+  StatusCode start() override {
+    StatusCode sc = Service::start();
+    if ( !sc.isSuccess() ) return sc;
+    // the indices are cached by the data handles, so they must not change afterwards
+    if ( m_indexObjects && m_indexedObjects.empty() ) buildObjectIndex();
+    return StatusCode::SUCCESS;
+  }
+
   /// Service initialisation
   StatusCode finalize() override {
     setDataLoader( 0 ).ignore();
     clearStore().ignore();
+    m_indexedObjects.clear();
+    m_objectIndex.clear();
     return Service::finalize();
   }
 };
@@ -0,0 +1,279 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include "SlowEventWatchdog.h"
+
+#include <GaudiKernel/MsgStream.h>
+#include <GaudiKernel/System.h>
+
+#include <algorithm>
+#include <csignal>
+#include <format>
+#include <sstream>
+
+namespace {
+  /// identifier of the next watchdog instance
+  std::atomic<unsigned int> s_nextInstance{ 1 };
+
+  /// stack sampled by the signal handler
+  constexpr int s_maxDepth = 64;
+  void*         s_frames[s_maxDepth];
+  int           s_nFrames = 0;
+  /// sequence number of the pending sample request (0 if none), and thread to sample
+  std::atomic<unsigned int> s_request{ 0 };
+  std::atomic<pthread_t>    s_target{};
+  /// sequence number of the last request served by a handler
+  std::atomic<unsigned int> s_served{ 0 };
+  /// sequence number of the last request (only used by the watchdog thread)
+  unsigned int s_lastRequest = 0;
+
+  void sampleHandler( int ) {
+    // only the handler running in the target thread for the pending request fills the stack, taking the request
+    // (a late handler of a request given up by the watchdog finds no request or one for another thread)
+    unsigned int seq = s_request.load( std::memory_order_acquire );
+    if ( !seq || !pthread_equal( s_target.load( std::memory_order_acquire ), pthread_self() ) ||
+         !s_request.compare_exchange_strong( seq, 0, std::memory_order_acq_rel ) ) {
+      return;
+    }
+    // backtrace() is preloaded in the watchdog thread, so that it does not allocate here
+    s_nFrames = System::backTrace( s_frames, s_maxDepth );
+    s_served.store( seq, std::memory_order_release );
+  }
+
+  /// signal used to interrupt the threads to sample
+  int sampleSignal() { return SIGRTMIN + 4; }
+
+  /// runner of the current thread, with the instance of the watchdog it belongs to
+  thread_local std::pair<unsigned int, void*> t_runner{ 0, nullptr };
+
+  std::string eventDescription( const EventContext& ctx ) {
+    auto desc = std::format( "event {} (slot {}", ctx.evt(), ctx.slot() );
+    if ( ctx.eventID().isValid() ) {
+      std::ostringstream id;
+      id << ctx.eventID();
+      desc += ", eventID: " + id.str();
+    }
+    return desc + ")";
+  }
+} // namespace
+
+SlowEventWatchdog::SlowEventWatchdog( Config config, std::size_t nSlots, std::vector<std::string> algNames,
+                                      SmartIF<IMessageSvc> msgSvc, std::function<void( unsigned int )> dumpState )
+    : m_config( std::move( config ) )
+    , m_algNames( std::move( algNames ) )
+    , m_msgSvc( std::move( msgSvc ) )
+    , m_dumpState( std::move( dumpState ) )
+    , m_instance( s_nextInstance++ )
+    , m_slots( nSlots ) {
+  if ( !m_config.eventsFile.empty() ) {
+    m_eventsFile.open( m_config.eventsFile );
+    if ( !m_eventsFile.is_open() ) {
+      MsgStream( m_msgSvc, "SlowEventWatchdog" )
+          << MSG::WARNING << "cannot open " << m_config.eventsFile << ", the slow events will not be recorded"
+          << endmsg;
+    } else {
+      m_eventsFile << "# evt run event reason" << std::endl;
+    }
+  }
+  if ( m_config.stackTrace ) {
+    // load the unwinder before the first use in a signal handler
+    void* frames[2];
+    System::backTrace( frames, 2 );
+    struct sigaction sa {};
+    sa.sa_handler = sampleHandler;
+    sa.sa_flags   = SA_RESTART;
+    sigemptyset( &sa.sa_mask );
+    sigaction( sampleSignal(), &sa, nullptr );
+  }
+  m_thread = std::thread( [this]() { run(); } );
+}
+
+SlowEventWatchdog::~SlowEventWatchdog() {
+  {
+    std::scoped_lock lock( m_stopMutex );
+    m_stop = true;
+  }
+  m_stopCond.notify_all();
+  m_thread.join();
+}
+
+void SlowEventWatchdog::eventStarted( const EventContext& ctx ) {
+  std::scoped_lock lock( m_slotsMutex );
+  auto&            slot = m_slots[ctx.slot()];
+  slot.start            = clock::now();
+  slot.inFlight         = true;
+  slot.reported         = false;
+  // partial copy of the context, to avoid copying the optional extension
+  slot.ctx = EventContext{ ctx.evt(), ctx.slot(), ctx.subSlot() };
+  slot.ctx.setEventID( ctx.eventID() );
+}
+
+void SlowEventWatchdog::eventFinished( unsigned int slot ) {
+  std::scoped_lock lock( m_slotsMutex );
+  m_slots[slot].inFlight = false;
+}
+
+SlowEventWatchdog::Runner& SlowEventWatchdog::localRunner() {
+  if ( t_runner.first != m_instance ) {
+    std::scoped_lock lock( m_runnersMutex );
+    auto&            runner = m_runners.emplace_back();
+    runner.thread           = pthread_self();
+    t_runner                = { m_instance, &runner };
+  }
+  return *static_cast<Runner*>( t_runner.second );
+}
+
+SlowEventWatchdog::Runner& SlowEventWatchdog::fiberRunner() {
+  std::scoped_lock lock( m_runnersMutex );
+  auto             free = std::ranges::find_if( m_runners, []( const Runner& r ) { return r.fiber && r.free; } );
+  Runner&          runner = ( free != m_runners.end() ) ? *free : m_runners.emplace_back();
+  runner.fiber            = true;
+  runner.free             = false;
+  return runner;
+}
+
+SlowEventWatchdog::Runner& SlowEventWatchdog::algStarted( unsigned int algIndex, const EventContext& ctx,
+                                                          bool onFiber ) {
+  auto& runner = onFiber ? fiberRunner() : localRunner();
+  runner.algIndex.store( algIndex, std::memory_order_relaxed );
+  runner.slot.store( ctx.slot(), std::memory_order_relaxed );
+  runner.reported.store( false, std::memory_order_relaxed );
+  runner.start.store( clock::now().time_since_epoch().count(), std::memory_order_release );
+  return runner;
+}
+
+void SlowEventWatchdog::algFinished( Runner& runner ) {
+  runner.start.store( 0, std::memory_order_release );
+  if ( runner.fiber ) { runner.free.store( true, std::memory_order_release ); }
+}
+
+void SlowEventWatchdog::run() {
+  std::unique_lock lock( m_stopMutex );
+  while ( !m_stopCond.wait_for( lock, m_config.period, [this]() { return m_stop; } ) ) { check(); }
+}
+
+void SlowEventWatchdog::check() {
+  MsgStream  log( m_msgSvc, "SlowEventWatchdog" );
+  const auto now = clock::now();
+
+  // events in flight for too long
+  std::vector<std::pair<EventContext, double>> slowEvents;
+  if ( m_config.eventThreshold.count() > 0 ) {
+    std::scoped_lock lock( m_slotsMutex );
+    for ( auto& slot : m_slots ) {
+      if ( !slot.inFlight || slot.reported ) continue;
+      const duration age = now - slot.start;
+      if ( age < m_config.eventThreshold ) continue;
+      slot.reported = true;
+      slowEvents.emplace_back( slot.ctx, age.count() );
+    }
+  }
+
+  // algorithm executions taking too long (and the ones of the slow events)
+  std::vector<const Runner*> offending;
+  std::vector<const Runner*> slowAlgs;
+  {
+    std::scoped_lock lock( m_runnersMutex );
+    for ( auto& runner : m_runners ) {
+      const auto start = runner.start.load( std::memory_order_acquire );
+      if ( start == 0 ) continue;
+      const duration age = now - clock::time_point( clock::duration( start ) );
+      if ( m_config.algThreshold.count() > 0 && age >= m_config.algThreshold && !runner.reported.exchange( true ) ) {
+        log << MSG::WARNING
+            << std::format( "algorithm {} running for {:.1f}s on slot {}", m_algNames[runner.algIndex.load()],
+                            age.count(), runner.slot.load() )
+            << endmsg;
+        offending.push_back( &runner );
+        slowAlgs.push_back( &runner );
+      } else if ( std::ranges::any_of( slowEvents, [&runner]( const auto& e ) {
+                    return e.first.slot() == runner.slot.load();
+                  } ) ) {
+        offending.push_back( &runner );
+      }
+    }
+  }
+
+  for ( const auto& [ctx, age] : slowEvents ) {
+    log << MSG::WARNING << std::format( "{} in flight for {:.1f}s", eventDescription( ctx ), age ) << endmsg;
+    recordEvent( ctx, "slow-event" );
+  }
+  for ( const auto* runner : slowAlgs ) {
+    EventContext ctx;
+    {
+      std::scoped_lock lock( m_slotsMutex );
+      ctx = m_slots[runner->slot.load()].ctx;
+    }
+    recordEvent( ctx, "slow-algorithm:" + m_algNames[runner->algIndex.load()] );
+  }
+
+  std::vector<unsigned int> dumpedSlots;
+  for ( const auto& [ctx, age] : slowEvents ) dumpedSlots.push_back( ctx.slot() );
+  for ( const auto* runner : offending ) dumpedSlots.push_back( runner->slot.load() );
+  std::ranges::sort( dumpedSlots );
+  const auto [first, last] = std::ranges::unique( dumpedSlots );
+  dumpedSlots.erase( first, last );
+  for ( auto slot : dumpedSlots ) m_dumpState( slot );
+
+  if ( m_config.stackTrace ) {
+    for ( const auto* runner : offending ) sampleStack( *runner );
+  }
+}
+
+void SlowEventWatchdog::sampleStack( const Runner& runner ) {
+  const auto algIndex = runner.algIndex.load();
+  MsgStream  log( m_msgSvc, "SlowEventWatchdog" );
+  if ( runner.fiber ) {
+    log << MSG::WARNING << "not sampling the stack of " << m_algNames[algIndex] << ", running on a fiber" << endmsg;
+    return;
+  }
+  // 0 means no request
+  if ( ++s_lastRequest == 0 ) { ++s_lastRequest; }
+  const unsigned int seq = s_lastRequest;
+  s_target.store( runner.thread, std::memory_order_relaxed );
+  s_request.store( seq, std::memory_order_release );
+  if ( pthread_kill( runner.thread, sampleSignal() ) != 0 ) {
+    s_request.store( 0 );
+    return;
+  }
+  // wait (a bit) for the handler to run in the target thread
+  for ( int i = 0; i < 100 && s_served.load( std::memory_order_acquire ) != seq; ++i ) {
+    std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+  }
+  // give up the request if the handler did not take it yet, otherwise wait for it to be done
+  unsigned int pending = seq;
+  if ( s_request.compare_exchange_strong( pending, 0 ) ) {
+    log << MSG::WARNING << "could not sample the stack of the thread running " << m_algNames[algIndex] << endmsg;
+    return;
+  }
+  while ( s_served.load( std::memory_order_acquire ) != seq ) { std::this_thread::yield(); }
+  std::ostringstream out;
+  out << "stack of the thread running " << m_algNames[algIndex] << ":\n";
+  // skip System::backTrace, the signal handler and the signal trampoline
+  constexpr int skip    = 3;
+  const int     nFrames = s_nFrames;
+  for ( int i = skip; i < nFrames; ++i ) {
+    void*       addr = nullptr;
+    std::string fnc, lib;
+    if ( System::getStackLevel( s_frames[i], addr, fnc, lib ) ) {
+      out << std::format( "#{:<3} {} {}  [{}]\n", i - skip + 1, addr, fnc, lib );
+    }
+  }
+  log << MSG::WARNING << out.str() << endmsg;
+}
+
+void SlowEventWatchdog::recordEvent( const EventContext& ctx, std::string_view reason ) {
+  if ( !m_eventsFile.is_open() ) return;
+  const auto& id = ctx.eventID();
+  if ( id.isValid() ) {
+    m_eventsFile << std::format( "{} {} {} {}", ctx.evt(), id.run_number(), id.event_number(), reason ) << std::endl;
+  } else {
+    m_eventsFile << std::format( "{} - - {}", ctx.evt(), reason ) << std::endl;
+  }
+}
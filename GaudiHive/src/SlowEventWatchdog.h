@@ -0,0 +1,148 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <GaudiKernel/EventContext.h>
+#include <GaudiKernel/IMessageSvc.h>
+#include <GaudiKernel/SmartIF.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <pthread.h>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/** @class SlowEventWatchdog SlowEventWatchdog.h
+ *
+ *  Watchdog thread of the AvalancheSchedulerSvc, reporting the events and the algorithm executions that take
+ *  longer than the configured thresholds.
+ *
+ *  The scheduler notifies the start and the end of each event (eventStarted/eventFinished) and the tasks notify
+ *  the start and the end of each algorithm execution (algStarted/algFinished) with a couple of atomic stores. A
+ *  dedicated thread wakes up periodically to compare the age of the events and executions in flight with the
+ *  thresholds, so that the overhead is negligible as long as nothing is slow.
+ *
+ *  When a threshold is passed (once per event and per execution) the watchdog:
+ *  - prints a warning and asks the scheduler to dump its state for the slot of the event,
+ *  - samples the stacks of the threads running the offending algorithms, interrupting them with a signal whose
+ *    handler records the stack with backtrace() (each request has a sequence number, so that a late handler
+ *    cannot overwrite the stack of the next one),
+ *  - appends the identifiers of the event to a file, to be able to process it again later.
+ *
+ *  The events file has one line per event: the event number in the job, the run and event numbers (or "-" if
+ *  unknown) and the reason why it was recorded.
+ */
+class SlowEventWatchdog {
+public:
+  using clock    = std::chrono::steady_clock;
+  using duration = std::chrono::duration<double>;
+
+  struct Config {
+    /// age of an event after which it is reported (0 to disable)
+    duration eventThreshold{ 0 };
+    /// duration of an algorithm execution after which it is reported (0 to disable)
+    duration algThreshold{ 0 };
+    /// period of the checks
+    duration period{ 1 };
+    /// whether to sample the stacks of the threads running the offending algorithms
+    bool stackTrace{ true };
+    /// file where the slow events are recorded (empty for none)
+    std::string eventsFile;
+  };
+
+  /** Start the watchdog thread.
+   *
+   *  @param nSlots    number of event slots
+   *  @param algNames  names of the algorithms, by index
+   *  @param dumpState invoked (from the watchdog thread) to dump the scheduler state for a slot
+   */
+  SlowEventWatchdog( Config config, std::size_t nSlots, std::vector<std::string> algNames,
+                     SmartIF<IMessageSvc> msgSvc, std::function<void( unsigned int )> dumpState );
+  /// Stop the watchdog thread
+  ~SlowEventWatchdog();
+
+  /// An event entered its slot
+  void eventStarted( const EventContext& ctx );
+  /// The event of a slot is finished (successfully or not)
+  void eventFinished( unsigned int slot );
+
+  /// bookkeeping of a thread (or, for blocking algorithms, of a fiber) running algorithms
+  struct Runner {
+    pthread_t                 thread;
+    std::atomic<clock::rep>   start{ 0 };
+    std::atomic<unsigned int> algIndex{ 0 };
+    std::atomic<unsigned int> slot{ 0 };
+    std::atomic<bool>         reported{ false };
+    /// whether the runner is used by fibers, taken for one execution at a time
+    bool                      fiber{ false };
+    std::atomic<bool>         free{ false };
+  };
+
+  /** The current thread starts executing an algorithm.
+   *
+   *  The fibers running the blocking algorithms share their threads, so each of their executions uses its own
+   *  runner (their stacks are not sampled, as the thread may be running another fiber).
+   *
+   *  @return the runner to pass to algFinished
+   */
+  Runner& algStarted( unsigned int algIndex, const EventContext& ctx, bool onFiber = false );
+  /// The algorithm execution is done
+  void algFinished( Runner& runner );
+
+private:
+  /// bookkeeping of the event of a slot (protected by m_slotsMutex)
+  struct Slot {
+    clock::time_point start;
+    bool              inFlight{ false };
+    bool              reported{ false };
+    EventContext      ctx;
+  };
+
+  /// body of the watchdog thread
+  void run();
+  /// check the events and algorithms in flight against the thresholds
+  void check();
+  /// print the stack of the thread of a runner
+  void sampleStack( const Runner& runner );
+  /// record a slow event in the events file
+  void recordEvent( const EventContext& ctx, std::string_view reason );
+  /// runner of the current thread (registering it the first time)
+  Runner& localRunner();
+  /// a runner for an execution on a fiber (registering a new one if none is free)
+  Runner& fiberRunner();
+
+  Config                              m_config;
+  std::vector<std::string>            m_algNames;
+  SmartIF<IMessageSvc>                m_msgSvc;
+  std::function<void( unsigned int )> m_dumpState;
+  /// identifier of this instance, to recognize the thread local caches of previous instances
+  const unsigned int                  m_instance;
+
+  std::vector<Slot> m_slots;
+  std::mutex        m_slotsMutex;
+
+  std::deque<Runner> m_runners;
+  std::mutex         m_runnersMutex;
+
+  std::ofstream m_eventsFile;
+
+  bool                    m_stop{ false };
+  std::mutex              m_stopMutex;
+  std::condition_variable m_stopCond;
+  std::thread             m_thread;
+};
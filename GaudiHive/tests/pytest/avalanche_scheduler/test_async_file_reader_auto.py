@@ -0,0 +1,31 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import re
+
+from GaudiTesting import GaudiExeTest
+
+
+class Test(GaudiExeTest):
+    # the tests may run in parallel in the same directory
+    environment = ["ASYNC_FILE_READER_DATA=async_file_reader_auto.dat"]
+    command = ["gaudirun.py", "-v", "../../../options/testAsyncFileReader.py"]
+
+    def test_backend(self, stdout):
+        # io_uring may not be available (e.g. in containers), in which case threads are used
+        assert re.search(r"AsyncFileSvc\s+INFO Using the (io_uring|threads) backend", stdout.decode())
+
+    def test_reads(self, stdout):
+        out = stdout.decode()
+        # 200 events x 16 blocks of 4096 bytes
+        assert re.search(r'\|\s*"Bytes read"\s*\|\s*13107200 \|', out)
+        assert "Read errors" not in out
+        assert "Corrupted blocks" not in out
+        assert "Wrong context after resume" not in out
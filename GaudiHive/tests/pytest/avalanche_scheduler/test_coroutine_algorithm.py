@@ -0,0 +1,24 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import re
+
+from GaudiTesting import GaudiExeTest
+
+
+class Test(GaudiExeTest):
+    command = ["gaudirun.py", "-v", "../../../options/testCoroutineAlgorithm.py"]
+    # the algorithms would need 40 s if they were blocking the only thread
+    timeout = 20
+
+    def test_executions(self, stdout):
+        out = stdout.decode()
+        assert len(re.findall(r'\|\s*"Executions"\s*\|\s*40 \|', out)) == 10
+        assert "Wrong context after resume" not in out
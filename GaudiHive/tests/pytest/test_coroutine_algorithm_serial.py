@@ -0,0 +1,22 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import re
+
+from GaudiTesting import GaudiExeTest
+
+
+class Test(GaudiExeTest):
+    command = ["gaudirun.py", "-v", "../../options/testCoroutineAlgorithmSerial.py"]
+
+    def test_executions(self, stdout):
+        out = stdout.decode()
+        assert len(re.findall(r'\|\s*"Executions"\s*\|\s*5 \|', out)) == 3
+        assert "Wrong context after resume" not in out
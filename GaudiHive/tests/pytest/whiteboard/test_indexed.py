@@ -0,0 +1,49 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import re
+from collections import defaultdict
+
+from GaudiTesting import GaudiExeTest
+
+N_EVENTS = 100
+# number of inputs of each algorithm in testIndexedWhiteBoard.py
+INPUTS = {"A1": 0, "A2": 1, "A3": 1, "A4": 2}
+
+
+class Test(GaudiExeTest):
+    command = ["gaudirun.py", "-v", "../../../options/testIndexedWhiteBoard.py"]
+    timeout = 120
+
+    def test_indexed_values(self, stdout):
+        """
+        Each algorithm must get, through the indexed lookup, the objects written
+        for the event it processes (and not those of another event that used the
+        same slot).
+        """
+        # the algorithms are not reentrant, so the lines of each of them are in
+        # the order of their executions
+        values = {name: defaultdict(list) for name in INPUTS}
+        current = {}
+        for name, what, value in re.findall(
+            r"^(A\d)\s+INFO (?::HiveTestAlgorithm::getting inputs\.\.\.|(Got data with value)) (\d+)$",
+            stdout.decode(),
+            re.MULTILINE,
+        ):
+            if what:
+                values[name][current[name]].append(int(value))
+            else:
+                current[name] = int(value)
+                values[name].setdefault(current[name], [])
+
+        for name, n_inputs in INPUTS.items():
+            assert sorted(values[name]) == list(range(N_EVENTS)), name
+            for evt, got in values[name].items():
+                assert got == [1000 + evt] * n_inputs, (name, evt)
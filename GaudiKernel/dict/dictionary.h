@@ -16,6 +16,7 @@
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 
 #include <Gaudi/Property.h>
+#include <Gaudi/ReplayRecord.h>
 #include <GaudiKernel/AlgTool.h>
 #include <GaudiKernel/Algorithm.h>
 #include <GaudiKernel/Bootstrap.h>
@@ -123,7 +124,7 @@ namespace GaudiKernelDict {
     //   std::vector<SmartRef<ContainedObject> > m_19;
     //   std::vector<SmartRef<DataObject> > m_20;
     //   std::vector<SmartRef<ObjectContainerBase> > m_21;
-    std::vector<LinkManager::Link*>     m_22;
+    std::vector<LinkManager::Link>      m_22;
     std::vector<const ContainedObject*> m_23;
     std::vector<ContainedObject*>       m_24;
     NTuple::Item<bool>                  BoolItem;
@@ -14,8 +14,15 @@
 
 #include <fmt/format.h>
 
+#include <atomic>
+#include <bit>
+#include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace Gaudi::Accumulators {
 
@@ -32,6 +39,111 @@ namespace Gaudi::Accumulators {
       auto operator()( Key k ) { return fmt::format( fmt::runtime( text ), k ); }
     };
 
+    /**
+     * Hash of the keys of HistogramMap, defined for the types supported by std::hash and for pairs and tuples
+     * of those. For other keys (only required to be ordered) HistogramMap falls back to locked lookups.
+     */
+    template <typename Key>
+    struct HistogramMapHash {};
+    template <typename Key>
+      requires requires( Key const& k ) {
+        { std::hash<Key>{}( k ) } -> std::convertible_to<std::size_t>;
+      }
+    struct HistogramMapHash<Key> {
+      std::size_t operator()( Key const& k ) const { return std::hash<Key>{}( k ); }
+    };
+    template <typename... T>
+      requires( std::invocable<HistogramMapHash<T>, T const&> && ... )
+    struct HistogramMapHash<std::tuple<T...>> {
+      std::size_t operator()( std::tuple<T...> const& k ) const {
+        return std::apply(
+            []( auto const&... e ) {
+              std::size_t seed = 0;
+              ( ( seed ^= HistogramMapHash<std::decay_t<decltype( e )>>{}( e ) + 0x9e3779b97f4a7c15 + ( seed << 6 ) +
+                          ( seed >> 2 ) ),
+                ... );
+              return seed;
+            },
+            k );
+      }
+    };
+    template <typename A, typename B>
+      requires std::invocable<HistogramMapHash<A>, A const&> && std::invocable<HistogramMapHash<B>, B const&>
+    struct HistogramMapHash<std::pair<A, B>> {
+      std::size_t operator()( std::pair<A, B> const& k ) const {
+        return HistogramMapHash<std::tuple<A, B>>{}( std::tie( k.first, k.second ) );
+      }
+    };
+
+    template <typename Key>
+    concept HashableHistogramKey = std::invocable<HistogramMapHash<Key>, Key const&> && std::equality_comparable<Key>;
+
+    /**
+     * Insert only hash index of the entries of a HistogramMap, allowing lookups without locks.
+     *
+     * The index is an open addressing table of pointers to the (stable) entries of the map. Insertions must be
+     * serialized by the caller. When the table grows a new one is published and the old one is kept until the
+     * destruction of the index, as concurrent lookups may still use it (the total size of the tables is bounded
+     * by twice the size of the last one).
+     */
+    template <typename Key, typename Entry>
+    class HistogramMapIndex {
+    public:
+      /// look for the entry of the key, returning nullptr if not (yet) indexed
+      Entry* find( Key const& k ) const {
+        auto table = m_current.load( std::memory_order_acquire );
+        if ( !table ) return nullptr;
+        for ( auto i = table->slot( hash( k ) );; i = ( i + 1 ) & table->mask ) {
+          auto entry = table->slots[i].load( std::memory_order_acquire );
+          if ( !entry || entry->first == k ) return entry;
+        }
+      }
+      /// add an entry, to be called with the insertions serialized
+      void insert( Entry* entry ) {
+        auto table = m_current.load( std::memory_order_relaxed );
+        if ( !table || 2 * ( m_size + 1 ) > table->mask + 1 ) table = grow( table );
+        place( *table, entry );
+        ++m_size;
+      }
+
+    private:
+      struct Table {
+        Table( unsigned int bits )
+            : shift{ 64 - bits }
+            , mask{ ( std::size_t{ 1 } << bits ) - 1 }
+            , slots{ std::make_unique<std::atomic<Entry*>[]>( mask + 1 ) } {}
+        /// first slot to probe for a hash (Fibonacci hashing, spreading also poor hashes like the identity)
+        std::size_t slot( std::size_t h ) const { return ( h * 0x9e3779b97f4a7c15ull ) >> shift; }
+        unsigned int                           shift;
+        std::size_t                            mask;
+        std::unique_ptr<std::atomic<Entry*>[]> slots;
+      };
+
+      static std::size_t hash( Key const& k ) { return HistogramMapHash<Key>{}( k ); }
+
+      static void place( Table& table, Entry* entry ) {
+        auto i = table.slot( hash( entry->first ) );
+        while ( table.slots[i].load( std::memory_order_relaxed ) ) i = ( i + 1 ) & table.mask;
+        table.slots[i].store( entry, std::memory_order_release );
+      }
+
+      Table* grow( Table* old ) {
+        auto table = std::make_unique<Table>( old ? std::countr_zero( old->mask + 1 ) + 1 : 4 );
+        if ( old ) {
+          for ( std::size_t i = 0; i <= old->mask; ++i ) {
+            if ( auto entry = old->slots[i].load( std::memory_order_relaxed ) ) place( *table, entry );
+          }
+        }
+        m_tables.push_back( std::move( table ) );
+        m_current.store( m_tables.back().get(), std::memory_order_release );
+        return m_tables.back().get();
+      }
+
+      std::atomic<Table*>                 m_current{ nullptr };
+      std::vector<std::unique_ptr<Table>> m_tables;
+      std::size_t                         m_size{ 0 };
+    };
+
     /**
      * internal class implementing a map of histograms
      *
@@ -39,41 +151,50 @@ namespace Gaudi::Accumulators {
      */
     template <typename Key, typename Histo>
     class HistogramMapInternal {
+      using Entry = typename std::map<Key, Histo>::value_type;
+
     public:
       /// constructor with callables for FormatName and FormatTitle
       template <typename OWNER, std::invocable<Key const&> FormatName, std::invocable<Key const&> FormatTitle>
       HistogramMapInternal( OWNER* owner, FormatName&& fname, FormatTitle&& ftitle,
                             typename Histo::AxisTupleType&& allAxis )
-          : m_makeHisto{ [owner, fname, ftitle, allAxis, this]( Key const& k ) -> Histo& {
-            return m_map
-                .emplace( std::piecewise_construct, std::forward_as_tuple( k ),
-                          std::forward_as_tuple( owner, fname( k ), ftitle( k ), allAxis ) )
-                .first->second;
+          : m_makeHisto{ [owner, fname, ftitle, allAxis, this]( Key const& k ) -> Entry& {
+            return *m_map
+                        .emplace( std::piecewise_construct, std::forward_as_tuple( k ),
+                                  std::forward_as_tuple( owner, fname( k ), ftitle( k ), allAxis ) )
+                        .first;
           } } {}
       /// constructor for strings, FormatHistDefaultT is used as the default callable
       template <typename OWNER>
       HistogramMapInternal( OWNER* owner, std::string_view name, std::string_view title,
                             typename Histo::AxisTupleType&& allAxis )
-          : m_makeHisto{ [owner, name, title, allAxis, this]( Key const& k ) -> Histo& {
-            return m_map
-                .emplace( std::piecewise_construct, std::forward_as_tuple( k ),
-                          std::forward_as_tuple( owner, FormatHistDefaultT<Key>( name )( k ),
-                                                 FormatHistDefaultT<Key>( title )( k ), allAxis ) )
-                .first->second;
+          : m_makeHisto{ [owner, name, title, allAxis, this]( Key const& k ) -> Entry& {
+            return *m_map
+                        .emplace( std::piecewise_construct, std::forward_as_tuple( k ),
+                                  std::forward_as_tuple( owner, FormatHistDefaultT<Key>( name )( k ),
+                                                         FormatHistDefaultT<Key>( title )( k ), allAxis ) )
+                        .first;
           } } {}
       /// operator[] method, made thread safe and thus declared const
+      /// (existing histograms are found without locking when the key is hashable)
       Histo& operator[]( Key const& k ) const {
+        if constexpr ( HashableHistogramKey<Key> ) {
+          if ( auto entry = m_index.find( k ) ) return entry->second;
+        }
         std::scoped_lock lock{ m_mapLock };
         auto             it = m_map.find( k );
         if ( it != m_map.end() ) return it->second;
-        return m_makeHisto( k );
+        auto& entry = m_makeHisto( k );
+        if constexpr ( HashableHistogramKey<Key> ) m_index.insert( &entry );
+        return entry.second;
       }
 
     private:
-      mutable std::map<Key, Histo>        m_map;
-      mutable std::mutex                  m_mapLock{};
-      std::function<Histo&( Key const& )> m_makeHisto;
-      // operator[],
+      // the map owns the histograms (never moved, as they are registered to the MonitoringHub)
+      mutable std::map<Key, Histo>          m_map;
+      mutable HistogramMapIndex<Key, Entry> m_index;
+      mutable std::mutex                    m_mapLock{};
+      std::function<Entry&( Key const& )>   m_makeHisto;
     };
   } // namespace details
 
@@ -91,7 +212,9 @@ namespace Gaudi::Accumulators {
    * The operator[] will then build on the fly the name and title of the new histograms from
    * the key when creating new entries
    *
-   * Thread safety is ensured by serializing calls to operator[] through a mutex
+   * Thread safety is ensured by serializing the creation of new histograms through a mutex, while existing
+   * histograms are found without locking, through an insert only hash index (for keys supported by std::hash,
+   * or pairs and tuples of them, otherwise all calls to operator[] are serialized)
    *
    * Note that this should in principle be used only with StaticHistograms, there is no
    * reason to use Histograms there, as the histograms are only created at run time anyway
@@ -17,6 +17,7 @@
 #include <GaudiKernel/IStateful.h>
 #include <GaudiKernel/ISvcLocator.h>
 #include <GaudiKernel/ITimelineSvc.h>
+#include <exception>
 #include <string>
 #include <vector>
 
@@ -414,9 +415,20 @@ namespace Gaudi {
     /// Produce string represention of the control flow expression.
     std::ostream& toControlFlowExpression( std::ostream& os ) const override;
 
+  protected:
+    /// Process the outcome of an execution as sysExecute does (filter decision, exceptions, error count),
+    /// for derived classes completing the execution outside of sysExecute (e.g. Gaudi::CoroutineAlgorithm)
+    StatusCode handleExecuteResult( StatusCode status, std::exception_ptr exception, AlgExecStateRef& algState );
+
   private:
     unsigned int maxErrors() const { return m_errorMax; }
 
+    /// invoke execute() handling exceptions and errors (the body of sysExecute without instrumentation)
+    StatusCode executeGuarded( const EventContext& ctx, AlgExecStateRef& algState );
+
+    /// check once per start() if sysExecute has to set up any of the instrumentation hooks
+    void updateExecuteInstrumentation();
+
   protected:
     bool isReEntrant() const override { return true; }
 
@@ -429,6 +441,9 @@ namespace Gaudi {
     /// identifier of this algorithm in the AlgExecStateSvc
     AlgExecStateRef::AlgKey m_execSvcKey;
 
+    /// whether sysExecute must set up the context service, the auditors or the timeline (updated in sysStart)
+    bool m_instrumentExecute = true;
+
     // tools used by algorithm
     mutable std::vector<IAlgTool*>             m_tools;
     mutable std::vector<BaseToolHandle*>       m_toolHandles;
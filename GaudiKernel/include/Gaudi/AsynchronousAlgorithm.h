@@ -11,6 +11,7 @@
 #pragma once
 
 #include <Gaudi/Algorithm.h>
+#include <GaudiKernel/IAsyncFileSvc.h>
 #include <GaudiKernel/IHiveWhiteBoard.h>
 #include <boost/fiber/all.hpp>
 #include <chrono>
@@ -22,6 +23,8 @@ namespace Gaudi {
    *  fiber is suspended and resumed. This requires using the member functions for
    *  suspending instead of the boost::fiber functions directly.
    *
+   *  See Gaudi::CoroutineAlgorithm for a stackless alternative running on the TBB pool.
+   *
    *  @author Beojan Stanislaus
    *  @date 2023
    */
@@ -52,6 +55,13 @@ namespace Gaudi {
       return restoreAfterSuspend();
     }
 
+    /** Submit a batch of reads to the given service and suspend the fiber until they complete.
+     *
+     *  `results` receives the outcome of each read (number of bytes read or negative errno value).
+     */
+    StatusCode read( IAsyncFileSvc& svc, std::vector<IAsyncFileSvc::ReadRequest> requests,
+                     std::vector<std::int64_t>& results ) const;
+
   private:
     /// Contains current slot
     boost::fibers::fiber_specific_ptr<std::size_t> s_currentSlot{};
@@ -0,0 +1,259 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <GaudiKernel/Kernel.h>
+#include <GaudiKernel/StatusCode.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+/** Stackless coroutines support for asynchronous algorithms (see Gaudi::CoroutineAlgorithm).
+ *
+ *  A coroutine returning a Gaudi::Coroutine::Task can suspend with `co_await` on:
+ *  - a Gaudi::Coroutine::Completion, completed from any thread (e.g. by an I/O callback or by another
+ *    algorithm),
+ *  - a timer (Gaudi::Coroutine::sleep_for and sleep_until),
+ *  - another Task (which runs until completion before the caller is resumed).
+ *
+ *  While suspended a coroutine only uses the memory of its frame, and when the awaited operation completes it
+ *  is resumed through the Executor it was started with (e.g. as a task of the TBB pool of the scheduler).
+ */
+namespace Gaudi::Coroutine {
+
+  /// Interface of the objects deciding where suspended coroutines are resumed
+  class GAUDI_API Executor {
+  public:
+    virtual ~Executor() = default;
+    /// Called (from any thread) when a suspended coroutine can continue: resume() must be invoked once
+    virtual void post( std::function<void()> resume ) = 0;
+    /// Called when a coroutine suspends waiting for an asynchronous operation
+    virtual void suspended() {}
+  };
+
+  /// Executor resuming the coroutines in the thread completing the awaited operation
+  class GAUDI_API InlineExecutor : public Executor {
+  public:
+    void post( std::function<void()> resume ) override { resume(); }
+  };
+
+  /** Return type of the coroutines producing a StatusCode.
+   *
+   *  The coroutine is started lazily: either by the owner of the Task (see start()) or when the Task is awaited
+   *  by another coroutine, in which case it shares the Executor of the caller.
+   */
+  class Task {
+  public:
+    struct promise_type {
+      StatusCode         result;
+      std::exception_ptr exception;
+      /// where the coroutine is resumed after a suspension
+      Executor* executor = nullptr;
+      /// restore the thread-local state of the coroutine before resuming it (e.g. the current event slot)
+      std::function<void()> restore;
+      /// coroutine to resume on completion (when awaited from another Task)
+      std::coroutine_handle<> continuation;
+      /// callback invoked on completion of a detached coroutine, after the destruction of its frame
+      std::function<void( StatusCode, std::exception_ptr )> done;
+
+      Task                get_return_object() { return Task{ handle_type::from_promise( *this ) }; }
+      std::suspend_always initial_suspend() noexcept { return {}; }
+      auto                final_suspend() noexcept {
+        struct FinalAwaiter {
+          bool                    await_ready() noexcept { return false; }
+          std::coroutine_handle<> await_suspend( std::coroutine_handle<promise_type> h ) noexcept {
+            auto& p = h.promise();
+            if ( p.continuation ) return p.continuation;
+            if ( p.done ) {
+              auto done      = std::move( p.done );
+              auto result    = p.result;
+              auto exception = p.exception;
+              h.destroy();
+              done( result, exception );
+            }
+            return std::noop_coroutine();
+          }
+          void await_resume() noexcept {}
+        };
+        return FinalAwaiter{};
+      }
+      void return_value( StatusCode sc ) { result = sc; }
+      void unhandled_exception() { exception = std::current_exception(); }
+
+      /// Resume the given coroutine (suspended in this promise) through the executor
+      void post( std::coroutine_handle<> h ) {
+        executor->post( [restore = restore, h]() {
+          if ( restore ) restore();
+          h.resume();
+        } );
+      }
+    };
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    Task() = default;
+    Task( Task&& other ) noexcept : m_handle{ std::exchange( other.m_handle, {} ) } {}
+    Task& operator=( Task&& other ) noexcept {
+      if ( this != &other ) {
+        if ( m_handle ) m_handle.destroy();
+        m_handle = std::exchange( other.m_handle, {} );
+      }
+      return *this;
+    }
+    ~Task() {
+      if ( m_handle ) m_handle.destroy();
+    }
+
+    /** Start the coroutine, which will run until its first suspension.
+     *
+     *  The Task gives up the ownership of the coroutine frame, which is destroyed on completion, just before
+     *  invoking `done` with the returned StatusCode and the exception possibly thrown by the coroutine.
+     */
+    void start( Executor& executor, std::function<void()> restore,
+                std::function<void( StatusCode, std::exception_ptr )> done ) && {
+      auto  h    = std::exchange( m_handle, {} );
+      auto& p    = h.promise();
+      p.executor = &executor;
+      p.restore  = std::move( restore );
+      p.done     = std::move( done );
+      h.resume();
+    }
+
+    /// Awaiting a Task runs it with the executor of the caller, returning its StatusCode (or rethrowing)
+    bool                    await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend( handle_type caller ) noexcept {
+      auto& p        = m_handle.promise();
+      p.executor     = caller.promise().executor;
+      p.restore      = caller.promise().restore;
+      p.continuation = caller;
+      return m_handle;
+    }
+    StatusCode await_resume() {
+      auto& p = m_handle.promise();
+      if ( p.exception ) std::rethrow_exception( p.exception );
+      return p.result;
+    }
+
+  private:
+    explicit Task( handle_type h ) : m_handle{ h } {}
+    handle_type m_handle;
+  };
+
+  /** Single-shot result of an asynchronous operation, to be awaited by one coroutine.
+   *
+   *  The producer (any thread) calls set_value() or set_exception(), the coroutine suspended in `co_await` on the
+   *  Completion (or a copy of it, as they share the state) is then resumed through its Executor.
+   */
+  template <typename T = StatusCode>
+  class Completion {
+  public:
+    Completion() = default;
+
+    void set_value( T value ) {
+      complete( [&]( State& s ) { s.value.emplace( std::move( value ) ); } );
+    }
+    void set_exception( std::exception_ptr e ) {
+      complete( [&]( State& s ) { s.exception = std::move( e ); } );
+    }
+    bool ready() const {
+      auto _ = std::scoped_lock{ m_state->mutex };
+      return m_state->value || m_state->exception;
+    }
+
+    bool await_ready() const { return ready(); }
+    bool await_suspend( Task::handle_type h ) {
+      auto _ = std::scoped_lock{ m_state->mutex };
+      // completed in the meantime: do not suspend
+      if ( m_state->value || m_state->exception ) return false;
+      // the coroutine may be resumed (and destroyed) as soon as the lock is released
+      h.promise().executor->suspended();
+      m_state->waiter = h;
+      return true;
+    }
+    T await_resume() {
+      if ( m_state->exception ) std::rethrow_exception( m_state->exception );
+      return std::move( *m_state->value );
+    }
+
+  private:
+    struct State {
+      std::mutex         mutex;
+      std::optional<T>   value;
+      std::exception_ptr exception;
+      Task::handle_type  waiter;
+    };
+
+    template <typename F>
+    void complete( F&& f ) {
+      Task::handle_type waiter;
+      {
+        auto _ = std::scoped_lock{ m_state->mutex };
+        f( *m_state );
+        waiter = std::exchange( m_state->waiter, {} );
+      }
+      if ( waiter ) waiter.promise().post( waiter );
+    }
+
+    std::shared_ptr<State> m_state = std::make_shared<State>();
+  };
+
+  /** Executor resuming the coroutines in the thread waiting for their completion (see run()).
+   *
+   *  Used to execute a Task synchronously without running its code in the threads completing the awaited
+   *  operations (e.g. the timer thread, which would be blocked for the other timers).
+   */
+  class GAUDI_API RunLoop : public Executor {
+  public:
+    void post( std::function<void()> resume ) override;
+
+    /** Run the Task to completion in the calling thread, returning its StatusCode (or rethrowing its exception).
+     *  `restore` is invoked before every resumption, as for Task::start().
+     */
+    StatusCode run( Task task, std::function<void()> restore = {} );
+
+  private:
+    std::mutex                        m_mutex;
+    std::condition_variable           m_cond;
+    std::deque<std::function<void()>> m_queue;
+  };
+
+  /// Run the callable at the given time, in the thread of the timer (which must not be blocked)
+  GAUDI_API void callAt( std::chrono::steady_clock::time_point when, std::function<void()> f );
+
+  /// Awaitable suspending the coroutine until the given time
+  class SleepUntil {
+  public:
+    explicit SleepUntil( std::chrono::steady_clock::time_point when ) : m_when{ when } {}
+    bool await_ready() const { return std::chrono::steady_clock::now() >= m_when; }
+    void await_suspend( Task::handle_type h ) {
+      h.promise().executor->suspended();
+      callAt( m_when, [h]() { h.promise().post( h ); } );
+    }
+    void await_resume() const noexcept {}
+
+  private:
+    std::chrono::steady_clock::time_point m_when;
+  };
+
+  inline SleepUntil sleep_until( std::chrono::steady_clock::time_point when ) { return SleepUntil{ when }; }
+  template <typename Rep, typename Period>
+  SleepUntil sleep_for( std::chrono::duration<Rep, Period> const& dur ) {
+    return SleepUntil{ std::chrono::steady_clock::now() +
+                       std::chrono::duration_cast<std::chrono::steady_clock::duration>( dur ) };
+  }
+} // namespace Gaudi::Coroutine
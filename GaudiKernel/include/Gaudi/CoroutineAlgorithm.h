@@ -0,0 +1,67 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <Gaudi/Algorithm.h>
+#include <Gaudi/Coroutine.h>
+#include <GaudiKernel/IAsyncFileSvc.h>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Gaudi {
+  /** Base class for asynchronous algorithms implemented as C++20 coroutines.
+   *
+   *  This is an alternative to Gaudi::AsynchronousAlgorithm (based on Boost.Fiber) not requiring a dedicated
+   *  thread pool nor a stack per suspended execution: derived classes implement executeAsync() as a coroutine
+   *  that can `co_await` on Gaudi::Coroutine::Completion, Gaudi::Coroutine::sleep_for/sleep_until or another
+   *  Gaudi::Coroutine::Task.
+   *
+   *  AvalancheSchedulerSvc starts the coroutine in a TBB task and resumes it, after each suspension, in a new
+   *  TBB task, so that the worker threads are not blocked by the asynchronous operations. The current event
+   *  context and the whiteboard slot are restored before every resumption, and the algorithm is signed off when
+   *  the coroutine completes. With other event loops the coroutine is run to completion within execute().
+   *
+   *  The EventContext passed to executeAsync() stays valid until the coroutine completes, but the auditors and the
+   *  timeline are not applied to the asynchronous executions.
+   */
+  class GAUDI_API CoroutineAlgorithm : public Gaudi::Algorithm {
+  public:
+    using Gaudi::Algorithm::Algorithm;
+
+    /// The actual processing of the event
+    virtual Coroutine::Task executeAsync( const EventContext& ctx ) const = 0;
+
+    /// Synchronous execution: run executeAsync() to completion in the calling thread (see Coroutine::RunLoop)
+    StatusCode execute( const EventContext& ctx ) const final;
+
+    /** Start the execution of the algorithm, returning at its first suspension.
+     *
+     *  The coroutine is resumed through the given executor, and `done` is invoked with the final StatusCode
+     *  (after the same error handling as in sysExecute) once the execution completes.
+     */
+    void sysExecuteAsync( const EventContext& ctx, Coroutine::Executor& executor,
+                          std::function<void( StatusCode )> done );
+
+    /** Submit a batch of reads to the given service, returning an awaitable on their outcome.
+     *
+     *  `co_await` gives the number of bytes read (or the negative errno value) for each request.
+     */
+    Coroutine::Completion<std::vector<std::int64_t>> read( IAsyncFileSvc&                          svc,
+                                                           std::vector<IAsyncFileSvc::ReadRequest> requests ) const {
+      Coroutine::Completion<std::vector<std::int64_t>> completion;
+      svc.read( std::move( requests ),
+                [completion]( std::vector<std::int64_t> r ) mutable { completion.set_value( std::move( r ) ); } );
+      return completion;
+    }
+  };
+} // namespace Gaudi
@@ -0,0 +1,66 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <GaudiKernel/DataObject.h>
+#include <GaudiKernel/EventContext.h>
+#include <GaudiKernel/EventIDBase.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Gaudi {
+  /** Description of an event captured for replay, stored in the event store at ReplayRecord::location().
+   *
+   *  HiveSlimEventLoopMgr fills it for the captured events (see its ReplayCaptureStream property) with what is
+   *  needed to reproduce the processing of the event, besides the input data: the original event number, the
+   *  EventIDBase of the event (run, event, time stamp and lumi block, i.e. the keys of the conditions IOVs) and
+   *  the seeds the random number engine was reseeded with when the event was started (see the ReplayReseed
+   *  property). ReplayEventSelector restores the seeds when the event is read back.
+   */
+  class GAUDI_API ReplayRecord : public DataObject {
+  public:
+    ReplayRecord() = default;
+    ReplayRecord( const EventContext& ctx, std::vector<long> seeds, std::string reason );
+
+    // Class IDs
+    const CLID&        clID() const override { return classID(); }
+    static const CLID& classID();
+
+    /// Default location of the record in the event store
+    static const std::string& location();
+
+    /// Event number in the job that captured the event
+    EventContext::ContextEvt_t evt() const { return m_evt; }
+    /// EventIDBase of the captured event
+    EventIDBase eventID() const {
+      return { m_runNumber, m_eventNumber, m_timeStamp, m_timeStampNs, m_lumiBlock, m_bunchCrossingId };
+    }
+    /// Seeds of the random number engine at the beginning of the event (empty if it was not reseeded)
+    const std::vector<long>& seeds() const { return m_seeds; }
+    /// Why the event was captured (e.g. "failed" or "requested")
+    const std::string& reason() const { return m_reason; }
+
+    std::ostream& fillStream( std::ostream& s ) const override;
+
+  private:
+    EventContext::ContextEvt_t  m_evt{ EventContext::INVALID_CONTEXT_EVT };
+    EventIDBase::number_type    m_runNumber{ EventIDBase::UNDEFNUM };
+    EventIDBase::event_number_t m_eventNumber{ EventIDBase::UNDEFEVT };
+    EventIDBase::number_type    m_timeStamp{ EventIDBase::UNDEFNUM };
+    EventIDBase::number_type    m_timeStampNs{ EventIDBase::UNDEFNUM };
+    EventIDBase::number_type    m_lumiBlock{ EventIDBase::UNDEFNUM };
+    EventIDBase::number_type    m_bunchCrossingId{ 0 };
+    std::vector<long>           m_seeds;
+    std::string                 m_reason;
+  };
+} // namespace Gaudi
@@ -0,0 +1,198 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Gaudi {
+
+  /** Base class for the tags identifying the columns of a Gaudi::SOACollection.
+   *
+   *  @code
+   *  struct X : Gaudi::SOAField<float> {};
+   *  struct Y : Gaudi::SOAField<float> {};
+   *  using Points = Gaudi::SOACollection<X, Y>;
+   *  @endcode
+   */
+  template <typename T>
+  struct SOAField {
+    static_assert( std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                   "SOACollection columns must hold trivial types" );
+    using type = T;
+  };
+
+  /** @class SOACollection SOACollection.h Gaudi/SOACollection.h
+   *  @brief Structure-of-arrays container, with one contiguous column per field.
+   *
+   *  Each column is allocated with the given alignment (a cache line by default) and its capacity is a multiple
+   *  of `padding` elements, so that vectorized kernels can process whole SIMD registers up to capacity() without
+   *  a scalar remainder loop (the padding elements are zero-initialized but otherwise unspecified).
+   *
+   *  The columns are exposed as std::span (see column() and columns()), which can be iterated together with
+   *  Gaudi::Functional::details::zip::range. The collection can be stored in the transient event store through
+   *  AnyDataWrapper like any other movable type, e.g. as output of a Gaudi::Functional algorithm.
+   *
+   *  Only trivially copyable element types are supported, so that elements are never constructed nor destroyed.
+   */
+  template <typename... Fields>
+  class SOACollection {
+    static_assert( sizeof...( Fields ) > 0, "SOACollection requires at least one field" );
+
+  public:
+    /// Alignment (in bytes) of the columns
+    static constexpr std::size_t alignment = 64;
+    /// Granularity (in elements) of the capacity
+    static constexpr std::size_t padding = 16;
+
+    SOACollection() = default;
+    explicit SOACollection( std::size_t n ) { resize( n ); }
+    SOACollection( const SOACollection& other ) { *this = other; }
+    SOACollection( SOACollection&& other ) noexcept
+        : m_columns{ std::exchange( other.m_columns, {} ) }
+        , m_size{ std::exchange( other.m_size, 0 ) }
+        , m_capacity{ std::exchange( other.m_capacity, 0 ) } {}
+    SOACollection& operator=( const SOACollection& other ) {
+      if ( this != &other ) {
+        clear();
+        reserve( other.m_size );
+        forEachColumn( copyN{ other.m_size }, m_columns, other.m_columns );
+        m_size = other.m_size;
+      }
+      return *this;
+    }
+    SOACollection& operator=( SOACollection&& other ) noexcept {
+      if ( this != &other ) {
+        release();
+        m_columns  = std::exchange( other.m_columns, {} );
+        m_size     = std::exchange( other.m_size, 0 );
+        m_capacity = std::exchange( other.m_capacity, 0 );
+      }
+      return *this;
+    }
+    ~SOACollection() { release(); }
+
+    std::size_t size() const { return m_size; }
+    std::size_t capacity() const { return m_capacity; }
+    bool        empty() const { return m_size == 0; }
+
+    /// Make sure that the columns can hold at least n elements
+    void reserve( std::size_t n ) {
+      if ( n <= m_capacity ) return;
+      const std::size_t newCapacity = ( std::max( n, 2 * m_capacity ) + padding - 1 ) / padding * padding;
+      Columns           newColumns{ allocate<typename Fields::type>( newCapacity )... };
+      forEachColumn( copyN{ m_size }, newColumns, m_columns );
+      const std::size_t size = m_size;
+      release();
+      m_columns  = newColumns;
+      m_size     = size;
+      m_capacity = newCapacity;
+    }
+    /// Change the number of elements (new elements are zero-initialized)
+    void resize( std::size_t n ) {
+      reserve( n );
+      if ( n > m_size ) {
+        forEachColumn( [this, n]( auto* col ) { std::fill( col + m_size, col + n, 0 ); }, m_columns );
+      }
+      m_size = n;
+    }
+    /// Remove all the elements (the capacity is not changed)
+    void clear() { m_size = 0; }
+
+    /// Append an element, given the value of each field
+    void emplace_back( typename Fields::type... values ) {
+      if ( m_size == m_capacity ) reserve( m_size + 1 );
+      std::apply( [&]( auto*... cols ) { ( ( cols[m_size] = values ), ... ); }, m_columns );
+      ++m_size;
+    }
+
+    /// Access to the column of the given field
+    template <typename Field>
+    std::span<typename Field::type> column() {
+      return { data<Field>(), m_size };
+    }
+    template <typename Field>
+    std::span<const typename Field::type> column() const {
+      return { data<Field>(), m_size };
+    }
+    /// Raw pointer to the column of the given field, valid up to capacity()
+    template <typename Field>
+    typename Field::type* data() {
+      return std::get<index<Field>()>( m_columns );
+    }
+    template <typename Field>
+    const typename Field::type* data() const {
+      return std::get<index<Field>()>( m_columns );
+    }
+
+    /// Spans over all the columns, in the order of the fields (e.g. to be zipped)
+    std::tuple<std::span<typename Fields::type>...> columns() { return { column<Fields>()... }; }
+    std::tuple<std::span<const typename Fields::type>...> columns() const { return { column<Fields>()... }; }
+
+  private:
+    using Columns = std::tuple<typename Fields::type*...>;
+
+    /// Position of a field in the list of fields
+    template <typename Field>
+    static constexpr std::size_t index() {
+      static_assert( ( std::is_same_v<Field, Fields> || ... ), "Field is not part of this SOACollection" );
+      constexpr bool matches[] = { std::is_same_v<Field, Fields>... };
+      std::size_t    i         = 0;
+      while ( !matches[i] ) ++i;
+      return i;
+    }
+
+    /// Copy the first n elements of a column into another one
+    struct copyN {
+      std::size_t n;
+      template <typename T>
+      void operator()( T* dst, const T* src ) const {
+        if ( n ) std::memcpy( dst, src, n * sizeof( T ) );
+      }
+    };
+
+    template <typename T>
+    static T* allocate( std::size_t n ) {
+      auto p = static_cast<T*>( ::operator new( n * sizeof( T ), std::align_val_t{ alignment } ) );
+      std::memset( static_cast<void*>( p ), 0, n * sizeof( T ) );
+      return p;
+    }
+    void release() {
+      forEachColumn(
+          []( auto* col ) {
+            if ( col ) ::operator delete( static_cast<void*>( col ), std::align_val_t{ alignment } );
+          },
+          m_columns );
+      m_columns  = {};
+      m_size     = 0;
+      m_capacity = 0;
+    }
+
+    /// Call f for each field, with the corresponding column of each of the given tuples of columns
+    template <typename F, typename... ColumnSets>
+    static void forEachColumn( F&& f, ColumnSets&&... columnSets ) {
+      auto apply = [&]<std::size_t I>( std::integral_constant<std::size_t, I> ) { f( std::get<I>( columnSets )... ); };
+      [&]<std::size_t... I>( std::index_sequence<I...> ) {
+        ( apply( std::integral_constant<std::size_t, I>{} ), ... );
+      }( std::index_sequence_for<Fields...>{} );
+    }
+
+    Columns     m_columns{};
+    std::size_t m_size     = 0;
+    std::size_t m_capacity = 0;
+  };
+} // namespace Gaudi
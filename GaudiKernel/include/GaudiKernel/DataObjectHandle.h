@@ -174,7 +174,7 @@ T* DataObjectHandle<T>::get( bool mustExist ) const {
 template <typename T>
 T* DataObjectHandle<T>::put( std::unique_ptr<T> objectp ) const {
   assert( m_init );
-  StatusCode sc = m_EDS->registerObject( objKey(), objectp.get() );
+  StatusCode sc = store( objectp.get() );
   if ( !sc.isSuccess() ) { throw GaudiException( "Error in put of " + objKey(), "DataObjectHandle<T>::put", sc ); }
   return objectp.release();
 }
@@ -338,7 +338,7 @@ public:
   const T* put( T&& obj ) const {
     assert( m_init );
     auto objectp = std::make_unique<AnyDataWrapper<T>>( std::move( obj ) );
-    if ( auto sc = m_EDS->registerObject( objKey(), objectp.get() ); sc.isFailure() ) {
+    if ( auto sc = store( objectp.get() ); sc.isFailure() ) {
       throw GaudiException( "Error in put of " + objKey(), "DataObjectHandle<AnyDataWrapper<T>>::put", sc );
     }
     return &objectp.release()->getData();
@@ -393,7 +393,7 @@ public:
    */
   const View* put( std::unique_ptr<AnyDataWithViewWrapper<View, Owned>> objectp ) const {
     assert( m_init );
-    if ( auto sc = m_EDS->registerObject( objKey(), objectp.get() ); sc.isFailure() ) {
+    if ( auto sc = store( objectp.get() ); sc.isFailure() ) {
       throw GaudiException( "Error in put of " + objKey(), "DataObjectHandle<AnyDataWithViewWrapper<T>::put", sc );
     }
     return &objectp.release()->getData();
@@ -10,10 +10,12 @@
 \***********************************************************************************/
 #pragma once
 
+#include <atomic>
 #include <mutex>
 
 #include <GaudiKernel/DataHandle.h>
 #include <GaudiKernel/IDataProviderSvc.h>
+#include <GaudiKernel/IHiveWhiteBoard.h>
 #include <GaudiKernel/IMessageSvc.h>
 #include <GaudiKernel/IProperty.h>
 #include <GaudiKernel/SmartIF.h>
@@ -51,9 +53,21 @@ protected:
 
   DataObject* fetch() const;
 
+  /// Register an object in the event store, using the index of the handle if available
+  StatusCode store( DataObject* pObj ) const;
+
+  /// Index of the object in the whiteboard (npos if not indexed), cached once the whiteboard has assigned it
+  std::size_t index() const;
+
 protected:
   SmartIF<IDataProviderSvc> m_EDS;
+  SmartIF<IHiveWhiteBoard>  m_WB;
   SmartIF<IMessageSvc>      m_MS;
 
   bool m_init = false;
+
+private:
+  static constexpr std::size_t s_unresolved = std::string::npos - 1;
+
+  mutable std::atomic<std::size_t> m_index{ s_unresolved };
 };
@@ -94,7 +94,7 @@ namespace EventStatus {
 class GAUDI_API IAlgExecStateSvc : virtual public IInterface {
 public:
   /// InterfaceID
-  DeclareInterfaceID( IAlgExecStateSvc, 2, 0 );
+  DeclareInterfaceID( IAlgExecStateSvc, 3, 0 );
 
   /// get the Algorithm Execution State for a give Algorithm by name
   /// prefer using IAlgorithm::execState, it is more efficient
@@ -115,13 +115,17 @@ public:
   /// reset all states for the given EventContext
   virtual void reset( const EventContext& ctx ) = 0;
 
+  /// allocate the states of the algorithms for the sub-slot (event view) of the given EventContext
+  /// (called when the view is scheduled, so that accessing the states of a sub-slot never needs a lock)
+  virtual void allocateSubSlot( const EventContext& ctx ) = 0;
+
   /// adds a new algorithm to the service
   virtual AlgExecStateRef::AlgKey addAlg( const Gaudi::StringKey& algName ) = 0;
   AlgExecStateRef::AlgKey         addAlg( const IAlgorithm* iAlg ) { return addAlg( iAlg->nameKey() ); }
 
-  virtual const EventStatus::Status& eventStatus( const EventContext& ctx ) const                             = 0;
-  virtual void                       setEventStatus( const EventStatus::Status& sc, const EventContext& ctx ) = 0;
-  virtual void                       updateEventStatus( const bool& b, const EventContext& ctx )              = 0;
+  virtual EventStatus::Status eventStatus( const EventContext& ctx ) const                             = 0;
+  virtual void                setEventStatus( const EventStatus::Status& sc, const EventContext& ctx ) = 0;
+  virtual void                updateEventStatus( const bool& b, const EventContext& ctx )              = 0;
 
   virtual unsigned int algErrorCount( const IAlgorithm* iAlg ) const = 0;
   virtual void         resetErrorCount( const IAlgorithm* iAlg )     = 0;
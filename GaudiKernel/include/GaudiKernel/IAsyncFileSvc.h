@@ -0,0 +1,65 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <GaudiKernel/IFileMgr.h>
+#include <GaudiKernel/IService.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+
+/** @class IAsyncFileSvc IAsyncFileSvc.h GaudiKernel/IAsyncFileSvc.h
+ *
+ *  Interface of the services reading files asynchronously, without blocking the calling thread.
+ *
+ *  Files are opened and closed through the IFileMgr (as Io::POSIX files), so that they are accounted for like
+ *  any other file, then reads are submitted in batches and a callback is invoked (from an I/O thread of the
+ *  service) when all the reads of a batch are completed. The callback should only hand the results over, e.g.
+ *  by resuming a suspended Gaudi::AsynchronousAlgorithm or Gaudi::CoroutineAlgorithm (see their read() methods).
+ *
+ *  Buffers can be registered in advance to allow the implementations to avoid mapping them for every read.
+ */
+class GAUDI_API IAsyncFileSvc : virtual public IService {
+public:
+  DeclareInterfaceID( IAsyncFileSvc, 1, 0 );
+
+  /// Description of a read of `buffer.size()` bytes at `offset` in the file `fd`
+  struct ReadRequest {
+    Io::Fd               fd     = -1;
+    std::uint64_t        offset = 0;
+    std::span<std::byte> buffer;
+    /// index of the registered buffer containing `buffer` (see registerBuffers), or -1
+    int registeredBuffer = -1;
+  };
+
+  /// Called with the outcome of each read of a batch: number of bytes read or negative errno value
+  using ReadCallback = std::function<void( std::vector<std::int64_t> )>;
+
+  /// Open a file for reading, returning its file descriptor (or -1 on failure)
+  virtual Io::Fd open( const std::string& caller, const std::string& fname, const std::string& desc = "" ) = 0;
+
+  /// Close a file opened with open()
+  virtual StatusCode close( Io::Fd fd, const std::string& caller ) = 0;
+
+  /// Submit a batch of reads, `done` being called when all of them are completed
+  virtual void read( std::vector<ReadRequest> requests, ReadCallback done ) = 0;
+
+  /** Register the buffers used as destination of the reads, replacing the ones registered before.
+   *
+   *  The buffers must stay valid until they are replaced or the service is finalized, and no read may be in
+   *  flight during the call.
+   */
+  virtual StatusCode registerBuffers( std::vector<std::span<std::byte>> buffers ) = 0;
+};
@@ -13,6 +13,9 @@
 #include <GaudiKernel/DataObjID.h>
 #include <GaudiKernel/IInterface.h>
 #include <string>
+#include <string_view>
+
+class DataObject;
 
 /**@class IHiveWhiteBoard IHiveWhiteBoard.h GaudiKernel/IHiveWhiteBoard.h
  *
@@ -23,7 +26,7 @@
 class GAUDI_API IHiveWhiteBoard : public extend_interfaces<IInterface> {
 public:
   /// InterfaceID
-  DeclareInterfaceID( IHiveWhiteBoard, 2, 0 );
+  DeclareInterfaceID( IHiveWhiteBoard, 3, 0 );
 
   /** Activate an given 'slot' for all subsequent calls within the
    * same thread id.
@@ -84,4 +87,35 @@ public:
 
   /// Get free slots number
   virtual size_t freeSlots() = 0;
+
+  /** Get the dense index assigned to a data object, if the whiteboard supports indexed access.
+   *  Indices are assigned at start() to all the data objects declared by the algorithms.
+   *
+   * @return    Index of the object (npos if the object is not indexed).
+   */
+  virtual size_t dataObjectIndex( const DataObjID& ) const { return std::string::npos; }
+
+  /** Find an object by index in the current store (see dataObjectIndex()).
+   *
+   * @param     index     [IN]     Index of the object
+   * @param     path      [IN]     Path of the object, used if the object is not yet indexed in the store
+   * @param     pObj      [OUT]    Retrieved object
+   * @return Status code indicating failure or success.
+   */
+  virtual StatusCode findIndexedObject( size_t /* index */, std::string_view /* path */, DataObject*& /* pObj */ ) {
+    return StatusCode::FAILURE;
+  }
+
+  /** Register an object by index in the current store (see dataObjectIndex()).
+   *  The object is also registered by path, so implementations may have to lock the store (HiveWhiteBoard does):
+   *  only findIndexedObject() is expected to be lock-free.
+   *
+   * @param     index     [IN]     Index of the object
+   * @param     path      [IN]     Path of the object
+   * @param     pObj      [IN]     Object to register
+   * @return Status code indicating failure or success.
+   */
+  virtual StatusCode registerIndexedObject( size_t /* index */, std::string_view /* path */, DataObject* /* pObj */ ) {
+    return StatusCode::FAILURE;
+  }
 };
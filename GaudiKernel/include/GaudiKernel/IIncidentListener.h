@@ -23,8 +23,12 @@ class EventContext;
 class GAUDI_API IIncidentListener : virtual public IInterface {
 public:
   /// InterfaceID
-  DeclareInterfaceID( IIncidentListener, 2, 0 );
+  DeclareInterfaceID( IIncidentListener, 3, 0 );
 
   /// Inform that a new incident has occurred
   virtual void handle( const Incident& ) = 0;
+
+  /// Tell if handle() may be invoked concurrently from several threads
+  /// (only used by IncidentSvc when the concurrent dispatch is enabled)
+  virtual bool isThreadSafe() const { return false; }
 };
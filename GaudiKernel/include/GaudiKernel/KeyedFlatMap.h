@@ -0,0 +1,224 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace Containers {
+  /** @class KeyedFlatMap KeyedFlatMap.h GaudiKernel/KeyedFlatMap.h
+   *
+   *  Open addressing hash table from the keys of keyed objects to the objects, used by the
+   *  Containers::FlatHashMap setup of KeyedContainer.
+   *
+   *  The (key, object) pairs are stored in a single array (linear probing, capacity a power of 2,
+   *  load factor up to 3/4 and deletion by backward shift, so without tombstones), avoiding the
+   *  allocation of one node per entry of the node based maps. A slot with a null object is empty,
+   *  so null objects cannot be inserted.
+   *
+   *  The memory is obtained from the given allocator, which may be an arena, e.g.
+   *  @code
+   *  Gaudi::Arena::Monotonic<>                                                   arena( 1 << 20 );
+   *  Containers::KeyedFlatMap<Gaudi::Allocator::MonotonicArena<std::pair<long, void*>>> m( &arena );
+   *  m.reserve( nHits );
+   *  @endcode
+   *  Only the subset of the std::map interface needed by KeyedObjectManager is provided.
+   */
+  template <typename Allocator = std::allocator<std::pair<long, void*>>>
+  class KeyedFlatMap {
+  public:
+    using key_type       = long;
+    using mapped_type    = void*;
+    using value_type     = std::pair<long, void*>;
+    using size_type      = std::size_t;
+    using allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<value_type>;
+
+  private:
+    using alloc_traits = std::allocator_traits<allocator_type>;
+
+    template <typename V>
+    class iterator_base {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type        = KeyedFlatMap::value_type;
+      using difference_type   = std::ptrdiff_t;
+      using pointer           = V*;
+      using reference         = V&;
+
+      iterator_base() = default;
+      /// allow conversion from iterator to const_iterator
+      template <typename W>
+        requires std::is_convertible_v<W*, V*>
+      iterator_base( const iterator_base<W>& other ) : m_pos( other.m_pos ), m_end( other.m_end ) {}
+
+      reference      operator*() const { return *m_pos; }
+      pointer        operator->() const { return m_pos; }
+      iterator_base& operator++() {
+        ++m_pos;
+        skipEmpty();
+        return *this;
+      }
+      iterator_base operator++( int ) {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+      }
+      friend bool operator==( const iterator_base& a, const iterator_base& b ) { return a.m_pos == b.m_pos; }
+
+    private:
+      friend class KeyedFlatMap;
+      template <typename W>
+      friend class iterator_base;
+
+      iterator_base( V* pos, V* end ) : m_pos( pos ), m_end( end ) {}
+      void skipEmpty() {
+        while ( m_pos != m_end && !m_pos->second ) ++m_pos;
+      }
+
+      V* m_pos = nullptr;
+      V* m_end = nullptr;
+    };
+
+  public:
+    using iterator       = iterator_base<value_type>;
+    using const_iterator = iterator_base<const value_type>;
+
+    KeyedFlatMap() = default;
+    explicit KeyedFlatMap( const allocator_type& alloc ) : m_alloc( alloc ) {}
+    KeyedFlatMap( const KeyedFlatMap& other )
+        : m_alloc( alloc_traits::select_on_container_copy_construction( other.m_alloc ) ) {
+      reserve( other.m_size );
+      for ( const auto& v : other ) insert( v );
+    }
+    KeyedFlatMap( KeyedFlatMap&& other ) noexcept
+        : m_alloc( other.m_alloc )
+        , m_slots( std::exchange( other.m_slots, nullptr ) )
+        , m_capacity( std::exchange( other.m_capacity, 0 ) )
+        , m_size( std::exchange( other.m_size, 0 ) ) {}
+    KeyedFlatMap& operator=( KeyedFlatMap other ) noexcept {
+      swap( other );
+      return *this;
+    }
+    ~KeyedFlatMap() { release(); }
+
+    void swap( KeyedFlatMap& other ) noexcept {
+      using std::swap;
+      swap( m_alloc, other.m_alloc );
+      swap( m_slots, other.m_slots );
+      swap( m_capacity, other.m_capacity );
+      swap( m_size, other.m_size );
+    }
+
+    iterator       begin() { return make_iterator( m_slots ); }
+    iterator       end() { return { m_slots + m_capacity, m_slots + m_capacity }; }
+    const_iterator begin() const { return const_cast<KeyedFlatMap*>( this )->begin(); }
+    const_iterator end() const { return const_cast<KeyedFlatMap*>( this )->end(); }
+
+    size_type      size() const { return m_size; }
+    bool           empty() const { return m_size == 0; }
+    size_type      capacity() const { return m_capacity; }
+    allocator_type get_allocator() const { return m_alloc; }
+
+    /// Make sure that `n` entries can be stored without rehashing
+    void reserve( size_type n ) {
+      if ( n > maxSize( m_capacity ) ) { rehash( std::bit_ceil( std::max<size_type>( n + n / 3 + 1, 16 ) ) ); }
+    }
+
+    /// Insert the (key, object) pair if the key is not present, returning the position of the key
+    std::pair<iterator, bool> insert( const value_type& v ) {
+      if ( !v.second ) { return { end(), false }; }
+      if ( m_size + 1 > maxSize( m_capacity ) ) { reserve( m_size + 1 ); }
+      const size_type mask = m_capacity - 1;
+      for ( size_type i = slot( v.first );; i = ( i + 1 ) & mask ) {
+        auto& s = m_slots[i];
+        if ( !s.second ) {
+          s = v;
+          ++m_size;
+          return { make_iterator( &s ), true };
+        }
+        if ( s.first == v.first ) { return { make_iterator( &s ), false }; }
+      }
+    }
+
+    iterator find( key_type key ) {
+      if ( !m_size ) { return end(); }
+      const size_type mask = m_capacity - 1;
+      for ( size_type i = slot( key );; i = ( i + 1 ) & mask ) {
+        auto& s = m_slots[i];
+        if ( !s.second ) { return end(); }
+        if ( s.first == key ) { return { &s, m_slots + m_capacity }; }
+      }
+    }
+    const_iterator find( key_type key ) const { return const_cast<KeyedFlatMap*>( this )->find( key ); }
+
+    /// Remove the entry at the given position, invalidating the iterators
+    void erase( const_iterator pos ) {
+      const size_type mask = m_capacity - 1;
+      size_type       hole = pos.m_pos - m_slots;
+      // shift back the following entries of the cluster that would not be found anymore
+      for ( size_type i = ( hole + 1 ) & mask; m_slots[i].second; i = ( i + 1 ) & mask ) {
+        const size_type home = slot( m_slots[i].first );
+        if ( ( ( i - home ) & mask ) >= ( ( i - hole ) & mask ) ) {
+          m_slots[hole] = m_slots[i];
+          hole          = i;
+        }
+      }
+      m_slots[hole] = value_type{ 0, nullptr };
+      --m_size;
+    }
+
+    /// Remove all the entries, keeping the memory
+    void clear() {
+      if ( m_size ) { std::fill_n( m_slots, m_capacity, value_type{ 0, nullptr } ); }
+      m_size = 0;
+    }
+
+  private:
+    static constexpr size_type maxSize( size_type capacity ) { return capacity - capacity / 4; }
+
+    size_type slot( key_type key ) const {
+      // Fibonacci hashing, to spread the (often consecutive) keys
+      return ( static_cast<std::uint64_t>( key ) * 0x9E3779B97F4A7C15ull ) >> ( 64 - std::countr_zero( m_capacity ) );
+    }
+
+    iterator make_iterator( value_type* pos ) {
+      iterator it{ pos, m_slots + m_capacity };
+      it.skipEmpty();
+      return it;
+    }
+
+    void rehash( size_type capacity ) {
+      value_type* old         = std::exchange( m_slots, alloc_traits::allocate( m_alloc, capacity ) );
+      size_type   oldCapacity = std::exchange( m_capacity, capacity );
+      std::uninitialized_fill_n( m_slots, m_capacity, value_type{ 0, nullptr } );
+      m_size = 0;
+      for ( size_type i = 0; i < oldCapacity; ++i ) {
+        if ( old[i].second ) { insert( old[i] ); }
+      }
+      if ( old ) { alloc_traits::deallocate( m_alloc, old, oldCapacity ); }
+    }
+
+    void release() {
+      if ( m_slots ) { alloc_traits::deallocate( m_alloc, std::exchange( m_slots, nullptr ), m_capacity ); }
+      m_capacity = m_size = 0;
+    }
+
+    [[no_unique_address]] allocator_type m_alloc;
+    value_type*                          m_slots    = nullptr;
+    size_type                            m_capacity = 0;
+    size_type                            m_size     = 0;
+  };
+} // namespace Containers
@@ -23,6 +23,8 @@ namespace Containers {
   typedef long ( *MANIPULATOR )( void* );
   /// Parametrisation class for hashmap-like implementation.
   struct GAUDI_API hashmap;
+  /// Parametrisation class for open addressing hashmap-like implementation.
+  struct GAUDI_API flathashmap;
   /// Parametrisation class for map-like implementation.
   struct GAUDI_API map;
   /// Parametrisation class for redirection array - like implementation.
@@ -32,7 +34,8 @@ namespace Containers {
 
   /** KeyedObjectManager
    *  Class to manage keyed objects. This class is instantiated for two
-   *  container types: map and hashmap. Other types are possible,
+   *  container types: map, hashmap and flathashmap (see Containers::KeyedFlatMap),
+   *  the latter being preferable for large containers. Other types are possible,
    *  but currently not supported. Other implementations may be achieved
    *  by specializing the SETUP class.
    *
@@ -97,6 +100,8 @@ namespace Containers {
   typedef KeyedObjectManager<map> Map;
   /// Forward declaration of specialized std::hashmap-like object manager
   typedef KeyedObjectManager<hashmap> HashMap;
+  /// Forward declaration of specialized open addressing hashmap-like object manager
+  typedef KeyedObjectManager<flathashmap> FlatHashMap;
   /// Forward declaration of specialized std::vector-like object manager
   typedef KeyedObjectManager<vector> Vector;
   /// Forward declaration of specialized redirection array object manager
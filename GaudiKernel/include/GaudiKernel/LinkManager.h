@@ -13,6 +13,8 @@
 #include <GaudiKernel/Kernel.h>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 class DataObject;
@@ -23,6 +25,14 @@ class IOpaqueAddress;
  *  A LinkManager is the object aggregated into a DataObject,
  *  which is responsible for the handling of non-tree like links.
  *
+ *  The links are stored contiguously and identified by their index. Once resolved,
+ *  the pointer to the target object is kept in the link, so that the dereferencing
+ *  of the SmartRefs using it does not go through the data service anymore.
+ *  Pointers to links are invalidated by addLink.
+ *  When there are many links, they are indexed by path and by object. Links whose
+ *  object is set through Link::setObject are still found by object, with a linear
+ *  search: LinkManager::setObject keeps the index up to date instead.
+ *
  *  @author M.Frank
  */
 class GAUDI_API LinkManager final {
@@ -65,15 +75,30 @@ public:
   };
 
 private:
-  ///@ TODO: replace by std::vector<std::unique_ptr<Link>> once
-  ///        ROOT does 'automatic' schema conversion from T* to
-  ///        std::unique_ptr<T>...
-  ///        Or, even better, just std::vector<Link>, given that
-  ///        Link is barely larger than a pointer (40 vs. 8 bytes)
-  ///        -- but that requires more invasive schema evolution.
-  ///
+  /// Number of links above which the paths are indexed
+  static constexpr std::size_t s_indexThreshold = 8;
+
   /// The vector containing all links which are non-tree like
-  std::vector<Link*> m_linkVector;
+  std::vector<Link> m_linkVector;
+  /// Index of the links by path (views on the paths of m_linkVector), used only for many links
+  std::unordered_map<std::string_view, long> m_pathIndex;
+  /// Index of the links by target object, used only for many links
+  std::unordered_map<const DataObject*, long> m_objectIndex;
+  /// Number of links covered by the indexes (they are used only if it matches the number of links)
+  std::size_t m_indexed = 0;
+
+  /// Check if the indexes are in use and up to date
+  bool indexed() const { return m_indexed > s_indexThreshold && m_indexed == m_linkVector.size(); }
+  /// Position of the link with the given path (or size() if not found)
+  long find( std::string_view path ) const;
+  /// Position of the first link to the given object (or size() if not found)
+  long findObject( const DataObject* pObject ) const;
+  /// Same as above, also adding to the index the links found by the linear search
+  long findObject( const DataObject* pObject );
+  /// Add the link with the given ID to the indexes
+  void index( long id );
+  /// Rebuild the indexes
+  void reindex();
 
 public:
   /// Standard Constructor
@@ -98,6 +123,8 @@ public:
   Link*       link( std::string_view path );
   /// Add link by object reference and path
   long addLink( const std::string& path, const DataObject* pObject );
+  /// Update the object behind the link identified by ID (unlike Link::setObject, the link can then be found by object)
+  void setObject( long id, const DataObject* pObject );
 
   auto end() const { return std::default_sentinel; }
   auto begin() const {
@@ -211,6 +211,7 @@ namespace Gaudi {
       if ( sc.isSuccess() ) {
         // Update the state.
         m_state = m_targetState;
+        updateExecuteInstrumentation();
       }
     } catch ( const GaudiException& Exception ) {
       fatal() << "in sysStart(): exception with tag=" << Exception.tag() << " is caught" << endmsg;
@@ -300,6 +301,7 @@ namespace Gaudi {
                                          ( m_auditorRestart ) ? auditorSvc().get() : nullptr, IAuditor::ReStart );
       // Invoke the reinitialize() method of the derived class
       sc = restart();
+      if ( sc.isSuccess() ) updateExecuteInstrumentation();
     } catch ( const GaudiException& Exception ) {
       fatal() << "sysRestart(): Exception with tag=" << Exception.tag() << " is caught" << endmsg;
       error() << Exception << endmsg;
@@ -327,11 +329,15 @@ namespace Gaudi {
 
     AlgExecStateRef algState{ *algExecStateSvc(), ctx, m_execSvcKey };
     algState.setState( AlgExecState::Executing );
-    StatusCode status;
 
-    // Should performance profile be performed ?
-    // invoke execute() method of Algorithm class
-    //   and catch all uncaught exceptions
+    // fast path: nothing to set up around execute()
+    if ( !m_instrumentExecute ) {
+      StatusCode status = executeGuarded( ctx, algState );
+      algState.setState( AlgExecState::Done, status );
+      return status;
+    }
+
+    StatusCode status;
 
     // lock the context service
     Gaudi::Utils::AlgContext cnt( this, registerContext() ? contextSvc().get() : nullptr, ctx );
@@ -341,11 +347,35 @@ namespace Gaudi {
                                        ( m_auditorExecute ) ? auditorSvc().get() : nullptr, IAuditor::Execute, status,
                                        ctx );
 
-    try {
+    {
       ITimelineSvc::TimelineRecorder timelineRecoder;
       if ( m_doTimeline ) { timelineRecoder = timelineSvc()->getRecorder( name(), ctx ); }
 
+      status = executeGuarded( ctx, algState );
+    }
+
+    algState.setState( AlgExecState::Done, status );
+
+    return status;
+  }
+
+  StatusCode Algorithm::executeGuarded( const EventContext& ctx, AlgExecStateRef& algState ) {
+    StatusCode         status;
+    std::exception_ptr exception;
+
+    // invoke execute() method of Algorithm class
+    //   and catch all uncaught exceptions
+    try {
       status = execute( ctx );
+    } catch ( ... ) { exception = std::current_exception(); }
+
+    return handleExecuteResult( status, exception, algState );
+  }
+
+  StatusCode Algorithm::handleExecuteResult( StatusCode status, std::exception_ptr exception,
+                                             AlgExecStateRef& algState ) {
+    try {
+      if ( exception ) std::rethrow_exception( exception );
 
       if ( status == Gaudi::Functional::FilterDecision::FAILED ) {
         algState.setFilterPassed( false );
@@ -394,11 +424,17 @@ namespace Gaudi {
       }
     }
 
-    algState.setState( AlgExecState::Done, status );
-
     return status;
   }
 
+  void Algorithm::updateExecuteInstrumentation() {
+    // the properties are not expected to change while running, so we check them only once per run
+    m_instrumentExecute = registerContext() || m_auditorExecute || m_doTimeline;
+    if ( msgLevel( MSG::DEBUG ) ) {
+      debug() << "sysExecute instrumentation " << ( m_instrumentExecute ? "enabled" : "disabled" ) << endmsg;
+    }
+  }
+
   // IAlgorithm implementation
   StatusCode Algorithm::sysStop() {
 
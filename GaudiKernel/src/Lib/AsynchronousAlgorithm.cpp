@@ -11,6 +11,7 @@
 #include <Gaudi/AsynchronousAlgorithm.h>
 
 #include <format>
+#include <memory>
 
 StatusCode Gaudi::AsynchronousAlgorithm::sysInitialize() {
   setAsynchronous( true );
@@ -45,3 +46,12 @@ StatusCode Gaudi::AsynchronousAlgorithm::yield() const {
   boost::this_fiber::yield();
   return restoreAfterSuspend();
 }
+
+StatusCode Gaudi::AsynchronousAlgorithm::read( IAsyncFileSvc& svc, std::vector<IAsyncFileSvc::ReadRequest> requests,
+                                               std::vector<std::int64_t>& results ) const {
+  auto promise = std::make_shared<boost::fibers::promise<std::vector<std::int64_t>>>();
+  auto future  = promise->get_future();
+  svc.read( std::move( requests ), [promise]( std::vector<std::int64_t> r ) { promise->set_value( std::move( r ) ); } );
+  results = future.get();
+  return restoreAfterSuspend();
+}
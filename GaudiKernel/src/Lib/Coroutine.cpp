@@ -0,0 +1,112 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include <Gaudi/Coroutine.h>
+
+#include <condition_variable>
+#include <queue>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace {
+  /// Thread running callbacks at given times, started on first use
+  class TimerQueue {
+  public:
+    using clock = std::chrono::steady_clock;
+
+    ~TimerQueue() {
+      {
+        auto _ = std::scoped_lock{ m_mutex };
+        m_stop = true;
+      }
+      m_cond.notify_one();
+      if ( m_thread.joinable() ) m_thread.join();
+    }
+
+    void add( clock::time_point when, std::function<void()> f ) {
+      {
+        auto _ = std::scoped_lock{ m_mutex };
+        if ( !m_thread.joinable() ) m_thread = std::thread{ [this]() { run(); } };
+        m_queue.push( { when, m_counter++, std::move( f ) } );
+      }
+      m_cond.notify_one();
+    }
+
+  private:
+    struct Entry {
+      clock::time_point     when;
+      std::size_t           order; // keep the insertion order for equal times
+      std::function<void()> f;
+      bool operator>( const Entry& other ) const { return std::tie( when, order ) > std::tie( other.when, other.order ); }
+    };
+
+    void run() {
+      auto lock = std::unique_lock{ m_mutex };
+      while ( !m_stop ) {
+        if ( m_queue.empty() ) {
+          m_cond.wait( lock );
+        } else if ( const auto next = m_queue.top().when; clock::now() < next ) {
+          // the queue may change while waiting, so we must not pass a reference to the entry
+          m_cond.wait_until( lock, next );
+        } else {
+          auto f = std::move( const_cast<Entry&>( m_queue.top() ).f );
+          m_queue.pop();
+          lock.unlock();
+          f();
+          lock.lock();
+        }
+      }
+    }
+
+    std::mutex                                                     m_mutex;
+    std::condition_variable                                        m_cond;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<>> m_queue;
+    std::size_t                                                    m_counter = 0;
+    bool                                                           m_stop    = false;
+    std::thread                                                    m_thread;
+  };
+} // namespace
+
+void Gaudi::Coroutine::callAt( std::chrono::steady_clock::time_point when, std::function<void()> f ) {
+  static TimerQueue s_timers;
+  s_timers.add( when, std::move( f ) );
+}
+
+void Gaudi::Coroutine::RunLoop::post( std::function<void()> resume ) {
+  // notify under the lock: the RunLoop may be destroyed as soon as the resumption is done
+  auto _ = std::scoped_lock{ m_mutex };
+  m_queue.push_back( std::move( resume ) );
+  m_cond.notify_one();
+}
+
+StatusCode Gaudi::Coroutine::RunLoop::run( Task task, std::function<void()> restore ) {
+  bool               finished = false;
+  StatusCode         result;
+  std::exception_ptr exception;
+  // the completion callback is invoked by the thread resuming the coroutine, i.e. by this one
+  std::move( task ).start( *this, std::move( restore ), [&]( StatusCode sc, std::exception_ptr e ) {
+    finished  = true;
+    result    = sc;
+    exception = e;
+  } );
+  while ( !finished ) {
+    std::function<void()> resume;
+    {
+      auto lock = std::unique_lock{ m_mutex };
+      m_cond.wait( lock, [this]() { return !m_queue.empty(); } );
+      resume = std::move( m_queue.front() );
+      m_queue.pop_front();
+    }
+    resume();
+  }
+  if ( exception ) std::rethrow_exception( exception );
+  return result;
+}
@@ -0,0 +1,43 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include <Gaudi/CoroutineAlgorithm.h>
+#include <GaudiKernel/ThreadLocalContext.h>
+
+StatusCode Gaudi::CoroutineAlgorithm::execute( const EventContext& ctx ) const {
+  // the coroutine is resumed in this thread, not in the ones completing the awaited operations, so the event
+  // context and the store selected by the event loop are still there (and the event store may not be a
+  // whiteboard); an exception is left to sysExecute
+  return Coroutine::RunLoop{}.run( executeAsync( ctx ) );
+}
+
+void Gaudi::CoroutineAlgorithm::sysExecuteAsync( const EventContext& ctx, Coroutine::Executor& executor,
+                                                 std::function<void( StatusCode )> done ) {
+  if ( !isEnabled() ) {
+    if ( msgLevel( MSG::VERBOSE ) ) { verbose() << ".sysExecuteAsync(): is not enabled. Skip execution" << endmsg; }
+    done( StatusCode::SUCCESS );
+    return;
+  }
+
+  execState( ctx ).setState( AlgExecState::Executing );
+
+  executeAsync( ctx ).start(
+      executor,
+      [this, &ctx]() {
+        Gaudi::Hive::setCurrentContext( ctx );
+        whiteboard()->selectStore( ctx.valid() ? ctx.slot() : 0 ).ignore();
+      },
+      [this, &ctx, done = std::move( done )]( StatusCode sc, std::exception_ptr exception ) {
+        auto algState = execState( ctx );
+        sc            = handleExecuteResult( sc, exception, algState );
+        algState.setState( AlgExecState::Done, sc );
+        done( sc );
+      } );
+}
@@ -26,8 +26,10 @@ const DataObjID INVALID_DATAOBJID = DataObjID();
 DataObjectHandleBase::DataObjectHandleBase( DataObjectHandleBase&& other )
     : Gaudi::DataHandle( other )
     , m_EDS( std::move( other.m_EDS ) )
+    , m_WB( std::move( other.m_WB ) )
     , m_MS( std::move( other.m_MS ) )
-    , m_init( other.m_init ) {
+    , m_init( other.m_init )
+    , m_index( other.m_index.load() ) {
   m_owner->declare( *this );
 }
 
@@ -36,8 +38,10 @@ DataObjectHandleBase& DataObjectHandleBase::operator=( const DataObjectHandleBas
   // FIXME: operator= should not change our owner, only our 'value'
   Gaudi::DataHandle::operator=( other );
   m_EDS  = other.m_EDS;
+  m_WB   = other.m_WB;
   m_MS   = other.m_MS;
   m_init = other.m_init;
+  m_index.store( s_unresolved );
   return *this;
 }
 
@@ -64,10 +68,36 @@ DataObject* DataObjectHandleBase::fetch() const {
               << std::endl;
   }
   DataObject* p = nullptr;
+  if ( auto idx = index(); idx != std::string::npos ) {
+    if ( m_WB->findIndexedObject( idx, objKey(), p ).isSuccess() ) return p;
+    p = nullptr; // e.g. no table for the current slot: look it up by path
+  }
   m_EDS->retrieveObject( objKey(), p ).ignore();
   return p;
 }
 
+//---------------------------------------------------------------------------
+StatusCode DataObjectHandleBase::store( DataObject* pObj ) const {
+  if ( auto idx = index(); idx != std::string::npos ) return m_WB->registerIndexedObject( idx, objKey(), pObj );
+  return m_EDS->registerObject( objKey(), pObj );
+}
+
+//---------------------------------------------------------------------------
+std::size_t DataObjectHandleBase::index() const {
+  auto idx = m_index.load( std::memory_order_relaxed );
+  if ( idx == s_unresolved ) {
+    if ( !m_WB ) {
+      idx = std::string::npos;
+      m_index.store( idx, std::memory_order_relaxed );
+    } else {
+      // the whiteboard assigns the indices at start: a handle used before has to ask again later
+      idx = m_WB->dataObjectIndex( fullKey() );
+      if ( idx != std::string::npos ) m_index.store( idx, std::memory_order_relaxed );
+    }
+  }
+  return idx;
+}
+
 //---------------------------------------------------------------------------
 
 bool DataObjectHandleBase::init() {
@@ -89,6 +119,7 @@ bool DataObjectHandleBase::init() {
       throw GaudiException( "owner is neither AlgTool nor Gaudi::Algorithm", "Invalid Cast", StatusCode::FAILURE );
     }
   }
+  m_WB   = m_EDS;
   m_init = true;
   return true;
 }
@@ -12,6 +12,7 @@
 #include <GaudiKernel/GaudiException.h>
 #include <GaudiKernel/HashMap.h>
 #include <GaudiKernel/Kernel.h>
+#include <GaudiKernel/KeyedFlatMap.h>
 #include <GaudiKernel/KeyedObjectManager.h>
 #include <map>
 #include <vector>
@@ -28,6 +29,17 @@ namespace Containers {
     hashmap()            = default;
     hashmap( hashmap&& ) = default;
   };
+  struct flathashmap {
+    typedef KeyedFlatMap<> map_type;
+    map_type               m;
+    std::vector<void*>     v;
+    bool                   insert( void* obj, long key ) {
+      auto p = m.insert( map_type::value_type( key, obj ) );
+      return p.second;
+    }
+    flathashmap()                = default;
+    flathashmap( flathashmap&& ) = default;
+  };
   struct map {
     typedef std::map<long, void*> map_type;
     map_type                      m;
@@ -133,7 +145,8 @@ template <class T>
 void Containers::KeyedObjectManager<T>::onDirty() const {
   m_direct = 1;
   auto& s  = *m_setup.s;
-  long  i  = 0;
+  if constexpr ( requires { s.m.reserve( s.v.size() ); } ) { s.m.reserve( s.v.size() ); }
+  long i = 0;
   for ( auto p : s.v ) s.insert( p, i++ );
   s.v.clear();
 }
@@ -230,6 +243,7 @@ template <class T>
 void Containers::KeyedObjectManager<T>::reserve( long len ) {
   switch ( m_direct ) {
   case 1:
+    if constexpr ( requires { m_setup.s->m.reserve( len ); } ) { m_setup.s->m.reserve( len ); }
     break;
   case 0:
     m_setup.s->v.reserve( len );
@@ -301,8 +315,13 @@ namespace Containers {
   CLID KeyedObjectManager<Containers::hashmap>::classID() {
     return CLID_ObjectVector + 0x00040000;
   }
+  template <>
+  CLID KeyedObjectManager<Containers::flathashmap>::classID() {
+    return CLID_ObjectVector + 0x00070000;
+  }
 
   template class KeyedObjectManager<Containers::hashmap>;
+  template class KeyedObjectManager<Containers::flathashmap>;
   template class KeyedObjectManager<Containers::map>;
 } // namespace Containers
 
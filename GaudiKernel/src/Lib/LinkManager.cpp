@@ -12,20 +12,10 @@
 #include <GaudiKernel/IRegistry.h>
 #include <GaudiKernel/LinkManager.h>
 #include <algorithm>
-
-namespace {
-  template <typename Container, typename Pred>
-  auto findLink( Container& c, Pred pred ) {
-    auto i = std::find_if( c.begin(), c.end(), pred );
-    return i != c.end() ? *i : nullptr;
-  }
-
-} // namespace
+#include <utility>
 
 /// destructor
-LinkManager::~LinkManager() {
-  for ( auto& i : m_linkVector ) delete i;
-}
+LinkManager::~LinkManager() = default;
 
 /// Access to the object's address from the link
 IOpaqueAddress* LinkManager::Link::address() {
@@ -38,42 +28,107 @@ IOpaqueAddress* LinkManager::Link::address() {
 
 /// Retrieve symbolic link identified by ID
 const LinkManager::Link* LinkManager::link( long id ) const {
-  return ( 0 <= id && (unsigned)id < m_linkVector.size() ) ? m_linkVector[id] : nullptr;
+  return ( 0 <= id && (unsigned)id < m_linkVector.size() ) ? &m_linkVector[id] : nullptr;
 }
 
 LinkManager::Link* LinkManager::link( long id ) {
-  return ( 0 <= id && (unsigned)id < m_linkVector.size() ) ? m_linkVector[id] : nullptr;
+  return ( 0 <= id && (unsigned)id < m_linkVector.size() ) ? &m_linkVector[id] : nullptr;
 }
 
 /// Retrieve symbolic link identified by Object pointer
 const LinkManager::Link* LinkManager::link( const DataObject* pObject ) const {
-  return pObject ? findLink( m_linkVector, [=]( auto* j ) { return j->object() == pObject; } ) : nullptr;
+  return pObject ? link( findObject( pObject ) ) : nullptr;
 }
 
 LinkManager::Link* LinkManager::link( const DataObject* pObject ) {
-  return pObject ? findLink( m_linkVector, [=]( auto* j ) { return j->object() == pObject; } ) : nullptr;
+  return pObject ? link( findObject( pObject ) ) : nullptr;
 }
 
 /// Retrieve symbolic link identified by Object path
 const LinkManager::Link* LinkManager::link( std::string_view path ) const {
-  return !path.empty() ? findLink( m_linkVector, [=]( auto* j ) { return j->path() == path; } ) : nullptr;
+  return !path.empty() ? link( find( path ) ) : nullptr;
+}
+LinkManager::Link* LinkManager::link( std::string_view path ) { return !path.empty() ? link( find( path ) ) : nullptr; }
+
+/// Position of the link with the given path
+long LinkManager::find( std::string_view path ) const {
+  if ( indexed() ) {
+    auto i = m_pathIndex.find( path );
+    return i != m_pathIndex.end() ? i->second : size();
+  }
+  return std::find_if( m_linkVector.begin(), m_linkVector.end(), [=]( auto& j ) { return j.path() == path; } ) -
+         m_linkVector.begin();
+}
+
+/// Position of the first link to the given object
+long LinkManager::findObject( const DataObject* pObject ) const {
+  if ( indexed() ) {
+    auto i = m_objectIndex.find( pObject );
+    if ( i != m_objectIndex.end() && m_linkVector[i->second].object() == pObject ) return i->second;
+  }
+  // the entry is missing (object set with Link::setObject) or stale (object replaced since): linear search
+  return std::find_if( m_linkVector.begin(), m_linkVector.end(), [=]( auto& j ) { return j.object() == pObject; } ) -
+         m_linkVector.begin();
 }
-LinkManager::Link* LinkManager::link( std::string_view path ) {
-  return !path.empty() ? findLink( m_linkVector, [=]( auto* j ) { return j->path() == path; } ) : nullptr;
+
+long LinkManager::findObject( const DataObject* pObject ) {
+  const long id = std::as_const( *this ).findObject( pObject );
+  // remember links found by the linear search
+  if ( indexed() && id < size() ) index( id );
+  return id;
+}
+
+/// Add a link to the indexes
+void LinkManager::index( long id ) {
+  const Link& lnk = m_linkVector[id];
+  // keep the first of the links with the same path, as the linear search does
+  m_pathIndex.emplace( lnk.path(), id );
+  if ( const DataObject* pObject = lnk.object() ) {
+    auto [i, inserted] = m_objectIndex.try_emplace( pObject, id );
+    if ( !inserted && ( id < i->second || m_linkVector[i->second].object() != pObject ) ) i->second = id;
+  }
+}
+
+/// Rebuild the indexes (needed when the links are moved in memory)
+void LinkManager::reindex() {
+  m_pathIndex.clear();
+  m_objectIndex.clear();
+  m_pathIndex.reserve( m_linkVector.capacity() );
+  m_objectIndex.reserve( m_linkVector.capacity() );
+  for ( long id = 0; id < size(); ++id ) index( id );
+  m_indexed = m_linkVector.size();
+}
+
+/// Update the object of a link
+void LinkManager::setObject( long id, const DataObject* pObject ) {
+  if ( Link* lnk = link( id ) ) {
+    lnk->setObject( pObject );
+    if ( indexed() ) index( id );
+  }
 }
 
 /// Add link by object reference and path string
 long LinkManager::addLink( const std::string& path, const DataObject* pObject ) {
-  long n = 0;
-  for ( auto& lnk : m_linkVector ) {
-    const DataObject* pO = lnk->object();
-    if ( pO && pO == pObject ) return n;
-    if ( lnk->path() == path ) {
-      if ( pObject && pObject != pO ) { lnk->setObject( const_cast<DataObject*>( pObject ) ); }
-      return n;
-    }
-    ++n;
+  // the first link matching either the object or the path is used
+  const long n = find( path );
+  if ( pObject ) {
+    if ( const long o = findObject( pObject ); o < n ) return o;
+  }
+  if ( n < size() ) {
+    if ( pObject && pObject != m_linkVector[n].object() ) { setObject( n, pObject ); }
+    return n;
   }
   // Link is completely unknown
-  return m_linkVector.emplace_back( new Link( m_linkVector.size(), path, const_cast<DataObject*>( pObject ) ) )->ID();
+  const auto* data    = m_linkVector.data();
+  const bool  wasSync = indexed();
+  const long  id      = m_linkVector.emplace_back( size(), path, const_cast<DataObject*>( pObject ) ).ID();
+  if ( m_linkVector.size() > s_indexThreshold ) {
+    if ( m_linkVector.data() != data || !wasSync ) {
+      reindex();
+    } else {
+      index( id );
+      m_indexed = m_linkVector.size();
+    }
+  }
+  return id;
 }
@@ -0,0 +1,42 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include <Gaudi/ReplayRecord.h>
+
+#include <ostream>
+
+namespace Gaudi {
+  ReplayRecord::ReplayRecord( const EventContext& ctx, std::vector<long> seeds, std::string reason )
+      : m_evt( ctx.evt() )
+      , m_runNumber( ctx.eventID().run_number() )
+      , m_eventNumber( ctx.eventID().event_number() )
+      , m_timeStamp( ctx.eventID().time_stamp() )
+      , m_timeStampNs( ctx.eventID().time_stamp_ns_offset() )
+      , m_lumiBlock( ctx.eventID().lumi_block() )
+      , m_bunchCrossingId( ctx.eventID().bunch_crossing_id() )
+      , m_seeds( std::move( seeds ) )
+      , m_reason( std::move( reason ) ) {}
+
+  const CLID& ReplayRecord::classID() {
+    static const CLID CLID_ReplayRecord = 225473520;
+    return CLID_ReplayRecord;
+  }
+
+  const std::string& ReplayRecord::location() {
+    static const std::string s_location = "/Event/ReplayRecord";
+    return s_location;
+  }
+
+  std::ostream& ReplayRecord::fillStream( std::ostream& s ) const {
+    s << "ReplayRecord: evt " << m_evt << ", " << eventID() << ", " << m_reason << ", seeds [";
+    for ( std::size_t i = 0; i < m_seeds.size(); ++i ) s << ( i ? ", " : "" ) << m_seeds[i];
+    return s << ']';
+  }
+} // namespace Gaudi
@@ -50,7 +50,10 @@ const DataObject* SmartRefBase::accessData( const DataObject* ) const {
     IRegistry* reg = source->registry();
     if ( !reg ) return nullptr;
     IDataProviderSvc* datasvc = reg->dataSvc();
-    if ( datasvc && datasvc->retrieveObject( link->path(), target ).isSuccess() ) { link->setObject( target ); }
+    // the resolved object is kept in the link (set by ID, as loading may add links to the source)
+    if ( datasvc && datasvc->retrieveObject( link->path(), target ).isSuccess() ) {
+      mgr->setObject( m_hintID, target );
+    }
   }
   return target;
 }
@@ -23,6 +23,8 @@
 
 #include <iostream>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace {
 
@@ -148,3 +150,43 @@ BOOST_AUTO_TEST_CASE( test_static_counter_histos, *boost::unit_test::tolerance(
     BOOST_TEST( nlohmann::json( histo1d[{ 3, "three" }] ).at( "bins" )[1] == 2 );
   }
 }
+
+BOOST_AUTO_TEST_CASE( test_concurrent_counter_histos ) {
+  Algo algo;
+
+  // testing concurrent lookups and insertions from several threads
+  constexpr int nThreads = 8, nKeys = 500, nRounds = 20;
+  Gaudi::Accumulators::HistogramMap<std::pair<int, std::string>, Gaudi::Accumulators::StaticHistogram<1>> histo1d{
+      &algo, []( std::pair<int, std::string> const& p ) { return std::format( "CGaudiH1D-{}-{}", p.first, p.second ); },
+      []( std::pair<int, std::string> const& p ) { return std::format( "Title {} ({})", p.second, p.first ); },
+      { 21, -10.5, 10.5, "X" } };
+  std::vector<std::vector<Gaudi::Accumulators::StaticHistogram<1>*>> seen( nThreads );
+  {
+    std::vector<std::jthread> threads;
+    for ( int t = 0; t < nThreads; ++t ) {
+      threads.emplace_back( [&, t]() {
+        for ( int r = 0; r < nRounds; ++r ) {
+          // each thread starts from a different key, so that insertions and lookups are mixed
+          for ( int i = 0; i < nKeys; ++i ) {
+            const int k = ( i + t * nKeys / nThreads ) % nKeys;
+            auto&     h = histo1d[{ k, std::to_string( k % 7 ) }];
+            ++h[-10.0];
+            if ( r == 0 ) seen[t].push_back( &h );
+          }
+        }
+      } );
+    }
+  }
+  for ( int k = 0; k < nKeys; ++k ) {
+    auto& h = histo1d[{ k, std::to_string( k % 7 ) }];
+    BOOST_TEST( nlohmann::json( h ).at( "bins" )[1] == nThreads * nRounds );
+  }
+  // the histograms are never moved
+  for ( int t = 0; t < nThreads; ++t ) {
+    for ( int i = 0; i < nKeys; ++i ) {
+      const int k = ( i + t * nKeys / nThreads ) % nKeys;
+      auto&     h = histo1d[{ k, std::to_string( k % 7 ) }];
+      BOOST_TEST( seen[t][i] == &h );
+    }
+  }
+}
@@ -0,0 +1,93 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+// Compare the insertion and the key lookup in KeyedContainer with the different mapping policies, for containers
+// of the size of hit and cluster containers.
+//
+// usage: KeyedContainer_benchmark [n_objects [n_repeat]]
+#include <GaudiKernel/KeyedContainer.h>
+#include <GaudiKernel/KeyedObject.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+  using Clock  = std::chrono::steady_clock;
+  using Object = KeyedObject<long>;
+
+  /// Time per object in nanoseconds for insertion and lookup with the given keys.
+  template <typename MAPPING>
+  void run( const std::string& name, const std::vector<long>& keys, int nRepeat ) {
+    std::vector<long> lookup = keys;
+    std::ranges::shuffle( lookup, std::mt19937{ 7 } );
+
+    double tInsert = 0, tLookup = 0;
+    long   found   = 0;
+    for ( int r = 0; r < nRepeat; ++r ) {
+      std::vector<Object*> objects( keys.size() );
+      for ( auto& o : objects ) o = new Object();
+
+      KeyedContainer<Object, MAPPING> c;
+      auto                            start = Clock::now();
+      c.reserve( keys.size() );
+      for ( std::size_t i = 0; i < keys.size(); ++i ) c.insert( objects[i], keys[i] );
+      tInsert += std::chrono::duration<double, std::nano>( Clock::now() - start ).count();
+
+      start = Clock::now();
+      for ( long k : lookup ) found += c.object( k ) != nullptr;
+      tLookup += std::chrono::duration<double, std::nano>( Clock::now() - start ).count();
+    }
+    const double n = double( keys.size() ) * nRepeat;
+    std::cout << std::setw( 14 ) << name << std::fixed << std::setprecision( 2 ) << std::setw( 12 ) << tInsert / n
+              << std::setw( 12 ) << tLookup / n << ( found == n ? "" : "  MISSING OBJECTS" ) << std::endl;
+  }
+
+  void header( const std::string& title ) {
+    std::cout << title << '\n'
+              << std::setw( 14 ) << "policy" << std::setw( 12 ) << "insert" << std::setw( 12 ) << "lookup"
+              << std::endl;
+  }
+} // namespace
+
+int main( int argc, char* argv[] ) {
+  const long nObjects = argc > 1 ? std::atol( argv[1] ) : 100000;
+  const int  nRepeat  = argc > 2 ? std::atoi( argv[2] ) : 20;
+
+  std::cout << nObjects << " objects x " << nRepeat << ", time per object in ns" << std::endl;
+
+  // keys 0, 1, 2, ... as assigned automatically (the only case supported by Containers::Vector)
+  std::vector<long> keys( nObjects );
+  std::iota( keys.begin(), keys.end(), 0 );
+  header( "sequential keys" );
+  run<Containers::Map>( "map", keys, nRepeat );
+  run<Containers::HashMap>( "hashmap", keys, nRepeat );
+  run<Containers::FlatHashMap>( "flathashmap", keys, nRepeat );
+  run<Containers::Array>( "array", keys, nRepeat );
+  run<Containers::Vector>( "vector", keys, nRepeat );
+
+  // sparse keys in random order, e.g. channel identifiers
+  std::mt19937 gen{ 42 };
+  for ( auto& k : keys ) k = 16 * k + std::uniform_int_distribution<long>{ 0, 15 }( gen );
+  std::ranges::shuffle( keys, gen );
+  header( "sparse keys" );
+  run<Containers::Map>( "map", keys, nRepeat );
+  run<Containers::HashMap>( "hashmap", keys, nRepeat );
+  run<Containers::FlatHashMap>( "flathashmap", keys, nRepeat );
+  run<Containers::Array>( "array", keys, nRepeat );
+
+  return 0;
+}
@@ -0,0 +1,103 @@
+/***********************************************************************************\
+* (c) Copyright 1998-2026 CERN for the benefit of the LHCb and ATLAS collaborations *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+// Measure the fixed overhead of Gaudi::Algorithm::sysExecute with respect to a direct call to execute(), for all
+// the combinations of the options that add instrumentation around execute() (auditors, timeline, context service).
+//
+// usage: sysExecute_benchmark [n_calls]
+#include <Gaudi/Algorithm.h>
+#include <Gaudi/Interfaces/IOptionsSvc.h>
+#include <GaudiKernel/Bootstrap.h>
+#include <GaudiKernel/EventContext.h>
+#include <GaudiKernel/IAppMgrUI.h>
+#include <GaudiKernel/IProperty.h>
+#include <GaudiKernel/ISvcLocator.h>
+#include <GaudiKernel/SmartIF.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+
+  /// Algorithm doing (almost) nothing, to expose the overhead of the framework.
+  struct EmptyAlg : Gaudi::Algorithm {
+    using Algorithm::Algorithm;
+    StatusCode execute( const EventContext& ) const override {
+      ++m_calls;
+      return StatusCode::SUCCESS;
+    }
+    mutable long m_calls = 0;
+  };
+
+  /// Time per call in nanoseconds.
+  template <typename F>
+  double timePerCall( long n, F&& f ) {
+    const auto start = Clock::now();
+    for ( long i = 0; i < n; ++i ) f();
+    return std::chrono::duration<double, std::nano>( Clock::now() - start ).count() / n;
+  }
+
+  bool run( ISvcLocator* svcLoc, long n, bool audit, bool timeline, bool context ) {
+    const std::string name = std::string{ "Alg_" } + ( audit ? "A" : "a" ) + ( timeline ? "T" : "t" ) +
+                             ( context ? "C" : "c" );
+    auto& opts = svcLoc->getOptsSvc();
+    opts.set( name + ".AuditExecute", audit ? "True" : "False" );
+    opts.set( name + ".RegisterForContextService", context ? "True" : "False" );
+    // the algorithm takes the Timeline flag from TimelineSvc during initialize
+    auto timelineSvc = svcLoc->service<IProperty>( "TimelineSvc" );
+    if ( !timelineSvc || timelineSvc->setProperty( "RecordTimeline", timeline ).isFailure() ) return false;
+
+    auto                alg = new EmptyAlg( name, svcLoc );
+    SmartIF<IAlgorithm> ialg{ alg };
+    if ( alg->sysInitialize().isFailure() || alg->sysStart().isFailure() ) return false;
+
+    EventContext ctx{ 0, 0 };
+    const double direct    = timePerCall( n, [&]() { alg->execute( ctx ).ignore(); } );
+    const double framework = timePerCall( n, [&]() { alg->sysExecute( ctx ).ignore(); } );
+
+    std::cout << std::boolalpha << std::setw( 7 ) << audit << std::setw( 10 ) << timeline << std::setw( 9 ) << context
+              << std::fixed << std::setprecision( 1 ) << std::setw( 14 ) << framework << std::setw( 14 )
+              << framework - direct << std::endl;
+
+    return alg->sysStop().isSuccess() && alg->sysFinalize().isSuccess() && alg->m_calls == 2 * n;
+  }
+} // namespace
+
+int main( int argc, char* argv[] ) {
+  const long n = argc > 1 ? std::atol( argv[1] ) : 1000000;
+
+  auto               app = Gaudi::createApplicationMgr();
+  SmartIF<IProperty> appProp{ app };
+  appProp->setProperty( "JobOptionsType", "NONE" ).ignore();
+  appProp->setPropertyRepr( "AppName", "''" ).ignore();
+  appProp->setProperty( "OutputLevel", 6 ).ignore();
+  appProp->setProperty( "EvtSel", "NONE" ).ignore();
+  if ( !app->configure() || !app->initialize() || !app->start() ) return 1;
+
+  SmartIF<ISvcLocator> svcLoc{ app };
+
+  std::cout << n << " calls per configuration, time per call in ns\n"
+            << "  audit  timeline  context    sysExecute      overhead" << std::endl;
+  bool ok = true;
+  for ( bool audit : { false, true } ) {
+    for ( bool timeline : { false, true } ) {
+      for ( bool context : { false, true } ) ok = run( svcLoc.get(), n, audit, timeline, context ) && ok;
+    }
+  }
+
+  ok = app->stop().isSuccess() && ok;
+  ok = app->finalize().isSuccess() && ok;
+  ok = app->terminate().isSuccess() && ok;
+  return ok ? 0 : 1;
+}
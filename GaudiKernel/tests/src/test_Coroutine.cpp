@@ -0,0 +1,113 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE test_Coroutine
+#include <Gaudi/Coroutine.h>
+#include <boost/test/unit_test.hpp>
+#include <semaphore>
+#include <stdexcept>
+#include <thread>
+
+using namespace Gaudi::Coroutine;
+
+namespace {
+  /// Executor counting the suspensions and the resumptions
+  struct CountingExecutor : InlineExecutor {
+    void post( std::function<void()> resume ) override {
+      ++resumed;
+      resume();
+    }
+    void suspended() override { ++suspensions; }
+    int  suspensions = 0;
+    int  resumed     = 0;
+  };
+
+  Task addOne( Completion<int> c, int& out ) {
+    out = co_await c + 1;
+    co_return StatusCode::SUCCESS;
+  }
+  Task fails() {
+    co_await sleep_for( std::chrono::milliseconds( 1 ) );
+    throw std::runtime_error( "failure" );
+    co_return StatusCode::SUCCESS;
+  }
+  Task parent( Completion<int> c, int& out, bool& caught ) {
+    StatusCode sc = co_await addOne( c, out );
+    try {
+      co_await fails();
+    } catch ( const std::runtime_error& ) { caught = true; }
+    co_return sc;
+  }
+  Task sleeper( std::thread::id& resumedIn ) {
+    co_await sleep_for( std::chrono::milliseconds( 1 ) );
+    resumedIn = std::this_thread::get_id();
+    co_return StatusCode::SUCCESS;
+  }
+} // namespace
+
+BOOST_AUTO_TEST_CASE( test_completion ) {
+  CountingExecutor executor;
+  Completion<int>  c;
+  int              out    = 0;
+  bool             called = false;
+  addOne( c, out ).start( executor, {}, [&]( StatusCode sc, std::exception_ptr e ) {
+    called = sc.isSuccess() && !e;
+  } );
+  BOOST_CHECK( !called );
+  BOOST_CHECK( executor.suspensions == 1 );
+  c.set_value( 41 );
+  BOOST_CHECK( called );
+  BOOST_CHECK( executor.resumed == 1 );
+  BOOST_CHECK( out == 42 );
+
+  // no suspension if the result is already available
+  Completion<int> ready;
+  ready.set_value( 1 );
+  called = false;
+  addOne( ready, out ).start( executor, {}, [&]( StatusCode sc, std::exception_ptr ) { called = sc.isSuccess(); } );
+  BOOST_CHECK( called );
+  BOOST_CHECK( executor.suspensions == 1 );
+  BOOST_CHECK( out == 2 );
+}
+
+BOOST_AUTO_TEST_CASE( test_nested ) {
+  CountingExecutor      executor;
+  Completion<int>       c;
+  int                   out      = 0;
+  bool                  caught   = false;
+  int                   restored = 0;
+  std::binary_semaphore done{ 0 };
+  StatusCode            result  = StatusCode::FAILURE;
+  auto                  restore = [&]() { ++restored; };
+  parent( c, out, caught ).start( executor, restore, [&]( StatusCode sc, std::exception_ptr e ) {
+    if ( !e ) result = sc;
+    done.release();
+  } );
+  c.set_value( 1 );
+  // the timer resumes the coroutine in its own thread
+  done.acquire();
+  BOOST_CHECK( result.isSuccess() );
+  BOOST_CHECK( out == 2 );
+  BOOST_CHECK( caught );
+  BOOST_CHECK( executor.suspensions == 2 );
+  BOOST_CHECK( restored == 2 );
+}
+
+BOOST_AUTO_TEST_CASE( test_run_loop ) {
+  std::thread::id resumedIn;
+  int             restored = 0;
+  BOOST_CHECK( RunLoop{}.run( sleeper( resumedIn ), [&]() { ++restored; } ).isSuccess() );
+  // resumed in the waiting thread, not in the one of the timer
+  BOOST_CHECK( resumedIn == std::this_thread::get_id() );
+  BOOST_CHECK( restored == 1 );
+
+  BOOST_CHECK_THROW( RunLoop{}.run( fails() ).ignore(), std::runtime_error );
+}
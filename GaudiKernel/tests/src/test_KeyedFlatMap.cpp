@@ -0,0 +1,125 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE test_KeyedFlatMap
+#include <Gaudi/Arena/Monotonic.h>
+#include <GaudiKernel/GaudiException.h>
+#include <GaudiKernel/KeyedContainer.h>
+#include <GaudiKernel/KeyedFlatMap.h>
+#include <GaudiKernel/KeyedObject.h>
+#include <boost/test/unit_test.hpp>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+  void* ptr( long i ) { return reinterpret_cast<void*>( 0x1000 + 8 * i ); }
+} // namespace
+
+BOOST_AUTO_TEST_CASE( insert_find ) {
+  Containers::KeyedFlatMap<> m;
+  BOOST_CHECK( m.empty() );
+  BOOST_CHECK( m.find( 0 ) == m.end() );
+  for ( long i = -100; i < 100; ++i ) BOOST_CHECK( m.insert( { i, ptr( i ) } ).second );
+  BOOST_CHECK_EQUAL( m.size(), 200u );
+  // duplicated keys are not inserted
+  auto [it, inserted] = m.insert( { 42, ptr( 0 ) } );
+  BOOST_CHECK( !inserted );
+  BOOST_CHECK( it->second == ptr( 42 ) );
+  // null objects are not accepted
+  BOOST_CHECK( !m.insert( { 1000, nullptr } ).second );
+  for ( long i = -100; i < 100; ++i ) {
+    auto f = m.find( i );
+    BOOST_REQUIRE( f != m.end() );
+    BOOST_CHECK( f->second == ptr( i ) );
+  }
+  BOOST_CHECK( m.find( 100 ) == m.end() );
+  BOOST_CHECK_EQUAL( std::distance( m.begin(), m.end() ), 200 );
+
+  m.clear();
+  BOOST_CHECK( m.empty() );
+  BOOST_CHECK( m.capacity() > 0 );
+  BOOST_CHECK( m.begin() == m.end() );
+  BOOST_CHECK( m.find( 0 ) == m.end() );
+}
+
+BOOST_AUTO_TEST_CASE( reserve ) {
+  Containers::KeyedFlatMap<> m;
+  m.reserve( 1000 );
+  const auto capacity = m.capacity();
+  BOOST_CHECK( capacity >= 1000 );
+  for ( long i = 0; i < 1000; ++i ) m.insert( { 7 * i, ptr( i ) } );
+  BOOST_CHECK_EQUAL( m.capacity(), capacity );
+}
+
+BOOST_AUTO_TEST_CASE( erase ) {
+  // compare with std::map on random insertions and removals (with many collisions)
+  std::mt19937                       gen{ 1 };
+  std::uniform_int_distribution<int> key{ 0, 300 };
+  Containers::KeyedFlatMap<>         m;
+  std::map<long, void*>              ref;
+  for ( int i = 0; i < 20000; ++i ) {
+    const long k = key( gen );
+    if ( i % 3 ) {
+      BOOST_CHECK_EQUAL( m.insert( { k, ptr( k ) } ).second, ref.emplace( k, ptr( k ) ).second );
+    } else if ( auto f = m.find( k ); f != m.end() ) {
+      m.erase( f );
+      BOOST_CHECK_EQUAL( ref.erase( k ), 1u );
+    } else {
+      BOOST_CHECK_EQUAL( ref.count( k ), 0u );
+    }
+  }
+  BOOST_CHECK_EQUAL( m.size(), ref.size() );
+  for ( long k = 0; k <= 300; ++k ) BOOST_CHECK_EQUAL( m.find( k ) != m.end(), ref.count( k ) == 1 );
+  std::map<long, void*> content( m.begin(), m.end() );
+  BOOST_CHECK( content == ref );
+}
+
+BOOST_AUTO_TEST_CASE( arena ) {
+  using Alloc = Gaudi::Allocator::MonotonicArena<std::pair<long, void*>>;
+  Gaudi::Arena::Monotonic<>        arena( 1024 );
+  Containers::KeyedFlatMap<Alloc>  m( &arena );
+  for ( long i = 0; i < 1000; ++i ) m.insert( { i, ptr( i ) } );
+  BOOST_CHECK( arena.num_allocations() > 0 );
+  BOOST_CHECK( m.get_allocator().resource() == &arena );
+  for ( long i = 0; i < 1000; ++i ) BOOST_CHECK( m.find( i )->second == ptr( i ) );
+
+  auto copy = m;
+  BOOST_CHECK_EQUAL( copy.size(), 1000u );
+  auto moved = std::move( m );
+  BOOST_CHECK_EQUAL( moved.size(), 1000u );
+  BOOST_CHECK( m.empty() );
+}
+
+BOOST_AUTO_TEST_CASE( keyed_container ) {
+  using Object    = KeyedObject<long>;
+  using Container = KeyedContainer<Object, Containers::FlatHashMap>;
+  Container c;
+  c.reserve( 100 );
+  // first in sequence, then with arbitrary keys
+  for ( long i = 0; i < 10; ++i ) BOOST_CHECK_EQUAL( c.insert( new Object() ), i );
+  for ( long i = 0; i < 90; ++i ) c.insert( new Object(), 1000 - 7 * i );
+  BOOST_CHECK_EQUAL( c.size(), 100u );
+  BOOST_CHECK_EQUAL( c.object( 3 )->key(), 3 );
+  BOOST_CHECK_EQUAL( c.object( 1000 )->key(), 1000 );
+  BOOST_CHECK( !c.object( 999 ) );
+  auto duplicate = std::make_unique<Object>();
+  BOOST_CHECK_THROW( c.insert( duplicate.get(), 1000 ), GaudiException );
+  c.erase( 1000 );
+  BOOST_CHECK( !c.object( 1000 ) );
+  BOOST_CHECK_EQUAL( c.size(), 99u );
+  // keys after the largest one are assigned automatically
+  BOOST_CHECK_EQUAL( c.insert( new Object() ), 1001 );
+  BOOST_CHECK_EQUAL( Container::classID(), Container().clID() );
+  c.clear();
+  BOOST_CHECK_EQUAL( c.size(), 0u );
+}
@@ -0,0 +1,103 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE test_LinkManager
+#include <GaudiKernel/DataObject.h>
+#include <GaudiKernel/LinkManager.h>
+#include <boost/test/unit_test.hpp>
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE( add_and_find ) {
+  // enough links to use the index of the paths
+  std::vector<DataObject> objects( 100 );
+  LinkManager             mgr;
+  BOOST_CHECK( mgr.empty() );
+  for ( int i = 0; i < 100; ++i ) {
+    BOOST_CHECK_EQUAL( mgr.addLink( "/Event/Link" + std::to_string( i ), i % 2 ? &objects[i] : nullptr ), i );
+  }
+  BOOST_CHECK_EQUAL( mgr.size(), 100 );
+  for ( int i = 0; i < 100; ++i ) {
+    const std::string path = "/Event/Link" + std::to_string( i );
+    auto*             lnk  = mgr.link( path );
+    BOOST_REQUIRE( lnk );
+    BOOST_CHECK_EQUAL( lnk->ID(), i );
+    BOOST_CHECK_EQUAL( lnk->path(), path );
+    BOOST_CHECK( lnk == mgr.link( i ) );
+    BOOST_CHECK( lnk->object() == ( i % 2 ? &objects[i] : nullptr ) );
+    // the same path or object gives back the same link
+    BOOST_CHECK_EQUAL( mgr.addLink( path, nullptr ), i );
+    if ( i % 2 ) BOOST_CHECK_EQUAL( mgr.addLink( "/Event/Other", &objects[i] ), i );
+  }
+  BOOST_CHECK( !mgr.link( "/Event/Other" ) );
+  BOOST_CHECK( !mgr.link( std::string_view{} ) );
+  BOOST_CHECK( !mgr.link( 100 ) );
+  BOOST_CHECK( !mgr.link( -1 ) );
+  BOOST_CHECK_EQUAL( mgr.link( &objects[3] )->ID(), 3 );
+
+  // resolve a link
+  BOOST_CHECK_EQUAL( mgr.addLink( "/Event/Link4", &objects[4] ), 4 );
+  BOOST_CHECK( mgr.link( 4 )->object() == &objects[4] );
+
+  // the index survives a move
+  LinkManager moved = std::move( mgr );
+  BOOST_CHECK_EQUAL( moved.link( "/Event/Link42" )->ID(), 42 );
+  int n = 0;
+  for ( const auto& lnk : moved ) BOOST_CHECK_EQUAL( lnk.ID(), n++ );
+  BOOST_CHECK_EQUAL( n, 100 );
+}
+
+BOOST_AUTO_TEST_CASE( find_by_object ) {
+  std::vector<DataObject> objects( 100 );
+  LinkManager             mgr;
+  for ( int i = 0; i < 50; ++i ) mgr.addLink( "/Event/Link" + std::to_string( i ), nullptr );
+  // objects set on the links after they were indexed
+  mgr.setObject( 10, &objects[10] );
+  BOOST_CHECK_EQUAL( mgr.link( &objects[10] )->ID(), 10 );
+  BOOST_CHECK_EQUAL( mgr.addLink( "/Event/Other", &objects[10] ), 10 );
+  BOOST_CHECK_EQUAL( mgr.addLink( "/Event/Link20", &objects[20] ), 20 );
+  BOOST_CHECK_EQUAL( mgr.link( &objects[20] )->ID(), 20 );
+  // the first link matching the object or the path wins
+  BOOST_CHECK_EQUAL( mgr.addLink( "/Event/Link30", &objects[20] ), 20 );
+  BOOST_CHECK_EQUAL( mgr.addLink( "/Event/Link5", &objects[20] ), 5 );
+  BOOST_CHECK( mgr.link( &objects[20] ) == mgr.link( 5 ) );
+  // the same object on a later link does not hide the first one
+  mgr.setObject( 40, &objects[10] );
+  BOOST_CHECK_EQUAL( mgr.link( &objects[10] )->ID(), 10 );
+  // an object replaced on a link is found on the next link using it
+  mgr.setObject( 10, &objects[11] );
+  BOOST_CHECK_EQUAL( mgr.link( &objects[11] )->ID(), 10 );
+  BOOST_CHECK_EQUAL( mgr.link( &objects[10] )->ID(), 40 );
+  BOOST_CHECK( !mgr.link( &objects[99] ) );
+  // new links are indexed by object too
+  BOOST_CHECK_EQUAL( mgr.addLink( "/Event/New", &objects[99] ), 50 );
+  BOOST_CHECK_EQUAL( mgr.addLink( "/Event/Other", &objects[99] ), 50 );
+  BOOST_CHECK_EQUAL( mgr.link( &objects[99] )->ID(), 50 );
+}
+
+BOOST_AUTO_TEST_CASE( object_set_on_link ) {
+  std::vector<DataObject> objects( 100 );
+  LinkManager             mgr;
+  for ( int i = 0; i < 50; ++i ) mgr.addLink( "/Event/Link" + std::to_string( i ), nullptr );
+  // objects set directly on the links, bypassing the index
+  for ( int i = 0; i < 50; ++i ) mgr.link( i )->setObject( &objects[i] );
+  const LinkManager& cmgr = mgr;
+  BOOST_CHECK_EQUAL( cmgr.link( &objects[25] )->ID(), 25 );
+  BOOST_CHECK_EQUAL( mgr.link( &objects[25] )->ID(), 25 );
+  // no duplicates are created
+  BOOST_CHECK_EQUAL( mgr.addLink( "/Event/Other", &objects[30] ), 30 );
+  BOOST_CHECK_EQUAL( mgr.addLink( "/Event/Other", &objects[31] ), 31 );
+  BOOST_CHECK_EQUAL( mgr.size(), 50 );
+  // the links found are indexed from then on
+  mgr.link( 30 )->setObject( &objects[99] );
+  BOOST_CHECK_EQUAL( mgr.link( &objects[99] )->ID(), 30 );
+  BOOST_CHECK( !mgr.link( &objects[30] ) );
+}
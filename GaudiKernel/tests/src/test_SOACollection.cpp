@@ -0,0 +1,84 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE test_SOACollection
+#include <Gaudi/SOACollection.h>
+#include <GaudiKernel/AnyDataWrapper.h>
+#include <boost/test/unit_test.hpp>
+#include <cstdint>
+
+namespace {
+  struct X : Gaudi::SOAField<float> {};
+  struct Y : Gaudi::SOAField<float> {};
+  struct Id : Gaudi::SOAField<int> {};
+  using Points = Gaudi::SOACollection<X, Y, Id>;
+
+  template <typename T>
+  bool isAligned( const T* p ) {
+    return reinterpret_cast<std::uintptr_t>( p ) % Points::alignment == 0;
+  }
+} // namespace
+
+BOOST_AUTO_TEST_CASE( test_fill ) {
+  Points p;
+  BOOST_CHECK( p.empty() );
+  BOOST_CHECK( p.capacity() == 0 );
+  for ( int i = 0; i < 100; ++i ) p.emplace_back( i, 2.f * i, -i );
+  BOOST_CHECK( p.size() == 100 );
+  BOOST_CHECK( p.capacity() >= 100 );
+  BOOST_CHECK( p.capacity() % Points::padding == 0 );
+  BOOST_CHECK( isAligned( p.data<X>() ) );
+  BOOST_CHECK( isAligned( p.data<Y>() ) );
+  BOOST_CHECK( isAligned( p.data<Id>() ) );
+
+  auto [x, y, id] = p.columns();
+  BOOST_CHECK( x.size() == 100 );
+  BOOST_CHECK( x[10] == 10.f );
+  BOOST_CHECK( y[10] == 20.f );
+  BOOST_CHECK( id[10] == -10 );
+  // padding elements are zero
+  BOOST_CHECK( p.data<Y>()[p.capacity() - 1] == 0.f );
+}
+
+BOOST_AUTO_TEST_CASE( test_resize ) {
+  Points p( 10 );
+  BOOST_CHECK( p.size() == 10 );
+  p.column<X>()[3] = 3.f;
+  p.resize( 1000 );
+  BOOST_CHECK( p.size() == 1000 );
+  BOOST_CHECK( p.column<X>()[3] == 3.f );
+  BOOST_CHECK( p.column<X>()[999] == 0.f );
+  p.resize( 5 );
+  BOOST_CHECK( p.size() == 5 );
+  const auto capacity = p.capacity();
+  p.clear();
+  BOOST_CHECK( p.empty() );
+  BOOST_CHECK( p.capacity() == capacity );
+}
+
+BOOST_AUTO_TEST_CASE( test_copy_move ) {
+  Points p;
+  for ( int i = 0; i < 20; ++i ) p.emplace_back( i, i, i );
+  Points copy = p;
+  BOOST_CHECK( copy.size() == 20 );
+  BOOST_CHECK( copy.data<X>() != p.data<X>() );
+  BOOST_CHECK( copy.column<Id>()[19] == 19 );
+
+  const float* data  = p.data<X>();
+  Points       moved = std::move( p );
+  BOOST_CHECK( moved.data<X>() == data );
+  BOOST_CHECK( moved.size() == 20 );
+
+  // can be stored in the TES
+  AnyDataWrapper<Points> wrapper{ std::move( moved ) };
+  BOOST_CHECK( wrapper.getData().column<Y>()[7] == 7.f );
+  BOOST_CHECK( wrapper.getData().data<X>() == data );
+}
@@ -35,6 +35,7 @@
 #  pragma warning( disable : 1125 )
 #endif
 
+#include <GaudiMP/SharedMemoryRing.h>
 #include <GaudiMP/TESSerializer.h>
 
 #ifdef __ICC
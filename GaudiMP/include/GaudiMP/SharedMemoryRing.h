@@ -0,0 +1,117 @@
+/***********************************************************************************\
+* (c) Copyright 1998-2026 CERN for the benefit of the LHCb and ATLAS collaborations *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <GaudiKernel/Kernel.h>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+class TBufferFile;
+
+namespace GaudiMP {
+  /** Ring of fixed size buffers in shared memory, used to pass serialized events between processes.
+   *
+   *  The memory is allocated with `memfd_create` and mapped in the address space of the process, so it is
+   *  automatically shared with the processes forked afterwards (or it can be attached from another process
+   *  via the file descriptor, see fd()).
+   *
+   *  The slots are exchanged through two lock-free bounded queues (also in the shared memory): producers
+   *  take a free slot with acquire(), fill it and hand it to the consumers with publish(); consumers get the
+   *  published slots with consume() and give them back with release().  Only slot indices move through the
+   *  queues, so the data can be written and read in place: send() with a fill function serializes directly
+   *  in the memory of a slot, while send() with a TBufferFile copies an already serialized buffer.
+   *
+   *  Any number of producers and consumers is supported.  Each producer must call close() when done: once
+   *  all the producers declared at construction have closed the ring, consume() returns npos after the last
+   *  published slot.
+   *
+   *  @note This is only a building block: it is not used yet by GMPBase (which still passes the events
+   *        through multiprocessing queues) nor by ForkingEventLoopMgr (where each worker reads its own input).
+   *
+   *  Example (reader to workers):
+   *  @code
+   *  GaudiMP::SharedMemoryRing ring( 16, 64 * 1024 * 1024 ); // before forking
+   *  // reader
+   *  if ( !ring.send( [&]( TBufferFile& buffer ) { serializer.dumpBuffer( buffer ); } ) ) {
+   *    // the event does not fit in a slot
+   *  }
+   *  // worker
+   *  auto slot = ring.consume();
+   *  if ( slot != ring.npos ) {
+   *    TBufferFile in = ring.bufferFor( slot );
+   *    serializer.loadBuffer( in );
+   *    ring.release( slot );
+   *  }
+   *  @endcode
+   */
+  class GAUDI_API SharedMemoryRing final {
+  public:
+    /// Invalid slot index, returned when the ring is closed.
+    static constexpr std::size_t npos = static_cast<std::size_t>( -1 );
+
+    /// Create a new ring with `nSlots` buffers of `slotSize` bytes, to be filled by `nProducers` producers.
+    SharedMemoryRing( std::size_t nSlots, std::size_t slotSize, int nProducers = 1,
+                      const std::string& name = "GaudiMP::SharedMemoryRing" );
+    /// Attach to a ring created by another process, given its file descriptor.
+    explicit SharedMemoryRing( int fd );
+
+    SharedMemoryRing( const SharedMemoryRing& )            = delete;
+    SharedMemoryRing& operator=( const SharedMemoryRing& ) = delete;
+
+    ~SharedMemoryRing();
+
+    /// File descriptor of the shared memory.
+    int fd() const { return m_fd; }
+    /// Number of slots in the ring.
+    std::size_t slots() const;
+    /// Capacity in bytes of each slot.
+    std::size_t slotSize() const;
+
+    /// Get a free slot to be filled (blocking until one is available).
+    std::size_t acquire();
+    /// Pointer to the memory of a slot.
+    char* data( std::size_t slot ) const;
+    /// Make a slot filled with `length` bytes available to the consumers.
+    void publish( std::size_t slot, std::size_t length );
+    /// Declare that the calling producer will not publish anything else.
+    void close();
+
+    /// Get the next published slot (blocking), or npos if all producers closed the ring and no slot is left.
+    std::size_t consume();
+    /// Content of a published slot.
+    std::string_view view( std::size_t slot ) const;
+    /// Give back a slot obtained with consume().
+    void release( std::size_t slot );
+
+    /// Copy the content of a buffer in a free slot and publish it.
+    /// Return false if the buffer does not fit in a slot.
+    bool send( const TBufferFile& buffer );
+    /// Let `fill` write into a buffer mapped on the memory of a free slot, then publish the slot.
+    /// Nothing is copied, but if the content outgrows the slot it is discarded and false is returned.
+    bool send( const std::function<void( TBufferFile& )>& fill );
+    /// Read-only buffer pointing to the memory of a published slot (to be used before releasing it).
+    TBufferFile bufferFor( std::size_t slot ) const;
+
+  private:
+    struct Layout;
+    class Queue;
+
+    void map( std::size_t size );
+
+    int         m_fd     = -1;
+    char*       m_base   = nullptr;
+    std::size_t m_size   = 0;
+    Layout*     m_layout = nullptr;
+  };
+} // namespace GaudiMP
@@ -65,6 +65,9 @@ namespace GaudiMP {
     /// print out the contents of m_itemList and m_optItemList (std::cout)
     void checkItems();
 
+    /// Compress each serialized object with LZ4 at the given level (0 disables the compression)
+    void setCompressionLevel( int level ) { m_compressionLevel = level; }
+
     virtual ~TESSerializer() {}
 
   protected:
@@ -108,5 +111,9 @@ namespace GaudiMP {
     bool m_strict;
     /// IAddress Creator for Opaque Addresses
     IAddressCreator* m_addressCreator;
+    /// Compression level of the serialized objects (0 means no compression)
+    int m_compressionLevel = 0;
+    /// Scratch buffer for (de)compression
+    std::vector<char> m_zipBuffer;
   };
 } // namespace GaudiMP
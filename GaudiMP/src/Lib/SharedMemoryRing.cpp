@@ -0,0 +1,317 @@
+/***********************************************************************************\
+* (c) Copyright 1998-2026 CERN for the benefit of the LHCb and ATLAS collaborations *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include <GaudiMP/SharedMemoryRing.h>
+
+#include <GaudiKernel/GaudiException.h>
+
+#include <TBufferFile.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+  constexpr char        s_magic[8]  = { 'G', 'M', 'P', 'R', 'I', 'N', 'G', '1' };
+  constexpr std::size_t s_cacheLine = 64;
+
+  constexpr std::size_t alignUp( std::size_t n, std::size_t a = s_cacheLine ) { return ( n + a - 1 ) / a * a; }
+
+  std::size_t nextPow2( std::size_t n ) {
+    std::size_t p = 1;
+    while ( p < n ) p <<= 1;
+    return p;
+  }
+
+  [[noreturn]] void fail( const std::string& msg ) {
+    throw GaudiException( msg + ": " + std::strerror( errno ), "GaudiMP::SharedMemoryRing", StatusCode::FAILURE );
+  }
+
+  /// Busy wait for a short while, then sleep, to avoid burning CPU when the other side is slow.
+  class Backoff {
+    unsigned m_count = 0;
+
+  public:
+    void operator()() {
+      if ( ++m_count < 64 ) {
+        std::this_thread::yield();
+      } else {
+        std::this_thread::sleep_for( std::chrono::microseconds( 50 ) );
+      }
+    }
+  };
+
+  /// Start of the slot being filled in place by the current thread (see SharedMemoryRing::send).
+  thread_local const char* s_fillingSlot = nullptr;
+
+  /// Reallocation function of the buffers written in place in a slot.
+  /// The shared memory cannot grow, so the content is moved to the heap and the caller detects it.
+  char* growOutOfSlot( char* current, std::size_t newSize, std::size_t oldSize ) {
+    auto grown = new char[newSize];
+    std::memcpy( grown, current, std::min( oldSize, newSize ) );
+    if ( current != s_fillingSlot ) delete[] current;
+    return grown;
+  }
+
+  // the atomics are used across processes, so they must not rely on a lock
+  static_assert( std::atomic<std::uint64_t>::is_always_lock_free );
+  static_assert( std::atomic<std::int64_t>::is_always_lock_free );
+
+  struct Cell {
+    std::atomic<std::uint64_t> sequence;
+    std::uint64_t              value;
+  };
+
+  struct QueueHead {
+    alignas( s_cacheLine ) std::atomic<std::uint64_t> enqueuePos{ 0 };
+    alignas( s_cacheLine ) std::atomic<std::uint64_t> dequeuePos{ 0 };
+  };
+
+  /// Sizes and offsets of the parts of the shared memory.
+  struct Geometry {
+    char          magic[8];
+    std::uint64_t nSlots;
+    std::uint64_t slotSize;
+    std::uint64_t capacity; ///< size of the queues (power of 2)
+    std::uint64_t cellsOffset;
+    std::uint64_t lengthsOffset;
+    std::uint64_t dataOffset;
+    std::uint64_t totalSize;
+  };
+} // namespace
+
+/// Header at the beginning of the shared memory, followed by the cells of the two queues, the lengths of the
+/// published buffers and the slots.
+struct GaudiMP::SharedMemoryRing::Layout : Geometry {
+  alignas( s_cacheLine ) std::atomic<std::int64_t> producers;
+
+  QueueHead freeSlots;
+  QueueHead readySlots;
+
+  static Geometry compute( std::size_t nSlots, std::size_t slotSize ) {
+    Geometry l;
+    std::memcpy( l.magic, s_magic, sizeof( s_magic ) );
+    l.nSlots        = nSlots;
+    l.slotSize      = alignUp( slotSize );
+    l.capacity      = nextPow2( nSlots );
+    l.cellsOffset   = alignUp( sizeof( Layout ) );
+    l.lengthsOffset = alignUp( l.cellsOffset + 2 * l.capacity * sizeof( Cell ) );
+    l.dataOffset    = alignUp( l.lengthsOffset + nSlots * sizeof( std::uint64_t ), 4096 );
+    l.totalSize     = l.dataOffset + nSlots * l.slotSize;
+    return l;
+  }
+
+  Cell* cells( bool ready ) {
+    return reinterpret_cast<Cell*>( base() + cellsOffset ) + ( ready ? capacity : 0 );
+  }
+  std::uint64_t* lengths() { return reinterpret_cast<std::uint64_t*>( base() + lengthsOffset ); }
+  char*          slot( std::size_t idx ) { return base() + dataOffset + idx * slotSize; }
+
+private:
+  char* base() { return reinterpret_cast<char*>( this ); }
+};
+
+/// Bounded multi-producer/multi-consumer queue of slot indices (D. Vyukov's algorithm).
+class GaudiMP::SharedMemoryRing::Queue {
+  QueueHead&    m_head;
+  Cell*         m_cells;
+  std::uint64_t m_mask;
+
+public:
+  Queue( Layout& l, bool ready )
+      : m_head( ready ? l.readySlots : l.freeSlots ), m_cells( l.cells( ready ) ), m_mask( l.capacity - 1 ) {}
+
+  void init() {
+    for ( std::uint64_t i = 0; i <= m_mask; ++i ) new ( m_cells + i ) Cell{ { i }, 0 };
+  }
+
+  bool push( std::uint64_t value ) {
+    auto pos = m_head.enqueuePos.load( std::memory_order_relaxed );
+    while ( true ) {
+      Cell&      cell = m_cells[pos & m_mask];
+      const auto seq  = cell.sequence.load( std::memory_order_acquire );
+      const auto diff = static_cast<std::int64_t>( seq - pos );
+      if ( diff == 0 ) {
+        if ( m_head.enqueuePos.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) ) {
+          cell.value = value;
+          cell.sequence.store( pos + 1, std::memory_order_release );
+          return true;
+        }
+      } else if ( diff < 0 ) {
+        return false; // full
+      } else {
+        pos = m_head.enqueuePos.load( std::memory_order_relaxed );
+      }
+    }
+  }
+
+  bool pop( std::uint64_t& value ) {
+    auto pos = m_head.dequeuePos.load( std::memory_order_relaxed );
+    while ( true ) {
+      Cell&      cell = m_cells[pos & m_mask];
+      const auto seq  = cell.sequence.load( std::memory_order_acquire );
+      const auto diff = static_cast<std::int64_t>( seq - ( pos + 1 ) );
+      if ( diff == 0 ) {
+        if ( m_head.dequeuePos.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) ) {
+          value = cell.value;
+          cell.sequence.store( pos + m_mask + 1, std::memory_order_release );
+          return true;
+        }
+      } else if ( diff < 0 ) {
+        return false; // empty
+      } else {
+        pos = m_head.dequeuePos.load( std::memory_order_relaxed );
+      }
+    }
+  }
+};
+
+GaudiMP::SharedMemoryRing::SharedMemoryRing( std::size_t nSlots, std::size_t slotSize, int nProducers,
+                                             const std::string& name ) {
+  if ( nSlots == 0 || slotSize == 0 || nProducers < 1 ) {
+    throw GaudiException( "invalid ring configuration", "GaudiMP::SharedMemoryRing", StatusCode::FAILURE );
+  }
+  const Geometry layout = Layout::compute( nSlots, slotSize );
+
+  // the descriptor must survive fork, but not exec
+  m_fd = ::memfd_create( name.c_str(), MFD_CLOEXEC );
+  if ( m_fd < 0 ) fail( "memfd_create failed" );
+  if ( ::ftruncate( m_fd, layout.totalSize ) != 0 ) fail( "cannot resize shared memory" );
+  map( layout.totalSize );
+
+  // the memory of a new memfd is zero-filled, we only need to set the header and the queues
+  static_cast<Geometry&>( *m_layout ) = layout;
+  new ( &m_layout->producers ) std::atomic<std::int64_t>{ nProducers };
+  new ( &m_layout->freeSlots ) QueueHead{};
+  new ( &m_layout->readySlots ) QueueHead{};
+
+  Queue freeSlots{ *m_layout, false };
+  freeSlots.init();
+  Queue{ *m_layout, true }.init();
+  for ( std::size_t i = 0; i < nSlots; ++i ) freeSlots.push( i );
+}
+
+GaudiMP::SharedMemoryRing::SharedMemoryRing( int fd ) : m_fd( ::dup( fd ) ) {
+  if ( m_fd < 0 ) fail( "invalid file descriptor" );
+  struct stat st;
+  if ( ::fstat( m_fd, &st ) != 0 ) fail( "cannot stat shared memory" );
+  if ( static_cast<std::size_t>( st.st_size ) < sizeof( Layout ) ) {
+    throw GaudiException( "shared memory too small", "GaudiMP::SharedMemoryRing", StatusCode::FAILURE );
+  }
+  map( st.st_size );
+  if ( std::memcmp( m_layout->magic, s_magic, sizeof( s_magic ) ) != 0 || m_layout->totalSize != m_size ) {
+    throw GaudiException( "invalid shared memory ring", "GaudiMP::SharedMemoryRing", StatusCode::FAILURE );
+  }
+}
+
+GaudiMP::SharedMemoryRing::~SharedMemoryRing() {
+  if ( m_base ) ::munmap( m_base, m_size );
+  if ( m_fd >= 0 ) ::close( m_fd );
+}
+
+void GaudiMP::SharedMemoryRing::map( std::size_t size ) {
+  void* mem = ::mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0 );
+  if ( mem == MAP_FAILED ) fail( "cannot map shared memory" );
+  m_base   = static_cast<char*>( mem );
+  m_size   = size;
+  m_layout = reinterpret_cast<Layout*>( m_base );
+}
+
+std::size_t GaudiMP::SharedMemoryRing::slots() const { return m_layout->nSlots; }
+
+std::size_t GaudiMP::SharedMemoryRing::slotSize() const { return m_layout->slotSize; }
+
+std::size_t GaudiMP::SharedMemoryRing::acquire() {
+  Queue         freeSlots{ *m_layout, false };
+  std::uint64_t slot;
+  Backoff       wait;
+  while ( !freeSlots.pop( slot ) ) wait();
+  return slot;
+}
+
+char* GaudiMP::SharedMemoryRing::data( std::size_t slot ) const { return m_layout->slot( slot ); }
+
+void GaudiMP::SharedMemoryRing::publish( std::size_t slot, std::size_t length ) {
+  m_layout->lengths()[slot] = length;
+  // cannot fail: there are never more slots than the capacity of the queue
+  Queue{ *m_layout, true }.push( slot );
+}
+
+void GaudiMP::SharedMemoryRing::close() { m_layout->producers.fetch_sub( 1, std::memory_order_acq_rel ); }
+
+std::size_t GaudiMP::SharedMemoryRing::consume() {
+  Queue         readySlots{ *m_layout, true };
+  std::uint64_t slot;
+  Backoff       wait;
+  while ( !readySlots.pop( slot ) ) {
+    if ( m_layout->producers.load( std::memory_order_acquire ) <= 0 ) {
+      // all producers are done: check once more for what they published before closing
+      return readySlots.pop( slot ) ? slot : npos;
+    }
+    wait();
+  }
+  return slot;
+}
+
+std::string_view GaudiMP::SharedMemoryRing::view( std::size_t slot ) const {
+  return { m_layout->slot( slot ), m_layout->lengths()[slot] };
+}
+
+void GaudiMP::SharedMemoryRing::release( std::size_t slot ) { Queue{ *m_layout, false }.push( slot ); }
+
+bool GaudiMP::SharedMemoryRing::send( const TBufferFile& buffer ) {
+  const std::size_t length = buffer.Length();
+  if ( length > slotSize() ) return false;
+  const auto slot = acquire();
+  std::memcpy( data( slot ), buffer.Buffer(), length );
+  publish( slot, length );
+  return true;
+}
+
+bool GaudiMP::SharedMemoryRing::send( const std::function<void( TBufferFile& )>& fill ) {
+  const auto  slot   = acquire();
+  char*       begin  = data( slot );
+  std::size_t length = 0;
+  {
+    s_fillingSlot = begin;
+    TBufferFile buffer( TBuffer::kWrite, static_cast<Int_t>( slotSize() ), begin, kFALSE, growOutOfSlot );
+    try {
+      fill( buffer );
+    } catch ( ... ) {
+      s_fillingSlot = nullptr;
+      if ( buffer.Buffer() != begin ) delete[] buffer.Buffer();
+      release( slot );
+      throw;
+    }
+    s_fillingSlot = nullptr;
+    if ( buffer.Buffer() != begin ) {
+      // the content did not fit in the slot: drop the heap copy and give the slot back
+      delete[] buffer.Buffer();
+      release( slot );
+      return false;
+    }
+    length = buffer.Length();
+  }
+  publish( slot, length );
+  return true;
+}
+
+TBufferFile GaudiMP::SharedMemoryRing::bufferFor( std::size_t slot ) const {
+  // the buffer does not own the memory, so nothing is copied nor freed
+  return TBufferFile( TBuffer::kRead, m_layout->lengths()[slot], m_layout->slot( slot ), kFALSE );
+}
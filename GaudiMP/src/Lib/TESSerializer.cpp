@@ -28,12 +28,17 @@
 #include <GaudiKernel/MsgStream.h>
 
 // ROOT include files
+#include <Compression.h>
+#include <RZip.h>
 #include <TBufferFile.h>
 #include <TClass.h>
 #include <TInterpreter.h>
 #include <TROOT.h>
 
+#include <algorithm>
 #include <map>
+#include <utility>
+#include <vector>
 
 // a constant to guard against seg-faults in loadBuffer
 #define SERIALIZER_END "EOF"
@@ -43,6 +48,83 @@ namespace {
     DataObjectPush( DataObject*& p ) { Gaudi::pushCurrentDataObject( &p ); }
     ~DataObjectPush() { Gaudi::popCurrentDataObject(); }
   };
+
+  // maximum size of a block for R__zip
+  constexpr int s_maxZipBlock = 0xffffff;
+  // size of the header R__zip adds to each block
+  constexpr int s_zipHeader = 9;
+
+  /// Write the content of `in` to `out` as: original size, stored size, stored bytes.
+  /// The stored bytes are compressed (in blocks) with LZ4, unless compression does not help, in which case the
+  /// stored size is equal to the original size.
+  void writeCompressed( TBufferFile& out, const TBufferFile& in, int level, std::vector<char>& scratch ) {
+    const int srcSize = in.Length();
+    scratch.resize( srcSize + ( srcSize / s_maxZipBlock + 1 ) * s_zipHeader );
+    int zipSize = 0;
+    for ( int done = 0; done < srcSize; ) {
+      int blockSize = std::min( srcSize - done, s_maxZipBlock );
+      int tgtSize   = std::min<int>( scratch.size() - zipSize, blockSize + s_zipHeader );
+      int written   = 0;
+      R__zipMultipleAlgorithm( level, &blockSize, in.Buffer() + done, &tgtSize, scratch.data() + zipSize, &written,
+                               ROOT::RCompressionSetting::EAlgorithm::kLZ4 );
+      if ( written == 0 || zipSize + written >= srcSize ) { // not compressible
+        zipSize = srcSize;
+        break;
+      }
+      zipSize += written;
+      done += blockSize;
+    }
+    out.WriteInt( srcSize );
+    out.WriteInt( zipSize );
+    out.WriteFastArray( zipSize == srcSize ? in.Buffer() : scratch.data(), zipSize );
+  }
+
+  /// Read the data written by writeCompressed, returning a pointer to the uncompressed bytes (either in `in`
+  /// or in `scratch`) and their size.
+  /// The sizes found in the buffer are checked against its actual size (and against the headers of the
+  /// compressed blocks) before being used, so that a corrupted message results in an exception.
+  std::pair<char*, int> readCompressed( TBufferFile& in, std::vector<char>& scratch ) {
+    auto corrupted = []() {
+      return GaudiException( "corrupted compressed object", "GaudiMP::TESSerializer", StatusCode::FAILURE );
+    };
+    int srcSize = 0, zipSize = 0;
+    in.ReadInt( srcSize );
+    in.ReadInt( zipSize );
+    if ( srcSize < 0 || zipSize < 0 || zipSize > srcSize || zipSize > in.BufferSize() - in.Length() ) {
+      throw corrupted();
+    }
+    char* zipped = in.Buffer() + in.Length();
+    in.SetBufferOffset( in.Length() + zipSize );
+    if ( zipSize == srcSize ) return { zipped, srcSize };
+
+    // check that the blocks fit in the buffer and add up to the declared size before allocating the output
+    long long expected = 0;
+    for ( int done = 0, nin = 0, nout = 0; done < zipSize; done += nin ) {
+      if ( zipSize - done < s_zipHeader ||
+           R__unzip_header( &nin, reinterpret_cast<unsigned char*>( zipped + done ), &nout ) != 0 || nin <= 0 ||
+           nin > zipSize - done || nout < 0 || ( expected += nout ) > srcSize ) {
+        throw corrupted();
+      }
+    }
+    if ( expected != srcSize ) throw corrupted();
+
+    scratch.resize( srcSize );
+    int produced = 0;
+    for ( int done = 0; done < zipSize; ) {
+      auto* src     = reinterpret_cast<unsigned char*>( zipped + done );
+      int   nin     = 0;
+      int   nout    = 0;
+      int   written = 0;
+      R__unzip_header( &nin, src, &nout );
+      R__unzip( &nin, src, &nout, reinterpret_cast<unsigned char*>( scratch.data() + produced ), &written );
+      if ( written != nout ) {
+        throw GaudiException( "failed to uncompress object", "GaudiMP::TESSerializer", StatusCode::FAILURE );
+      }
+      done += nin;
+      produced += written;
+    }
+    return { scratch.data(), srcSize };
+  }
 } // namespace
 
 using namespace std;
@@ -121,7 +203,9 @@ void GaudiMP::TESSerializer::dumpBuffer( TBufferFile& buffer ) {
   } );
 
   // cout << "TESSerializer : Beginning loop to write to TBufferFile for nObjects : " << m_objects.size() << endl;
-  buffer.WriteInt( objects.size() );
+  // a negative count signals that the objects are compressed
+  const bool compress = m_compressionLevel > 0;
+  buffer.WriteInt( compress ? -static_cast<int>( objects.size() ) : static_cast<int>( objects.size() ) );
 
   for ( auto& [pObj, cl] : objects ) {
     DataObjectPush p( pObj ); /* add the data object to the list... */
@@ -130,7 +214,13 @@ void GaudiMP::TESSerializer::dumpBuffer( TBufferFile& buffer ) {
     std::string loc = pObj->registry()->identifier();
     buffer.WriteString( loc.c_str() );
     buffer.WriteString( cl->GetName() );
-    cl->Streamer( pObj, buffer );
+    if ( compress ) {
+      TBufferFile objBuffer( TBuffer::kWrite );
+      cl->Streamer( pObj, objBuffer );
+      writeCompressed( buffer, objBuffer, m_compressionLevel, m_zipBuffer );
+    } else {
+      cl->Streamer( pObj, buffer );
+    }
 
     /* take care of links */
     LinkManager* linkMgr  = pObj->linkMgr();
@@ -172,7 +262,8 @@ void GaudiMP::TESSerializer::loadBuffer( TBufferFile& buffer ) {
   // buffer is: length of DataObjects vector
   //            location string
   //            type name string
-  //            the object itself
+  //            the object itself (or, if the length is negative, the object
+  //            size, compressed size and compressed object)
   //            count of links
   //            list of links (conditional on count)
   //            flag indicating Opaque Address presence
@@ -190,6 +281,8 @@ void GaudiMP::TESSerializer::loadBuffer( TBufferFile& buffer ) {
   buffer.SetBufferOffset();
 
   buffer.ReadInt( nObjects );
+  const bool compressed = nObjects < 0;
+  if ( compressed ) nObjects = -nObjects;
   for ( int i = 0; i < nObjects; ++i ) {
     char text[4096];
     buffer.ReadString( text, sizeof( text ) );
@@ -213,7 +306,13 @@ void GaudiMP::TESSerializer::loadBuffer( TBufferFile& buffer ) {
     /// The next is equivalent to ReadObjectAny(cl) except of the 'magic!!'
     DataObject*    obj = (DataObject*)cl->New();
     DataObjectPush push( obj ); // This is magic!
-    cl->Streamer( obj, buffer );
+    if ( compressed ) {
+      auto [data, size] = readCompressed( buffer, m_zipBuffer );
+      TBufferFile objBuffer( TBuffer::kRead, size, data, kFALSE );
+      cl->Streamer( obj, objBuffer );
+    } else {
+      cl->Streamer( obj, buffer );
+    }
 
     // now restore links
     if ( obj ) {
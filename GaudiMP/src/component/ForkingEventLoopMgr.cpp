@@ -0,0 +1,328 @@
+/***********************************************************************************\
+* (c) Copyright 1998-2026 CERN for the benefit of the LHCb and ATLAS collaborations *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include "ForkingEventLoopMgr.h"
+#include <GaudiKernel/AppReturnCode.h>
+#include <GaudiKernel/DataObject.h>
+#include <GaudiKernel/Incident.h>
+#include <GaudiKernel/MsgStream.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+DECLARE_COMPONENT( ForkingEventLoopMgr )
+
+#define ON_DEBUG if ( outputLevel() <= MSG::DEBUG )
+
+#define DEBMSG ON_DEBUG debug()
+
+struct ForkingEventLoopMgr::SharedQueue {
+  // must be lock-free to work across processes
+  static_assert( std::atomic<std::int64_t>::is_always_lock_free );
+  /// next event number to be taken by a worker
+  std::atomic<std::int64_t> next{ 0 };
+  /// set by the first worker that reaches the end of the input
+  std::atomic<std::int64_t> end{ -1 };
+  /// number of events processed by all the workers
+  std::atomic<std::int64_t> processed{ 0 };
+};
+
+namespace {
+  /// Quote a string for the shell (within single quotes, where only the single quote needs escaping).
+  std::string shellQuote( const std::string& s ) {
+    std::string out{ "'" };
+    for ( char c : s ) {
+      if ( c == '\'' )
+        out += "'\\''";
+      else
+        out += c;
+    }
+    return out += '\'';
+  }
+} // namespace
+
+ForkingEventLoopMgr::~ForkingEventLoopMgr() { delete m_evtContext; }
+
+StatusCode ForkingEventLoopMgr::initialize() {
+  StatusCode sc = MinimalEventLoopMgr::initialize();
+  if ( !sc ) return sc;
+
+  m_evtDataMgrSvc = serviceLocator()->service( "EventDataSvc" );
+  m_evtDataSvc    = m_evtDataMgrSvc;
+  if ( !m_evtDataMgrSvc || !m_evtDataSvc ) {
+    fatal() << "Error retrieving EventDataSvc" << endmsg;
+    return StatusCode::FAILURE;
+  }
+
+  m_appMgrProperty = serviceLocator();
+  setProperty( m_appMgrProperty->getProperty( "EvtSel" ) ).ignore();
+  if ( m_evtsel != "NONE" || m_evtsel.empty() ) {
+    m_evtSelector = serviceLocator()->service( "EventSelector" );
+    if ( !m_evtSelector ) {
+      fatal() << "EventSelector not found." << endmsg;
+      return StatusCode::FAILURE;
+    }
+  } else {
+    info() << "No events will be processed from external input." << endmsg;
+  }
+
+  if ( m_nWorkers < 0 || m_chunkSize < 1 ) {
+    error() << "invalid configuration: NumWorkers=" << m_nWorkers.value() << ", ChunkSize=" << m_chunkSize.value()
+            << endmsg;
+    return StatusCode::FAILURE;
+  }
+  if ( m_nWorkers > 0 ) {
+    m_ioMgr = serviceLocator()->service( "IoComponentMgr" );
+    if ( !m_ioMgr ) warning() << "IoComponentMgr not available: outputs of the workers will not be separated" << endmsg;
+
+    void* mem = ::mmap( nullptr, sizeof( SharedQueue ), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0 );
+    if ( mem == MAP_FAILED ) {
+      error() << "cannot allocate shared memory: " << std::strerror( errno ) << endmsg;
+      return StatusCode::FAILURE;
+    }
+    m_queue = new ( mem ) SharedQueue{};
+  } else {
+    sc = openInput();
+  }
+  return sc;
+}
+
+StatusCode ForkingEventLoopMgr::stop() {
+  if ( !m_endEventFired ) {
+    m_incidentSvc->fireIncident( Incident( name(), IncidentType::EndEvent ) );
+    m_endEventFired = true;
+  }
+  return m_evtDataMgrSvc->clearStore().andThen( [this]() { return MinimalEventLoopMgr::stop(); } );
+}
+
+StatusCode ForkingEventLoopMgr::finalize() {
+  if ( m_evtSelector && m_evtContext ) {
+    m_evtSelector->releaseContext( m_evtContext ).ignore();
+    m_evtContext = nullptr;
+  }
+  if ( m_queue ) {
+    m_queue->~SharedQueue();
+    ::munmap( m_queue, sizeof( SharedQueue ) );
+    m_queue = nullptr;
+  }
+  m_evtSelector    = nullptr;
+  m_evtDataSvc     = nullptr;
+  m_evtDataMgrSvc  = nullptr;
+  m_ioMgr          = nullptr;
+  m_appMgrProperty = nullptr;
+  return MinimalEventLoopMgr::finalize();
+}
+
+StatusCode ForkingEventLoopMgr::executeEvent( EventContext&& ctx ) {
+  m_incidentSvc->fireIncident( Incident( name(), IncidentType::BeginEvent ) );
+  if ( m_scheduledStop ) {
+    always() << "Terminating event processing loop due to a stop scheduled by an incident listener" << endmsg;
+    return StatusCode::SUCCESS;
+  }
+  m_incidentSvc->fireIncident( Incident( name(), IncidentType::BeginProcessing ) );
+  StatusCode sc = MinimalEventLoopMgr::executeEvent( std::move( ctx ) );
+  m_incidentSvc->fireIncident( Incident( name(), IncidentType::EndProcessing ) );
+  if ( !sc ) error() << "Terminating event processing loop due to errors" << endmsg;
+  return sc;
+}
+
+StatusCode ForkingEventLoopMgr::nextEvent( int maxevt ) {
+  // maxevt counts the events from where the previous call stopped
+  if ( m_workerId < 0 ) m_firstEvent = m_queue ? m_queue->next.load() : m_evtPosition;
+  if ( !m_queue || m_workerId >= 0 ) return processEvents( maxevt );
+
+  if ( forkWorkers() ) {
+    // in a worker process
+    if ( m_ioMgr ) {
+      if ( auto sc = redirectOutputs( workerDirectory( m_workerId ) ); !sc ) return sc;
+    }
+    return openInput().andThen( [&]() { return processEvents( maxevt ); } );
+  }
+  if ( m_workers.empty() ) {
+    warning() << "no worker could be started, processing events in the main process" << endmsg;
+    return openInput().andThen( [&]() { return processEvents( maxevt ); } );
+  }
+  return collectWorkers();
+}
+
+bool ForkingEventLoopMgr::forkWorkers() {
+  info() << "forking " << m_nWorkers.value() << " workers" << endmsg;
+  // avoid that buffered output is written once per process
+  std::cout.flush();
+  std::fflush( nullptr );
+  for ( int id = 0; id < m_nWorkers; ++id ) {
+    const pid_t pid = ::fork();
+    if ( pid == 0 ) {
+      m_workerId = id;
+      m_workers.clear();
+      return true;
+    }
+    if ( pid < 0 ) {
+      error() << "cannot fork worker " << id << ": " << std::strerror( errno ) << endmsg;
+      break;
+    }
+    DEBMSG << "started worker " << id << " (pid " << pid << ")" << endmsg;
+    m_workers.push_back( pid );
+  }
+  return false;
+}
+
+StatusCode ForkingEventLoopMgr::collectWorkers() {
+  // keep the (unused) outputs of the parent out of the way of the merged files
+  if ( m_ioMgr ) redirectOutputs( workerDirectory( -1 ) ).ignore();
+
+  bool allgood = true;
+  for ( std::size_t id = 0; id < m_workers.size(); ++id ) {
+    int status = 0;
+    while ( ::waitpid( m_workers[id], &status, 0 ) < 0 && errno == EINTR ) {}
+    if ( WIFEXITED( status ) && WEXITSTATUS( status ) == 0 ) {
+      DEBMSG << "worker " << id << " completed" << endmsg;
+    } else {
+      allgood = false;
+      error() << "worker " << id << " (pid " << m_workers[id] << ") failed with status " << status << endmsg;
+    }
+  }
+  info() << "all workers completed, " << m_queue->processed.exchange( 0 ) << " events processed" << endmsg;
+
+  if ( !m_mergeCommand.empty() ) {
+    namespace fs = std::filesystem;
+    const fs::path  first{ workerDirectory( 0 ) };
+    std::error_code ec;
+    for ( const auto& entry : fs::directory_iterator( first, ec ) ) {
+      if ( !entry.is_regular_file() ) continue;
+      const auto  fname = entry.path().filename();
+      std::string cmd   = m_mergeCommand.value() + ' ' + shellQuote( fname.string() );
+      for ( std::size_t id = 0; id < m_workers.size(); ++id ) {
+        const auto input = fs::path{ workerDirectory( id ) } / fname;
+        if ( fs::exists( input ) ) cmd += ' ' + shellQuote( input.string() );
+      }
+      info() << "merging outputs of the workers into " << fname << endmsg;
+      DEBMSG << "running: " << cmd << endmsg;
+      if ( std::system( cmd.c_str() ) != 0 ) {
+        allgood = false;
+        error() << "failed to merge " << fname << endmsg;
+      }
+    }
+  }
+  if ( !allgood ) Gaudi::setAppReturnCode( m_appMgrProperty, Gaudi::ReturnCode::UnhandledException ).ignore();
+  return allgood ? StatusCode::SUCCESS : StatusCode::FAILURE;
+}
+
+StatusCode ForkingEventLoopMgr::redirectOutputs( const std::string& dir ) {
+  std::error_code ec;
+  std::filesystem::create_directories( dir, ec );
+  if ( ec ) {
+    error() << "cannot create directory " << dir << ": " << ec.message() << endmsg;
+    return StatusCode::FAILURE;
+  }
+  DEBMSG << "moving outputs to " << dir << endmsg;
+  return m_ioMgr->io_update_all( dir ).andThen( [this]() { return m_ioMgr->io_reinitialize(); } );
+}
+
+std::string ForkingEventLoopMgr::workerDirectory( int id ) const {
+  std::string dir = m_workerDir;
+  if ( auto pos = dir.find( "{}" ); pos != std::string::npos ) {
+    dir.replace( pos, 2, id < 0 ? std::string{ "parent" } : std::to_string( id ) );
+  }
+  return dir;
+}
+
+StatusCode ForkingEventLoopMgr::openInput() {
+  if ( !m_evtSelector || m_evtContext ) return StatusCode::SUCCESS;
+  DEBMSG << "opening the input" << endmsg;
+  StatusCode sc = m_evtSelector->createContext( m_evtContext );
+  if ( !sc ) fatal() << "Can not create the event selector Context." << endmsg;
+  return sc;
+}
+
+StatusCode ForkingEventLoopMgr::loadEvent( long long evt ) {
+  if ( !m_evtSelector ) {
+    m_evtPosition = evt + 1;
+    return m_evtDataMgrSvc->setRoot( "/Event", new DataObject() );
+  }
+
+  // move to the requested event, skipping those processed by other workers
+  StatusCode sc = m_evtSelector->next( *m_evtContext, static_cast<int>( evt - m_evtPosition + 1 ) );
+  if ( !sc ) return sc;
+  m_evtPosition = evt + 1;
+
+  IOpaqueAddress* addr = nullptr;
+  if ( sc = m_evtSelector->createAddress( *m_evtContext, addr ); !sc ) {
+    warning() << "Error creating IOpaqueAddress." << endmsg;
+    return sc;
+  }
+  if ( sc = m_evtDataMgrSvc->setRoot( "/Event", addr ); !sc ) {
+    warning() << "Error declaring event root address." << endmsg;
+    return sc;
+  }
+  DataObject* pObject = nullptr;
+  if ( sc = m_evtDataSvc->retrieveObject( "/Event", pObject ); !sc ) {
+    warning() << "Unable to retrieve Event root object" << endmsg;
+  }
+  return sc;
+}
+
+StatusCode ForkingEventLoopMgr::processEvents( int maxevt ) {
+  const long long chunk      = m_queue ? m_chunkSize.value() : std::numeric_limits<int>::max();
+  long long       nProcessed = 0;
+
+  while ( true ) {
+    // take the next range of events
+    const long long first = m_queue ? m_queue->next.fetch_add( chunk ) : m_evtPosition;
+    long long       last  = first + chunk;
+    if ( maxevt >= 0 ) last = std::min<long long>( last, m_firstEvent + maxevt );
+    if ( const auto end = m_queue ? m_queue->end.load() : -1; end >= 0 ) last = std::min<long long>( last, end );
+    if ( first >= last ) break;
+
+    for ( long long evt = first; evt < last; ++evt ) {
+      if ( m_scheduledStop ) {
+        m_scheduledStop = false;
+        always() << "Terminating event processing loop due to scheduled stop" << endmsg;
+        return StatusCode::SUCCESS;
+      }
+      if ( !m_endEventFired ) {
+        m_incidentSvc->fireIncident( Incident( name(), IncidentType::EndEvent ) );
+        m_endEventFired = true;
+        if ( !m_evtDataMgrSvc->clearStore() ) DEBMSG << "Clear of Event data store failed" << endmsg;
+      }
+      if ( !loadEvent( evt ) ) {
+        info() << "No more events in event selection " << endmsg;
+        if ( m_queue ) {
+          std::int64_t expected = -1;
+          m_queue->end.compare_exchange_strong( expected, evt );
+        }
+        return StatusCode::SUCCESS;
+      }
+      auto ctx = createEventContext();
+      ctx.set( evt, 0 );
+      StatusCode sc   = executeEvent( std::move( ctx ) );
+      m_endEventFired = false;
+      if ( !sc ) {
+        Gaudi::setAppReturnCode( m_appMgrProperty, Gaudi::ReturnCode::AlgorithmFailure ).ignore();
+        return sc;
+      }
+      ++nProcessed;
+      if ( m_queue ) ++m_queue->processed;
+    }
+  }
+  if ( m_workerId >= 0 ) info() << "worker " << m_workerId << " processed " << nProcessed << " events" << endmsg;
+  return StatusCode::SUCCESS;
+}
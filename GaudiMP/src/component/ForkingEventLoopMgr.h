@@ -0,0 +1,104 @@
+/***********************************************************************************\
+* (c) Copyright 1998-2026 CERN for the benefit of the LHCb and ATLAS collaborations *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <GaudiKernel/IDataManagerSvc.h>
+#include <GaudiKernel/IDataProviderSvc.h>
+#include <GaudiKernel/IEvtSelector.h>
+#include <GaudiKernel/IIoComponentMgr.h>
+#include <GaudiKernel/MinimalEventLoopMgr.h>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+/** @class ForkingEventLoopMgr
+ *
+ *  Event loop manager that forks a configurable number of worker processes after the application has been
+ *  initialized and started, so that everything loaded so far (conditions, geometry, configuration, shared
+ *  libraries) is shared between the workers through copy-on-write pages.
+ *
+ *  Workers take chunks of consecutive event numbers from a counter in a shared memory page and skip the events
+ *  taken by the other workers via IEvtSelector::next(ctxt, jump), so no event data travels between processes.
+ *
+ *  The input is opened (i.e. the EventSelector context is created) by each worker after the fork, so that the
+ *  workers do not share file descriptors and file offsets: the services used before the event loop must not
+ *  open the input files themselves.
+ *
+ *  Before processing, each worker moves its output files into a dedicated directory (see `WorkerDirectory`)
+ *  through IIoComponentMgr::io_update_all and IIoComponentMgr::io_reinitialize.  When all the workers are done,
+ *  the parent process merges the files found in the worker directories with `MergeCommand`.
+ *
+ *  @warning fork(2) only duplicates the calling thread, so the services used before the event loop must not
+ *           rely on background threads (e.g. do not combine with ThreadPoolSvc or InertMessageSvc).
+ *
+ *  With `NumWorkers` set to 0 the events are processed in the current process, as with EventLoopMgr.
+ */
+class ForkingEventLoopMgr : public MinimalEventLoopMgr {
+public:
+  using MinimalEventLoopMgr::MinimalEventLoopMgr;
+
+  ~ForkingEventLoopMgr() override;
+
+  StatusCode initialize() override;
+  StatusCode stop() override;
+  StatusCode finalize() override;
+  StatusCode nextEvent( int maxevt ) override;
+  StatusCode executeEvent( EventContext&& ctx ) override;
+
+private:
+  /// Counter of the next event to be processed, shared between the parent and the workers.
+  struct SharedQueue;
+
+  /// Process events taking them from the shared queue (or all of them if there is no queue).
+  StatusCode processEvents( int maxevt );
+  /// Create the EventSelector context, if there is an input and it was not created yet.
+  StatusCode openInput();
+  /// Load the event with the given (0-based) position in the input, skipping what is in between.
+  StatusCode loadEvent( long long evt );
+  /// Fork the workers, returning true in the workers and false in the parent.
+  bool forkWorkers();
+  /// Wait for the workers to complete and merge their outputs.
+  StatusCode collectWorkers();
+  /// Move the output files of the current process to the given directory.
+  StatusCode redirectOutputs( const std::string& dir );
+  /// Name of the directory used for the outputs of a worker (or the parent, if `id` is negative).
+  std::string workerDirectory( int id ) const;
+
+  Gaudi::Property<int> m_nWorkers{ this, "NumWorkers", 0, "number of worker processes (0 means no fork)" };
+  Gaudi::Property<int> m_chunkSize{ this, "ChunkSize", 1,
+                                    "number of consecutive events taken by a worker from the shared queue" };
+  Gaudi::Property<std::string> m_workerDir{
+      this, "WorkerDirectory", "worker_{}",
+      "pattern for the output directory of each worker ('{}' is replaced by the worker id or by 'parent')" };
+  Gaudi::Property<std::string> m_mergeCommand{
+      this, "MergeCommand", "hadd -f",
+      "command used to merge the outputs of the workers, invoked as '<cmd> <output> <inputs...>' (empty to "
+      "disable merging)" };
+  Gaudi::Property<std::string> m_evtsel{ this, "EvtSel", {}, "event selector" };
+
+  SmartIF<IDataManagerSvc>  m_evtDataMgrSvc;
+  SmartIF<IDataProviderSvc> m_evtDataSvc;
+  SmartIF<IEvtSelector>     m_evtSelector;
+  SmartIF<IIoComponentMgr>  m_ioMgr;
+  SmartIF<IProperty>        m_appMgrProperty;
+  IEvtSelector::Context*    m_evtContext = nullptr;
+
+  /// Number of events consumed from the event selector in this process.
+  long long m_evtPosition = 0;
+  /// Position of the first event of the current call to nextEvent (in the input, or in the shared queue).
+  long long m_firstEvent = 0;
+  /// Flag to avoid to fire the EndEvent incident twice in a row
+  bool m_endEventFired = true;
+
+  SharedQueue*       m_queue    = nullptr;
+  int                m_workerId = -1;
+  std::vector<pid_t> m_workers;
+};
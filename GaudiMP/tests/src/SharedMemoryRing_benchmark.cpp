@@ -0,0 +1,213 @@
+/***********************************************************************************\
+* (c) Copyright 1998-2026 CERN for the benefit of the LHCb and ATLAS collaborations *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+// Compare the throughput of GaudiMP::SharedMemoryRing with the one of a pipe, passing buffers of a given size
+// from a producer process to a consumer process.  With a compression level greater than 0 the buffers are
+// compressed with LZ4 by the producer (directly into the ring slots) and uncompressed by the consumer, as
+// GaudiMP::TESSerializer does.
+//
+// usage: GaudiMP_SharedMemoryRing_benchmark [n_buffers [buffer_size [n_slots [compression_level]]]]
+#include <GaudiMP/SharedMemoryRing.h>
+
+#include <Compression.h>
+#include <RZip.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+
+  // limits of the ROOT compression routines
+  constexpr std::size_t s_maxZipBlock = 0xffffff;
+  constexpr std::size_t s_zipHeader   = 9;
+
+  /// Cheap check that the consumer actually looks at the data.
+  unsigned long checksum( const char* data, std::size_t size ) {
+    return std::accumulate( data, data + size, 0ul, []( unsigned long s, char c ) { return s + c; } );
+  }
+
+  /// Space needed to hold `size` bytes once compressed (in the worst case).
+  std::size_t compressedCapacity( std::size_t size ) { return size + ( size / s_maxZipBlock + 1 ) * s_zipHeader; }
+
+  /// Compress `size` bytes from `src` to `dst`, returning the number of bytes written (0 on failure).
+  std::size_t compress( int level, const char* src, std::size_t size, char* dst, std::size_t capacity ) {
+    std::size_t zipSize = 0;
+    for ( std::size_t done = 0; done < size; ) {
+      int blockSize = std::min( size - done, s_maxZipBlock );
+      int tgtSize   = std::min( capacity - zipSize, blockSize + s_zipHeader );
+      int written   = 0;
+      R__zipMultipleAlgorithm( level, &blockSize, const_cast<char*>( src + done ), &tgtSize, dst + zipSize, &written,
+                               ROOT::RCompressionSetting::EAlgorithm::kLZ4 );
+      if ( written == 0 ) return 0;
+      zipSize += written;
+      done += blockSize;
+    }
+    return zipSize;
+  }
+
+  /// Uncompress the output of compress() into `dst`, returning the number of bytes produced (0 on failure).
+  std::size_t uncompress( const char* src, std::size_t size, char* dst, std::size_t capacity ) {
+    std::size_t produced = 0;
+    for ( std::size_t done = 0; done < size; ) {
+      auto* block   = reinterpret_cast<unsigned char*>( const_cast<char*>( src + done ) );
+      int   nin     = 0;
+      int   nout    = 0;
+      int   written = 0;
+      if ( R__unzip_header( &nin, block, &nout ) != 0 || produced + nout > capacity ) return 0;
+      R__unzip( &nin, block, &nout, reinterpret_cast<unsigned char*>( dst + produced ), &written );
+      if ( written != nout ) return 0;
+      done += nin;
+      produced += written;
+    }
+    return produced;
+  }
+
+  /// Consumer side of a transfer: uncompress the data if needed and accumulate its checksum.
+  class Receiver {
+    int               m_level;
+    std::vector<char> m_scratch;
+    unsigned long     m_sum = 0;
+    std::size_t       m_got = 0;
+
+  public:
+    Receiver( int level, std::size_t size ) : m_level( level ), m_scratch( level > 0 ? size : 0 ) {}
+    void operator()( const char* data, std::size_t size ) {
+      if ( m_level > 0 ) {
+        size = uncompress( data, size, m_scratch.data(), m_scratch.size() );
+        data = m_scratch.data();
+      }
+      m_sum += checksum( data, size );
+      ++m_got;
+    }
+    bool check( const std::vector<char>& payload, std::size_t n ) const {
+      return m_got == n && m_sum == n * checksum( payload.data(), payload.size() );
+    }
+  };
+
+  void report( const std::string& name, Clock::duration elapsed, std::size_t n, std::size_t size ) {
+    const double seconds = std::chrono::duration<double>( elapsed ).count();
+    std::cout << name << ": " << n << " buffers of " << size << " bytes in " << seconds << " s ("
+              << n / seconds << " buffers/s, " << n * size / seconds / ( 1 << 20 ) << " MiB/s)" << std::endl;
+  }
+
+  int waitChild( pid_t pid ) {
+    int status = 0;
+    ::waitpid( pid, &status, 0 );
+    return WIFEXITED( status ) ? WEXITSTATUS( status ) : 1;
+  }
+
+  int runRing( const std::vector<char>& payload, std::size_t n, std::size_t nSlots, int level ) {
+    const std::size_t         slotSize = level > 0 ? compressedCapacity( payload.size() ) : payload.size();
+    GaudiMP::SharedMemoryRing ring( nSlots, slotSize );
+    const auto                start = Clock::now();
+    if ( const pid_t pid = ::fork(); pid == 0 ) {
+      Receiver receive( level, payload.size() );
+      for ( auto slot = ring.consume(); slot != ring.npos; slot = ring.consume() ) {
+        const auto data = ring.view( slot );
+        receive( data.data(), data.size() );
+        ring.release( slot );
+      }
+      std::_Exit( receive.check( payload, n ) ? 0 : 1 );
+    } else {
+      for ( std::size_t i = 0; i < n; ++i ) {
+        const auto  slot   = ring.acquire();
+        std::size_t length = payload.size();
+        if ( level > 0 ) {
+          length = compress( level, payload.data(), payload.size(), ring.data( slot ), slotSize );
+        } else {
+          std::memcpy( ring.data( slot ), payload.data(), length );
+        }
+        ring.publish( slot, length );
+      }
+      ring.close();
+      const int rc = waitChild( pid );
+      report( "shared memory ring", Clock::now() - start, n, payload.size() );
+      return rc;
+    }
+  }
+
+  bool readAll( int fd, char* data, std::size_t size ) {
+    for ( std::size_t done = 0; done < size; ) {
+      const auto r = ::read( fd, data + done, size - done );
+      if ( r <= 0 ) return false;
+      done += r;
+    }
+    return true;
+  }
+
+  bool writeAll( int fd, const char* data, std::size_t size ) {
+    for ( std::size_t done = 0; done < size; ) {
+      const auto w = ::write( fd, data + done, size - done );
+      if ( w <= 0 ) return false;
+      done += w;
+    }
+    return true;
+  }
+
+  int runPipe( const std::vector<char>& payload, std::size_t n, int level ) {
+    int fds[2];
+    if ( ::pipe( fds ) != 0 ) return 1;
+    // each buffer is preceded by its size, as the compressed ones may differ
+    std::vector<char> buffer( level > 0 ? compressedCapacity( payload.size() ) : payload.size() );
+    const auto        start = Clock::now();
+    if ( const pid_t pid = ::fork(); pid == 0 ) {
+      ::close( fds[1] );
+      Receiver    receive( level, payload.size() );
+      std::size_t length = 0;
+      while ( readAll( fds[0], reinterpret_cast<char*>( &length ), sizeof( length ) ) && length <= buffer.size() &&
+              readAll( fds[0], buffer.data(), length ) ) {
+        receive( buffer.data(), length );
+      }
+      std::_Exit( receive.check( payload, n ) ? 0 : 1 );
+    } else {
+      ::close( fds[0] );
+      for ( std::size_t i = 0; i < n; ++i ) {
+        const char* data   = payload.data();
+        std::size_t length = payload.size();
+        if ( level > 0 ) {
+          length = compress( level, payload.data(), payload.size(), buffer.data(), buffer.size() );
+          data   = buffer.data();
+        }
+        if ( !writeAll( fds[1], reinterpret_cast<const char*>( &length ), sizeof( length ) ) ||
+             !writeAll( fds[1], data, length ) ) {
+          break;
+        }
+      }
+      ::close( fds[1] );
+      const int rc = waitChild( pid );
+      report( "pipe", Clock::now() - start, n, payload.size() );
+      return rc;
+    }
+  }
+} // namespace
+
+int main( int argc, char* argv[] ) {
+  const std::size_t n      = argc > 1 ? std::atol( argv[1] ) : 10000;
+  const std::size_t size   = argc > 2 ? std::atol( argv[2] ) : 1 << 20;
+  const std::size_t nSlots = argc > 3 ? std::atol( argv[3] ) : 8;
+  const int         level  = argc > 4 ? std::atoi( argv[4] ) : 0;
+
+  std::vector<char> payload( size );
+  for ( std::size_t i = 0; i < size; ++i ) payload[i] = static_cast<char>( i * 31 );
+
+  int rc = runPipe( payload, n, level );
+  rc |= runRing( payload, n, nSlots, level );
+  if ( rc ) std::cerr << "ERROR: data corrupted in transfer" << std::endl;
+  return rc;
+}
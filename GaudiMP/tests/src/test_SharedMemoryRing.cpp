@@ -0,0 +1,114 @@
+/***********************************************************************************\
+* (c) Copyright 1998-2026 CERN for the benefit of the LHCb and ATLAS collaborations *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE test_SharedMemoryRing
+#include <GaudiMP/SharedMemoryRing.h>
+
+#include <TBufferFile.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+  void writeMessage( TBufferFile& buffer, int id, std::size_t padding = 0 ) {
+    buffer.WriteInt( id );
+    buffer.WriteString( ( "message " + std::to_string( id ) ).c_str() );
+    const std::vector<char> extra( padding, 'x' );
+    buffer.WriteInt( static_cast<int>( padding ) );
+    buffer.WriteFastArray( extra.data(), extra.size() );
+  }
+
+  bool checkMessage( TBufferFile& buffer, int id ) {
+    int  readId = -1;
+    char text[64];
+    buffer.ReadInt( readId );
+    buffer.ReadString( text, sizeof( text ) );
+    return readId == id && std::string( text ) == "message " + std::to_string( id );
+  }
+} // namespace
+
+BOOST_AUTO_TEST_CASE( serialize_in_place ) {
+  GaudiMP::SharedMemoryRing ring( 2, 1024 );
+
+  BOOST_CHECK( ring.send( []( TBufferFile& buffer ) { writeMessage( buffer, 42 ); } ) );
+
+  const auto slot = ring.consume();
+  BOOST_REQUIRE( slot != ring.npos );
+  BOOST_CHECK( ring.view( slot ).data() == ring.data( slot ) );
+  auto in = ring.bufferFor( slot );
+  BOOST_CHECK( checkMessage( in, 42 ) );
+  ring.release( slot );
+}
+
+BOOST_AUTO_TEST_CASE( send_copy ) {
+  GaudiMP::SharedMemoryRing ring( 2, 1024 );
+
+  TBufferFile out( TBuffer::kWrite );
+  writeMessage( out, 7 );
+  BOOST_CHECK( ring.send( out ) );
+
+  const auto slot = ring.consume();
+  BOOST_REQUIRE( slot != ring.npos );
+  BOOST_CHECK_EQUAL( ring.view( slot ), std::string_view( out.Buffer(), out.Length() ) );
+  auto in = ring.bufferFor( slot );
+  BOOST_CHECK( checkMessage( in, 7 ) );
+  ring.release( slot );
+}
+
+BOOST_AUTO_TEST_CASE( too_large ) {
+  GaudiMP::SharedMemoryRing ring( 1, 256 );
+
+  // the content does not fit: nothing is published and the only slot is given back
+  BOOST_CHECK( !ring.send( []( TBufferFile& buffer ) { writeMessage( buffer, 1, 4096 ); } ) );
+  TBufferFile large( TBuffer::kWrite );
+  writeMessage( large, 1, 4096 );
+  BOOST_CHECK( !ring.send( large ) );
+
+  BOOST_CHECK( ring.send( []( TBufferFile& buffer ) { writeMessage( buffer, 2 ); } ) );
+  ring.close();
+  const auto slot = ring.consume();
+  BOOST_REQUIRE( slot != ring.npos );
+  auto in = ring.bufferFor( slot );
+  BOOST_CHECK( checkMessage( in, 2 ) );
+  ring.release( slot );
+  BOOST_CHECK( ring.consume() == ring.npos );
+}
+
+BOOST_AUTO_TEST_CASE( across_processes ) {
+  constexpr int             n = 100;
+  GaudiMP::SharedMemoryRing ring( 4, 1024 );
+
+  if ( const pid_t pid = ::fork(); pid == 0 ) {
+    for ( int i = 0; i < n; ++i ) {
+      if ( !ring.send( [i]( TBufferFile& buffer ) { writeMessage( buffer, i, i ); } ) ) std::_Exit( 1 );
+    }
+    ring.close();
+    std::_Exit( 0 );
+  } else {
+    // the slots are handed over in order with a single producer
+    int received = 0;
+    for ( auto slot = ring.consume(); slot != ring.npos; slot = ring.consume() ) {
+      auto in = ring.bufferFor( slot );
+      BOOST_CHECK( checkMessage( in, received ) );
+      ring.release( slot );
+      ++received;
+    }
+    int status = 0;
+    ::waitpid( pid, &status, 0 );
+    BOOST_CHECK( WIFEXITED( status ) && WEXITSTATUS( status ) == 0 );
+    BOOST_CHECK_EQUAL( received, n );
+  }
+}
@@ -0,0 +1,221 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include "CompactHistory.h"
+
+#include <GaudiKernel/GaudiException.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <tuple>
+#include <zlib.h>
+
+namespace {
+  constexpr std::array<char, 4> s_magic   = { 'G', 'P', 'R', 'V' };
+  constexpr std::uint8_t        s_version = 1;
+
+  /// Buffered writer to a gzip file
+  class Writer {
+  public:
+    explicit Writer( const std::string& fileName )
+        : m_fileName( fileName ), m_file( gzopen( fileName.c_str(), "ab" ) ) {
+      if ( !m_file ) { fail( "cannot open" ); }
+    }
+    ~Writer() {
+      if ( m_file ) { gzclose( m_file ); }
+    }
+    void bytes( const void* data, std::size_t n ) {
+      m_buffer.append( static_cast<const char*>( data ), n );
+      if ( m_buffer.size() > 65536 ) { flush(); }
+    }
+    template <typename T>
+    void integer( T v ) {
+      std::array<unsigned char, sizeof( T )> b;
+      for ( auto& c : b ) {
+        c = static_cast<unsigned char>( v & 0xff );
+        v = static_cast<T>( static_cast<std::make_unsigned_t<T>>( v ) >> 8 );
+      }
+      bytes( b.data(), b.size() );
+    }
+    void string( std::string_view s ) {
+      integer<std::uint32_t>( s.size() );
+      bytes( s.data(), s.size() );
+    }
+    void close() {
+      flush();
+      if ( gzclose( std::exchange( m_file, nullptr ) ) != Z_OK ) { fail( "cannot write" ); }
+    }
+
+  private:
+    void flush() {
+      if ( !m_buffer.empty() && gzwrite( m_file, m_buffer.data(), m_buffer.size() ) != int( m_buffer.size() ) ) {
+        fail( "cannot write" );
+      }
+      m_buffer.clear();
+    }
+    [[noreturn]] void fail( const std::string& what ) const {
+      throw GaudiException( what + " " + m_fileName, "CompactHistory", StatusCode::FAILURE );
+    }
+
+    std::string m_fileName;
+    gzFile      m_file;
+    std::string m_buffer;
+  };
+
+  /// Reader of a gzip file (or of a plain file)
+  class Reader {
+  public:
+    explicit Reader( const std::string& fileName )
+        : m_fileName( fileName ), m_file( gzopen( fileName.c_str(), "rb" ) ) {}
+    ~Reader() {
+      if ( m_file ) { gzclose( m_file ); }
+    }
+    explicit operator bool() const { return m_file; }
+    /// read n bytes, returning false at the end of the file
+    bool bytes( void* data, std::size_t n ) {
+      const int r = gzread( m_file, data, n );
+      if ( r == 0 && n ) { return false; }
+      if ( r != int( n ) ) {
+        throw GaudiException( "corrupted file " + m_fileName, "CompactHistory", StatusCode::FAILURE );
+      }
+      return true;
+    }
+    template <typename T>
+    T integer() {
+      std::array<unsigned char, sizeof( T )> b;
+      need( bytes( b.data(), b.size() ) );
+      std::make_unsigned_t<T> v = 0;
+      for ( auto i = b.size(); i > 0; --i ) v = ( v << 8 ) | b[i - 1];
+      return static_cast<T>( v );
+    }
+    void skip( std::size_t n ) {
+      std::array<char, 4096> tmp;
+      while ( n ) {
+        const auto chunk = std::min( n, tmp.size() );
+        need( bytes( tmp.data(), chunk ) );
+        n -= chunk;
+      }
+    }
+    void skipString() { skip( integer<std::uint32_t>() ); }
+    void need( bool ok ) const {
+      if ( !ok ) { throw GaudiException( "truncated file " + m_fileName, "CompactHistory", StatusCode::FAILURE ); }
+    }
+
+  private:
+    std::string m_fileName;
+    gzFile      m_file;
+  };
+
+  /// 64 bits FNV-1a hash
+  struct Hasher {
+    std::uint64_t value = 0xcbf29ce484222325ull;
+    void          bytes( const void* data, std::size_t n ) {
+      for ( auto c : std::string_view( static_cast<const char*>( data ), n ) ) {
+        value = ( value ^ static_cast<unsigned char>( c ) ) * 0x100000001b3ull;
+      }
+    }
+    void integer( std::uint32_t v ) { bytes( &v, sizeof( v ) ); }
+    void string( std::string_view s ) {
+      integer( s.size() );
+      bytes( s.data(), s.size() );
+    }
+  };
+} // namespace
+
+std::uint32_t CompactHistory::intern( std::string_view s ) {
+  if ( auto i = m_index.find( s ); i != m_index.end() ) { return i->second; }
+  const auto id = static_cast<std::uint32_t>( m_strings.size() );
+  m_index.emplace( m_strings.emplace_back( s ), id );
+  return id;
+}
+
+void CompactHistory::beginComponent( Kind kind, std::string_view type, std::string_view name ) {
+  const auto begin = static_cast<std::uint32_t>( m_props.size() );
+  m_components.push_back( { kind, intern( type ), intern( name ), begin, begin } );
+}
+
+void CompactHistory::addProperty( std::string_view name, std::string_view value ) {
+  m_props.emplace_back( intern( name ), intern( value ) );
+  m_components.back().end = static_cast<std::uint32_t>( m_props.size() );
+}
+
+void CompactHistory::seal() {
+  // the order of registration of the components is not reproducible
+  std::ranges::sort( m_components, [this]( const Component& a, const Component& b ) {
+    return std::tie( a.kind, m_strings[a.name], m_strings[a.type] ) <
+           std::tie( b.kind, m_strings[b.name], m_strings[b.type] );
+  } );
+  Hasher h;
+  for ( const auto& c : m_components ) {
+    h.integer( static_cast<std::uint32_t>( c.kind ) );
+    h.string( m_strings[c.type] );
+    h.string( m_strings[c.name] );
+    h.integer( c.end - c.begin );
+    for ( auto p = c.begin; p != c.end; ++p ) {
+      h.string( m_strings[m_props[p].first] );
+      h.string( m_strings[m_props[p].second] );
+    }
+  }
+  m_hash = h.value;
+}
+
+bool CompactHistory::write( const std::string& fileName ) const {
+  const bool withConfiguration = !storedConfigurations( fileName ).contains( m_hash );
+
+  Writer out( fileName );
+  out.bytes( s_magic.data(), s_magic.size() );
+  out.integer( s_version );
+  out.integer( m_hash );
+  out.integer( m_startTime );
+  out.string( m_hostName );
+  out.integer<std::uint8_t>( withConfiguration );
+  if ( withConfiguration ) {
+    out.integer<std::uint32_t>( m_strings.size() );
+    for ( const auto& s : m_strings ) out.string( s );
+    out.integer<std::uint32_t>( m_components.size() );
+    for ( const auto& c : m_components ) {
+      out.integer( static_cast<std::uint8_t>( c.kind ) );
+      out.integer( c.type );
+      out.integer( c.name );
+      out.integer( c.end - c.begin );
+      for ( auto p = c.begin; p != c.end; ++p ) {
+        out.integer( m_props[p].first );
+        out.integer( m_props[p].second );
+      }
+    }
+  }
+  out.close();
+  return withConfiguration;
+}
+
+std::set<std::uint64_t> CompactHistory::storedConfigurations( const std::string& fileName ) {
+  std::set<std::uint64_t> hashes;
+  Reader                  in( fileName );
+  if ( !in ) { return hashes; }
+  std::array<char, 4> magic;
+  while ( in.bytes( magic.data(), magic.size() ) ) {
+    if ( magic != s_magic || in.integer<std::uint8_t>() != s_version ) {
+      throw GaudiException( "unknown format of " + fileName, "CompactHistory", StatusCode::FAILURE );
+    }
+    const auto hash = in.integer<std::uint64_t>();
+    in.skip( sizeof( std::int64_t ) );
+    in.skipString();
+    if ( in.integer<std::uint8_t>() ) {
+      hashes.insert( hash );
+      for ( auto n = in.integer<std::uint32_t>(); n; --n ) in.skipString();
+      for ( auto n = in.integer<std::uint32_t>(); n; --n ) {
+        in.skip( 1 + 2 * sizeof( std::uint32_t ) );
+        in.skip( 2 * sizeof( std::uint32_t ) * in.integer<std::uint32_t>() );
+      }
+    }
+  }
+  return hashes;
+}
@@ -0,0 +1,92 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/** @class CompactHistory CompactHistory.h
+ *
+ *  Compact snapshot of the configuration of a job, used by HistorySvc to record the provenance in a binary file.
+ *
+ *  All the strings (component types and names, property names and values) are stored once in a table, and the
+ *  components refer to them by index. The configuration is identified by a hash of its content, so that a file
+ *  collecting the provenance of many jobs stores each distinct configuration only once.
+ *
+ *  The file is a sequence of gzip compressed records (one appended per job), each containing, with integers in
+ *  little endian order and strings as their length (u32) followed by their characters:
+ *  - magic "GPRV", version (u8), configuration hash (u64), start time (i64, seconds since epoch), host name
+ *  - a flag (u8) telling if the configuration follows (i.e. if it was not yet in the file), and in that case
+ *    - the number of strings (u32) and the strings
+ *    - the number of components (u32) and, for each of them, its kind (u8), the indices (u32) of its type and
+ *      name, the number of properties (u32) and the indices of the name and of the value of each property
+ */
+class CompactHistory {
+public:
+  /// Type of component
+  enum class Kind : std::uint8_t { JobOptions = 0, Service = 1, Algorithm = 2, AlgTool = 3 };
+
+  /// Start the snapshot of the configuration of a job
+  CompactHistory( std::int64_t startTime, std::string hostName )
+      : m_startTime( startTime ), m_hostName( std::move( hostName ) ) {}
+
+  /// Start the record of a component (the job options are recorded as a JobOptions component)
+  void beginComponent( Kind kind, std::string_view type, std::string_view name );
+  /// Record a property of the current component
+  void addProperty( std::string_view name, std::string_view value );
+
+  /// Sort the components and compute the hash of the configuration
+  void seal();
+
+  /// Hash of the configuration (after seal())
+  std::uint64_t hash() const { return m_hash; }
+  /// Number of distinct strings
+  std::size_t numStrings() const { return m_strings.size(); }
+  /// Number of components
+  std::size_t numComponents() const { return m_components.size(); }
+
+  /** Append the record of the job to the file.
+   *  @return true if the configuration was written, false if it was already in the file
+   *  @exception GaudiException if the file cannot be written
+   */
+  bool write( const std::string& fileName ) const;
+
+  /// Hashes of the configurations stored in a file (empty if the file does not exist)
+  static std::set<std::uint64_t> storedConfigurations( const std::string& fileName );
+
+private:
+  struct Component {
+    Kind          kind;
+    std::uint32_t type;
+    std::uint32_t name;
+    /// range of the properties in m_props
+    std::uint32_t begin;
+    std::uint32_t end;
+  };
+
+  /// Index of the string in the table, adding it if needed
+  std::uint32_t intern( std::string_view s );
+
+  std::deque<std::string>                             m_strings;
+  std::unordered_map<std::string_view, std::uint32_t> m_index;
+  std::vector<Component>                              m_components;
+  /// (name, value) indices of the properties of all components
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> m_props;
+  std::uint64_t                                        m_hash = 0;
+  std::int64_t                                         m_startTime;
+  std::string                                          m_hostName;
+};
@@ -26,6 +26,7 @@
 #include <Gaudi/Algorithm.h>
 #include <GaudiKernel/AlgTool.h>
 #include <GaudiKernel/Bootstrap.h>
+#include <GaudiKernel/GaudiException.h>
 #include <GaudiKernel/IAlgManager.h>
 #include <GaudiKernel/IAlgTool.h>
 #include <GaudiKernel/IAlgorithm.h>
@@ -33,6 +34,7 @@
 #include <GaudiKernel/IIncidentSvc.h>
 #include <GaudiKernel/IService.h>
 #include <GaudiKernel/IToolSvc.h>
+#include <GaudiKernel/Service.h>
 #include <GaudiKernel/ServiceHandle.h>
 #include <GaudiKernel/System.h>
 
@@ -41,6 +43,7 @@
 #include <boost/algorithm/string/predicate.hpp>
 namespace ba = boost::algorithm;
 
+#include <ctime>
 #include <fstream>
 #include <iostream>
 #include <limits>
@@ -156,6 +159,10 @@ StatusCode HistorySvc::initialize() {
   const bool oneShot = true; // make the listener called only once
   incidentSvc->addListener( this, IncidentType::BeginEvent, std::numeric_limits<long>::min(), rethrow, oneShot );
 
+  if ( m_compactOnly && ( m_dump || !m_outputFile.empty() ) ) {
+    warning() << "Dump and OutputFile are ignored with CompactOnly" << endmsg;
+  }
+
   m_outputFileTypeXML = ba::iends_with( m_outputFile.value(), ".xml" );
   ON_DEBUG if ( m_outputFileTypeXML ) { debug() << "output format is XML" << endmsg; }
 
@@ -167,6 +174,12 @@ StatusCode HistorySvc::initialize() {
 
 StatusCode HistorySvc::captureState() {
 
+  if ( !m_compactOutputFile.empty() ) {
+    if ( !m_compactHistory ) { captureCompactHistory(); }
+    // the history objects are only needed by the IHistorySvc clients and by the Dump and OutputFile printouts
+    if ( m_compactOnly ) { return StatusCode::SUCCESS; }
+  }
+
   if ( !m_jobHistory ) {
     m_jobHistory = std::make_unique<JobHistory>();
 
@@ -234,13 +247,66 @@ StatusCode HistorySvc::captureState() {
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+void HistorySvc::captureCompactHistory() {
+  // the properties are converted to strings only once, straight into the table of CompactHistory
+  m_compactHistory = std::make_unique<CompactHistory>( std::time( nullptr ), System::hostName() );
+  auto& compact    = *m_compactHistory;
+
+  compact.beginComponent( CompactHistory::Kind::JobOptions, "", "JobOptions" );
+  bool foundAppMgr = false;
+  for ( const auto& [name, value] : serviceLocator()->getOptsSvc().items() ) {
+    compact.addProperty( name, value );
+    foundAppMgr |= name.starts_with( "ApplicationMgr." );
+  }
+  if ( auto ap = service<IProperty>( "ApplicationMgr" ); ap && !foundAppMgr ) {
+    for ( const auto* prop : ap->getProperties() ) {
+      compact.addProperty( "ApplicationMgr." + prop->name(), prop->toString() );
+    }
+  }
+
+  auto add = [&compact]( CompactHistory::Kind kind, std::string_view type, const auto& component ) {
+    compact.beginComponent( kind, type, component.name() );
+    for ( const auto* prop : component.getProperties() ) {
+      if ( prop ) { compact.addProperty( prop->name(), prop->toString() ); }
+    }
+  };
+  if ( auto algMgr = Gaudi::svcLocator()->as<IAlgManager>() ) {
+    for ( auto ialg : algMgr->getAlgorithms() ) {
+      if ( auto alg = dynamic_cast<const Gaudi::Algorithm*>( ialg ) ) {
+        add( CompactHistory::Kind::Algorithm, alg->type(), *alg );
+      }
+    }
+  }
+  if ( m_toolSvc ) {
+    for ( auto itool : m_toolSvc->getTools() ) {
+      if ( auto tool = dynamic_cast<const AlgTool*>( itool ) ) {
+        add( CompactHistory::Kind::AlgTool, tool->type(), *tool );
+      }
+    }
+  }
+  for ( auto isvc : Gaudi::svcLocator()->getServices() ) {
+    if ( auto svc = dynamic_cast<const Service*>( isvc ) ) {
+      add( CompactHistory::Kind::Service, System::typeinfoName( typeid( *svc ) ), *svc );
+    }
+  }
+  m_compactHistory->seal();
+
+  ON_DEBUG
+  debug() << "Configuration " << std::hex << m_compactHistory->hash() << std::dec << ": "
+          << m_compactHistory->numComponents() << " components, " << m_compactHistory->numStrings()
+          << " distinct strings" << endmsg;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
 StatusCode HistorySvc::stop() {
 
   if ( !m_activate ) return StatusCode::SUCCESS;
 
-  if ( m_dump ) { listProperties().ignore(); }
+  // nothing to dump if the history objects were not created (CompactOnly)
+  if ( m_dump && m_jobHistory ) { listProperties().ignore(); }
 
-  if ( !m_outputFile.empty() ) {
+  if ( !m_outputFile.empty() && m_jobHistory ) {
     std::ofstream ofs( m_outputFile );
     if ( !ofs ) {
       error() << "Unable to open output file \"m_outputFile\"" << endmsg;
@@ -250,6 +316,15 @@ StatusCode HistorySvc::stop() {
     }
   }
 
+  if ( m_compactHistory ) {
+    try {
+      const bool isNew = m_compactHistory->write( m_compactOutputFile );
+      info() << "Provenance appended to " << m_compactOutputFile.value() << " (configuration " << std::hex
+             << m_compactHistory->hash() << std::dec << ( isNew ? " added" : " already stored" ) << ")" << endmsg;
+    } catch ( const GaudiException& e ) { error() << "Unable to write the provenance: " << e.message() << endmsg; }
+    m_compactHistory.reset();
+  }
+
   clearState();
 
   return StatusCode::SUCCESS;
@@ -10,6 +10,8 @@
 \***********************************************************************************/
 #pragma once
 
+#include "CompactHistory.h"
+
 #include <GaudiKernel/IHistorySvc.h>
 
 #include <Gaudi/Algorithm.h>
@@ -94,6 +96,13 @@ private:
   Gaudi::Property<bool>         m_dump{ this, "Dump", false };
   Gaudi::Property<bool>         m_activate{ this, "Activate", true };
   Gaudi::Property<std::string>  m_outputFile{ this, "OutputFile" };
+  Gaudi::Property<std::string>  m_compactOutputFile{
+      this, "CompactOutputFile", "",
+      "binary file (gzip compressed) to which the provenance of the job is appended, see CompactHistory" };
+  Gaudi::Property<bool>         m_compactOnly{
+      this, "CompactOnly", false,
+      "with CompactOutputFile, only record the compact provenance (no history objects for the IHistorySvc clients, "
+      "Dump and OutputFile)" };
   ServiceHandle<IAlgContextSvc> p_algCtxSvc{ this, "AlgContextSvc", "AlgContextSvc" };
 
   void clearState();
@@ -110,6 +119,10 @@ private:
 
   std::unique_ptr<JobHistory> m_jobHistory;
 
+  /// snapshot of the configuration for CompactOutputFile
+  std::unique_ptr<CompactHistory> m_compactHistory;
+  void                            captureCompactHistory();
+
   void dumpProperties( std::ofstream& ) const;
   void dumpProperties( const IService&, std::ofstream& ) const;
   void dumpProperties( const Gaudi::Algorithm&, std::ofstream& ) const;
@@ -8,6 +8,7 @@
 * granted to it by virtue of its status as an Intergovernmental Organization        *
 * or submit itself to any jurisdiction.                                             *
 \***********************************************************************************/
+#include <Gaudi/Decays/CompiledNode.h>
 #include <Gaudi/Decays/Decay.h>
 #include <Gaudi/Decays/Nodes.h>
 #include <Gaudi/Decays/NodesPIDs.h>
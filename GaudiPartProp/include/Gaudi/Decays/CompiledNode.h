@@ -0,0 +1,99 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <Gaudi/Decays/iNode.h>
+#include <Gaudi/ParticleID.h>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace Gaudi::Decays {
+  /** @class CompiledNode Decays/CompiledNode.h
+   *  The node which evaluates another (validated) node through a lookup table.
+   *
+   *  At construction the wrapped node is evaluated for all the particles known to the
+   *  Particle Property Service (and their antiparticles), and the outcome is stored in
+   *  a bitset indexed by PID (for the PIDs in [-2^17,2^17), i.e. most of them) or in
+   *  a small sorted table for the others.
+   *  The matching of a known PID is then a couple of bit operations, independently of
+   *  the complexity of the original tree, while unknown PIDs (e.g. nuclei or
+   *  generator specific codes) are matched by the original node.
+   *
+   *  The batch version of the matching is written to be vectorized by the compiler.
+   *
+   *  @code
+   *  const Decays::CompiledNode head( Decays::Nodes::CC( "B0" ), ppSvc );
+   *  std::vector<bool> accepted;
+   *  for ( const auto& pid : pids ) { accepted.push_back( head( pid ) ); }
+   *  @endcode
+   */
+  class GAUDI_API CompiledNode : public iNode {
+  public:
+    /** constructor from the node to be compiled
+     *  @param node the node (it is validated with the service)
+     *  @param svc pointer to Particle Property Service
+     *  @exception GaudiException if the node cannot be validated
+     */
+    CompiledNode( const iNode& node, const Gaudi::Interfaces::IParticlePropertySvc* svc );
+    /// copy constructor
+    CompiledNode( const CompiledNode& right );
+    /// MANDATORY: clone method ("virtual constructor")
+    CompiledNode* clone() const override;
+    /// MANDATORY: the only one essential method
+    bool operator()( const Gaudi::ParticleID& pid ) const override {
+      const auto index = bitIndex( pid.pid() );
+      if ( index < s_size && ( m_known[index / 64] >> ( index % 64 ) & 1 ) ) {
+        return m_accepted[index / 64] >> ( index % 64 ) & 1;
+      }
+      return slow( pid );
+    }
+    /// MANDATORY: the specific printout
+    std::ostream& fillStream( std::ostream& s ) const override;
+    /// MANDATORY: check the validity of the node
+    bool valid() const override;
+    /// MANDATORY: the proper validation of the node
+    StatusCode validate( const Gaudi::Interfaces::IParticlePropertySvc* svc ) const override;
+
+  public:
+    /** match a batch of PIDs
+     *  @param pids the particles to be compared
+     *  @param result the outcome of the matching for each PID (same size as pids)
+     *  @exception GaudiException if the sizes of the spans differ
+     */
+    void operator()( std::span<const Gaudi::ParticleID> pids, std::span<bool> result ) const;
+
+    /// get the original node
+    const iNode& node() const { return *m_node; }
+
+  private:
+    /// the matching of the PIDs not in the bitsets
+    bool slow( const Gaudi::ParticleID& pid ) const;
+
+    /// offset of the PIDs in the bitsets
+    static constexpr std::uint32_t s_offset = 1 << 17;
+    /// number of PIDs in the bitsets
+    static constexpr std::uint32_t s_size = 2 * s_offset;
+    /// position of a PID in the bitsets (>= s_size if out of range), computed in unsigned arithmetic to wrap around
+    static constexpr std::uint32_t bitIndex( int pid ) { return static_cast<std::uint32_t>( pid ) + s_offset; }
+
+    /// the original node
+    std::unique_ptr<iNode> m_node;
+    /// the PIDs in the range of the bitsets known to the service
+    std::vector<std::uint64_t> m_known;
+    /// the outcome of the node for the known PIDs
+    std::vector<std::uint64_t> m_accepted;
+    /// the outcome of the node for the known PIDs outside of the bitsets (sorted)
+    std::vector<std::pair<int, bool>> m_others;
+  };
+} // namespace Gaudi::Decays
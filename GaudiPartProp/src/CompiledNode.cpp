@@ -0,0 +1,96 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include <Gaudi/Decays/CompiledNode.h>
+#include <Gaudi/Interfaces/IParticlePropertySvc.h>
+#include <Gaudi/ParticleProperty.h>
+#include <GaudiKernel/GaudiException.h>
+#include <algorithm>
+#include <ostream>
+
+namespace Decays = Gaudi::Decays;
+
+/** @file
+ *  Implementation file for class Decays::CompiledNode
+ */
+Decays::CompiledNode::CompiledNode( const Decays::iNode& node, const Gaudi::Interfaces::IParticlePropertySvc* svc )
+    : m_node( node.clone() ), m_known( s_size / 64, 0 ), m_accepted( s_size / 64, 0 ) {
+  if ( !svc ) { throw GaudiException( "Invalid Particle Property Service", "Decays::CompiledNode", StatusCode::FAILURE ); }
+  if ( StatusCode sc = m_node->validate( svc ); sc.isFailure() ) {
+    throw GaudiException( "Unable to validate the node '" + m_node->toString() + "'", "Decays::CompiledNode", sc );
+  }
+  auto add = [this]( int pid ) {
+    const Gaudi::ParticleID id( pid );
+    const auto              index = bitIndex( pid );
+    if ( index < s_size ) {
+      m_known[index / 64] |= std::uint64_t{ 1 } << ( index % 64 );
+      if ( ( *m_node )( id ) ) { m_accepted[index / 64] |= std::uint64_t{ 1 } << ( index % 64 ); }
+    } else {
+      m_others.emplace_back( pid, ( *m_node )( id ) );
+    }
+  };
+  for ( const Gaudi::ParticleProperty* pp : *svc ) {
+    if ( !pp ) { continue; }
+    add( pp->pid().pid() );
+    add( -pp->pid().pid() );
+  }
+  std::ranges::sort( m_others );
+  const auto dups = std::ranges::unique( m_others, {}, &std::pair<int, bool>::first );
+  m_others.erase( dups.begin(), dups.end() );
+}
+
+Decays::CompiledNode::CompiledNode( const Decays::CompiledNode& right )
+    : Decays::iNode( right )
+    , m_node( right.m_node->clone() )
+    , m_known( right.m_known )
+    , m_accepted( right.m_accepted )
+    , m_others( right.m_others ) {}
+
+Decays::CompiledNode* Decays::CompiledNode::clone() const { return new CompiledNode( *this ); }
+
+std::ostream& Decays::CompiledNode::fillStream( std::ostream& s ) const { return m_node->fillStream( s ); }
+
+bool Decays::CompiledNode::valid() const { return m_node->valid(); }
+
+StatusCode Decays::CompiledNode::validate( const Gaudi::Interfaces::IParticlePropertySvc* svc ) const {
+  return m_node->validate( svc );
+}
+
+bool Decays::CompiledNode::slow( const Gaudi::ParticleID& pid ) const {
+  const auto it = std::ranges::lower_bound( m_others, pid.pid(), {}, &std::pair<int, bool>::first );
+  if ( it != m_others.end() && it->first == pid.pid() ) { return it->second; }
+  // not known to the service: use the original node
+  return ( *m_node )( pid );
+}
+
+void Decays::CompiledNode::operator()( std::span<const Gaudi::ParticleID> pids, std::span<bool> result ) const {
+  if ( pids.size() != result.size() ) {
+    throw GaudiException( "Mismatch between the number of PIDs and of results", "Decays::CompiledNode",
+                          StatusCode::FAILURE );
+  }
+  const std::uint64_t* known    = m_known.data();
+  const std::uint64_t* accepted = m_accepted.data();
+  // branch-free lookup of all the PIDs (out of range PIDs are looked up at index 0 and flagged as unknown)
+  bool allKnown = true;
+  for ( std::size_t i = 0; i < pids.size(); ++i ) {
+    const auto          index   = bitIndex( pids[i].pid() );
+    const std::uint64_t inRange = index < s_size;
+    const std::uint32_t safe    = index * static_cast<std::uint32_t>( inRange );
+    const std::uint64_t isKnown = ( known[safe / 64] >> ( safe % 64 ) ) & inRange;
+    result[i]                   = ( accepted[safe / 64] >> ( safe % 64 ) ) & isKnown;
+    allKnown &= static_cast<bool>( isKnown );
+  }
+  if ( allKnown ) { return; }
+  // rare case: some PIDs are not in the bitsets
+  for ( std::size_t i = 0; i < pids.size(); ++i ) {
+    const auto index = bitIndex( pids[i].pid() );
+    if ( index >= s_size || !( known[index / 64] >> ( index % 64 ) & 1 ) ) { result[i] = slow( pids[i] ); }
+  }
+}
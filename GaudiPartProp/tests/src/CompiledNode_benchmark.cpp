@@ -0,0 +1,153 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+// Compare the matching of PIDs with decay nodes and with their compiled version (Decays::CompiledNode),
+// for the nodes of a `[B0 -> K+ pi-]CC` descriptor and some more complex selections.
+//
+// usage: CompiledNode_benchmark ParticleTable.txt [n_pids [n_repeat]]
+#include <Gaudi/Decays/CompiledNode.h>
+#include <Gaudi/Decays/Nodes.h>
+#include <Gaudi/Decays/NodesPIDs.h>
+#include <Gaudi/Interfaces/IOptionsSvc.h>
+#include <Gaudi/Interfaces/IParticlePropertySvc.h>
+#include <Gaudi/ParticleProperty.h>
+#include <Gaudi/PluginService.h>
+#include <GaudiKernel/Bootstrap.h>
+#include <GaudiKernel/IAppMgrUI.h>
+#include <GaudiKernel/IProperty.h>
+#include <GaudiKernel/ISvcLocator.h>
+#include <GaudiKernel/SmartIF.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Decays = Gaudi::Decays;
+
+namespace {
+  /// Typical content of an event: mostly pions, kaons, photons and leptons, some other known particles
+  /// and a few PIDs unknown to the service.
+  std::vector<Gaudi::ParticleID> samplePids( const Gaudi::Interfaces::IParticlePropertySvc& svc, std::size_t n ) {
+    const std::vector<int> common{ 211, -211, 321, -321, 22, 11, -11, 13, -13, 2212, -2212, 111, 130, 310 };
+    std::vector<int>       known;
+    for ( const auto* pp : svc ) known.push_back( pp->pid().pid() );
+
+    std::mt19937                          gen{ 42 };
+    std::uniform_real_distribution<>      kind{ 0, 1 };
+    std::uniform_int_distribution<size_t> pickCommon{ 0, common.size() - 1 };
+    std::uniform_int_distribution<size_t> pickKnown{ 0, known.size() - 1 };
+    std::uniform_int_distribution<int>    pickAny{ -std::numeric_limits<int>::max(), std::numeric_limits<int>::max() };
+
+    std::vector<Gaudi::ParticleID> pids;
+    pids.reserve( n );
+    // PIDs at the edges of the range of int, that must not overflow the index in the bitsets
+    for ( int pid : { std::numeric_limits<int>::max(), std::numeric_limits<int>::max() - ( 1 << 17 ) + 1,
+                      -std::numeric_limits<int>::max() } ) {
+      if ( pids.size() < n ) pids.emplace_back( pid );
+    }
+    while ( pids.size() < n ) {
+      const double k = kind( gen );
+      if ( k < 0.9 ) {
+        pids.emplace_back( common[pickCommon( gen )] );
+      } else if ( k < 0.999 ) {
+        pids.emplace_back( known[pickKnown( gen )] );
+      } else {
+        pids.emplace_back( pickAny( gen ) );
+      }
+    }
+    return pids;
+  }
+
+  template <typename F>
+  double timeIt( int nRepeat, F&& f ) {
+    const auto start = std::chrono::steady_clock::now();
+    for ( int r = 0; r < nRepeat; ++r ) f();
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+  }
+
+  bool run( const std::string& name, const Decays::iNode& node, const Gaudi::Interfaces::IParticlePropertySvc* svc,
+            const std::vector<Gaudi::ParticleID>& pids, int nRepeat ) {
+    const Decays::CompiledNode compiled( node, svc );
+
+    std::vector<char> byNode( pids.size() ), byCompiled( pids.size() );
+    auto              batch = std::make_unique<bool[]>( pids.size() );
+
+    const double tNode = timeIt( nRepeat, [&]() {
+      for ( std::size_t i = 0; i < pids.size(); ++i ) byNode[i] = compiled.node()( pids[i] );
+    } );
+    const double tCompiled = timeIt( nRepeat, [&]() {
+      for ( std::size_t i = 0; i < pids.size(); ++i ) byCompiled[i] = compiled( pids[i] );
+    } );
+    const double tBatch = timeIt( nRepeat, [&]() { compiled( pids, { batch.get(), pids.size() } ); } );
+
+    long nAccepted = 0;
+    bool ok        = true;
+    for ( std::size_t i = 0; i < pids.size(); ++i ) {
+      nAccepted += byNode[i];
+      ok = ok && byNode[i] == byCompiled[i] && byNode[i] == batch[i];
+    }
+
+    const double n = double( pids.size() ) * nRepeat;
+    std::cout << std::left << std::setw( 12 ) << name << " " << std::setw( 60 ) << node.toString() << std::right
+              << std::fixed << std::setprecision( 2 ) << std::setw( 8 ) << 1e9 * tNode / n << std::setw( 10 )
+              << 1e9 * tCompiled / n << std::setw( 10 ) << 1e9 * tBatch / n << std::setw( 10 ) << nAccepted
+              << ( ok ? "" : "  MISMATCH" ) << std::endl;
+    return ok;
+  }
+} // namespace
+
+int main( int argc, char* argv[] ) {
+  if ( argc < 2 ) {
+    std::cerr << "usage: " << argv[0] << " ParticleTable.txt [n_pids [n_repeat]]" << std::endl;
+    return 2;
+  }
+  const std::string table   = argv[1];
+  const std::size_t nPids   = argc > 2 ? std::atol( argv[2] ) : 100000;
+  const int         nRepeat = argc > 3 ? std::atoi( argv[3] ) : 100;
+
+  Gaudi::PluginService::v2::Details::Registry::instance().loadPluginLibrary( "libGaudiPartPropModule.so" );
+  auto               app = Gaudi::createApplicationMgr();
+  SmartIF<IProperty> appProp{ app };
+  appProp->setProperty( "JobOptionsType", "NONE" ).ignore();
+  appProp->setPropertyRepr( "AppName", "''" ).ignore();
+  appProp->setProperty( "OutputLevel", 6 ).ignore();
+  if ( !app->configure() ) return 1;
+
+  auto svcLoc = Gaudi::svcLocator();
+  svcLoc->getOptsSvc().set( "Gaudi::ParticlePropertySvc.ParticlePropertiesFile", "'" + table + "'" );
+  auto ppSvc = svcLoc->service<Gaudi::Interfaces::IParticlePropertySvc>( "Gaudi::ParticlePropertySvc" );
+  if ( !ppSvc ) return 1;
+
+  const auto pids = samplePids( *ppSvc, nPids );
+  std::cout << nPids << " PIDs x " << nRepeat << ", time per PID in ns" << std::endl;
+  std::cout << std::left << std::setw( 12 ) << "" << " " << std::setw( 60 ) << "node" << std::right << std::setw( 8 )
+            << "node" << std::setw( 10 ) << "compiled" << std::setw( 10 ) << "batch" << std::setw( 10 ) << "accepted"
+            << std::endl;
+
+  using namespace Decays::Nodes;
+  const auto* svc = ppSvc.get();
+  bool        ok  = true;
+  // the nodes of [B0 -> K+ pi-]CC
+  ok = run( "head", CC( "B0" ), svc, pids, nRepeat ) && ok;
+  ok = run( "kaon", CC( "K+" ), svc, pids, nRepeat ) && ok;
+  ok = run( "pion", CC( "pi-" ), svc, pids, nRepeat ) && ok;
+  ok = run( "children", Pid( "K+" ) | Pid( "K-" ) | Pid( "pi+" ) | Pid( "pi-" ), svc, pids, nRepeat ) && ok;
+  // more complex selections
+  ok = run( "mesons", Meson() & Charged() & ~HasQuark( Gaudi::ParticleID::strange ), svc, pids, nRepeat ) && ok;
+  ok = run( "mixed", ( Baryon() & Charged() ) | ( Lepton() & Neutral() ) | Pid( "gamma" ), svc, pids, nRepeat ) && ok;
+
+  return ( app->terminate().isSuccess() && ok ) ? 0 : 1;
+}
@@ -0,0 +1,522 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include "AsyncFileSvc.h"
+
+#include <GaudiKernel/ISvcLocator.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <thread>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if __has_include( <linux/io_uring.h>)
+#  include <linux/io_uring.h>
+#  define GAUDI_HAVE_IO_URING 1
+#endif
+
+DECLARE_COMPONENT( AsyncFileSvc )
+
+namespace {
+  using ReadRequest  = IAsyncFileSvc::ReadRequest;
+  using ReadCallback = IAsyncFileSvc::ReadCallback;
+
+  /// Largest read accepted by the kernel in one call
+  constexpr std::size_t maxReadSize = 0x7ffff000;
+
+  /// Outcome of the reads of a batch, completed by the last read
+  class Batch {
+  public:
+    Batch( std::size_t n, ReadCallback done ) : m_results( n ), m_pending( n ), m_done( std::move( done ) ) {}
+
+    void complete( std::size_t i, std::int64_t result ) {
+      m_results[i] = result;
+      if ( m_pending.fetch_sub( 1, std::memory_order_acq_rel ) == 1 ) m_done( std::move( m_results ) );
+    }
+
+  private:
+    std::vector<std::int64_t> m_results;
+    std::atomic<std::size_t>  m_pending;
+    ReadCallback              m_done;
+  };
+
+  /// A read and the batch it belongs to
+  struct Operation {
+    ReadRequest            request;
+    std::shared_ptr<Batch> batch;
+    std::size_t            index;
+    /// bytes already read, when a read is resubmitted after a short read
+    std::size_t done = 0;
+  };
+
+  /// Common bookkeeping of the batches in flight
+  class BackendBase : public AsyncFileSvc::Backend {
+  public:
+    std::size_t inFlight() const override { return m_inFlight.load(); }
+
+  protected:
+    /// Split a batch in operations, accounting for it until its completion
+    std::vector<Operation> makeOperations( std::vector<ReadRequest>&& requests, ReadCallback&& done ) {
+      ++m_inFlight;
+      auto batch = std::make_shared<Batch>( requests.size(), [this, done = std::move( done )]( auto results ) {
+        done( std::move( results ) );
+        if ( --m_inFlight == 0 ) {
+          auto _ = std::scoped_lock{ m_idleMutex };
+          m_idle.notify_all();
+        }
+      } );
+      std::vector<Operation> ops;
+      ops.reserve( requests.size() );
+      for ( std::size_t i = 0; i < requests.size(); ++i ) ops.push_back( { requests[i], batch, i } );
+      return ops;
+    }
+
+    void waitIdle() {
+      auto lock = std::unique_lock{ m_idleMutex };
+      m_idle.wait( lock, [this] { return m_inFlight.load() == 0; } );
+    }
+
+  private:
+    std::atomic<std::size_t> m_inFlight{ 0 };
+    std::mutex               m_idleMutex;
+    std::condition_variable  m_idle;
+  };
+
+  /// Blocking read of the whole request (unless the end of file is reached)
+  std::int64_t preadAll( const ReadRequest& r ) {
+    std::size_t done = 0;
+    while ( done < r.buffer.size() ) {
+      const auto n = ::pread( r.fd, r.buffer.data() + done, r.buffer.size() - done, r.offset + done );
+      if ( n < 0 ) {
+        if ( errno == EINTR ) continue;
+        return -errno;
+      }
+      if ( n == 0 ) break; // end of file
+      done += n;
+    }
+    return done;
+  }
+
+  /// Backend doing the reads with pread() in a pool of threads
+  class ThreadPoolBackend : public BackendBase {
+  public:
+    explicit ThreadPoolBackend( unsigned int nThreads ) {
+      for ( unsigned int i = 0; i < std::max( nThreads, 1u ); ++i ) m_threads.emplace_back( [this] { run(); } );
+    }
+    ~ThreadPoolBackend() override { stop(); }
+
+    std::string name() const override { return "threads"; }
+
+    void submit( std::vector<ReadRequest> requests, ReadCallback done ) override {
+      auto ops = makeOperations( std::move( requests ), std::move( done ) );
+      {
+        auto _ = std::scoped_lock{ m_mutex };
+        std::move( ops.begin(), ops.end(), std::back_inserter( m_queue ) );
+      }
+      m_cond.notify_all();
+    }
+
+    StatusCode registerBuffers( const std::vector<std::span<std::byte>>& ) override { return StatusCode::SUCCESS; }
+
+    void stop() override {
+      {
+        auto _ = std::scoped_lock{ m_mutex };
+        m_stop = true;
+      }
+      m_cond.notify_all();
+      // the queue is drained before the threads exit
+      for ( auto& t : m_threads ) {
+        if ( t.joinable() ) t.join();
+      }
+    }
+
+  private:
+    void run() {
+      auto lock = std::unique_lock{ m_mutex };
+      while ( true ) {
+        m_cond.wait( lock, [this] { return m_stop || !m_queue.empty(); } );
+        if ( m_queue.empty() ) return;
+        auto op = std::move( m_queue.front() );
+        m_queue.pop_front();
+        lock.unlock();
+        op.batch->complete( op.index, preadAll( op.request ) );
+        lock.lock();
+      }
+    }
+
+    std::mutex               m_mutex;
+    std::condition_variable  m_cond;
+    std::deque<Operation>    m_queue;
+    bool                     m_stop = false;
+    std::vector<std::thread> m_threads;
+  };
+
+#ifdef GAUDI_HAVE_IO_URING
+  int sys_io_uring_setup( unsigned int entries, io_uring_params* p ) {
+    return static_cast<int>( ::syscall( __NR_io_uring_setup, entries, p ) );
+  }
+  int sys_io_uring_enter( int fd, unsigned int toSubmit, unsigned int minComplete, unsigned int flags ) {
+    return static_cast<int>( ::syscall( __NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0 ) );
+  }
+  int sys_io_uring_register( int fd, unsigned int opcode, void* arg, unsigned int nrArgs ) {
+    return static_cast<int>( ::syscall( __NR_io_uring_register, fd, opcode, arg, nrArgs ) );
+  }
+
+  /** Backend submitting the reads to an io_uring instance.
+   *
+   *  Submissions are serialized by a mutex, while the completions are reaped by a dedicated thread, which also
+   *  submits the reads that did not fit in the submission queue.
+   */
+  class UringBackend : public BackendBase {
+  public:
+    explicit UringBackend( unsigned int entries ) {
+      io_uring_params p{};
+      m_ringFd = sys_io_uring_setup( entries, &p );
+      if ( m_ringFd < 0 ) {
+        m_error = std::string{ "io_uring_setup: " } + strerror( errno );
+        return;
+      }
+      if ( !supportsRead() ) {
+        m_error = "IORING_OP_READ not supported by the kernel";
+        return;
+      }
+      m_entries = p.sq_entries;
+
+      m_sqRingSize = p.sq_off.array + p.sq_entries * sizeof( unsigned int );
+      m_cqRingSize = p.cq_off.cqes + p.cq_entries * sizeof( io_uring_cqe );
+      const bool singleMap = p.features & IORING_FEAT_SINGLE_MMAP;
+      if ( singleMap ) m_sqRingSize = m_cqRingSize = std::max( m_sqRingSize, m_cqRingSize );
+      m_sqRing = mapRing( m_sqRingSize, IORING_OFF_SQ_RING );
+      m_cqRing = singleMap ? m_sqRing : mapRing( m_cqRingSize, IORING_OFF_CQ_RING );
+      m_sqes   = static_cast<io_uring_sqe*>( mapRing( p.sq_entries * sizeof( io_uring_sqe ), IORING_OFF_SQES ) );
+      if ( !m_sqRing || !m_cqRing || !m_sqes ) {
+        m_error = std::string{ "mmap: " } + strerror( errno );
+        return;
+      }
+      auto sq   = static_cast<char*>( m_sqRing );
+      m_sqHead  = reinterpret_cast<unsigned int*>( sq + p.sq_off.head );
+      m_sqTail  = reinterpret_cast<unsigned int*>( sq + p.sq_off.tail );
+      m_sqMask  = *reinterpret_cast<unsigned int*>( sq + p.sq_off.ring_mask );
+      m_sqArray = reinterpret_cast<unsigned int*>( sq + p.sq_off.array );
+      auto cq   = static_cast<char*>( m_cqRing );
+      m_cqHead  = reinterpret_cast<unsigned int*>( cq + p.cq_off.head );
+      m_cqTail  = reinterpret_cast<unsigned int*>( cq + p.cq_off.tail );
+      m_cqMask  = *reinterpret_cast<unsigned int*>( cq + p.cq_off.ring_mask );
+      m_cqes    = reinterpret_cast<io_uring_cqe*>( cq + p.cq_off.cqes );
+
+      m_thread = std::thread{ [this] { run(); } };
+    }
+    ~UringBackend() override {
+      stop();
+      if ( m_sqes ) ::munmap( m_sqes, m_entries * sizeof( io_uring_sqe ) );
+      if ( m_cqRing && m_cqRing != m_sqRing ) ::munmap( m_cqRing, m_cqRingSize );
+      if ( m_sqRing ) ::munmap( m_sqRing, m_sqRingSize );
+      if ( m_ringFd >= 0 ) ::close( m_ringFd );
+    }
+
+    /// Reason why the ring could not be set up (empty if it is usable)
+    const std::string& error() const { return m_error; }
+
+    std::string name() const override { return "io_uring"; }
+
+    void submit( std::vector<ReadRequest> requests, ReadCallback done ) override {
+      auto ops = makeOperations( std::move( requests ), std::move( done ) );
+      auto _   = std::scoped_lock{ m_mutex };
+      std::move( ops.begin(), ops.end(), std::back_inserter( m_pending ) );
+      flush();
+    }
+
+    StatusCode registerBuffers( const std::vector<std::span<std::byte>>& buffers ) override {
+      auto _ = std::scoped_lock{ m_mutex };
+      if ( m_buffersRegistered ) {
+        sys_io_uring_register( m_ringFd, IORING_UNREGISTER_BUFFERS, nullptr, 0 );
+        m_buffersRegistered = false;
+      }
+      if ( buffers.empty() ) return StatusCode::SUCCESS;
+      std::vector<iovec> iovecs;
+      iovecs.reserve( buffers.size() );
+      for ( auto b : buffers ) iovecs.push_back( { b.data(), b.size() } );
+      if ( sys_io_uring_register( m_ringFd, IORING_REGISTER_BUFFERS, iovecs.data(), iovecs.size() ) < 0 ) {
+        return StatusCode::FAILURE;
+      }
+      m_buffersRegistered = true;
+      return StatusCode::SUCCESS;
+    }
+
+    void stop() override {
+      if ( !m_thread.joinable() ) return;
+      waitIdle();
+      {
+        // wake up the completion thread with a no-op without user data
+        auto          _    = std::scoped_lock{ m_mutex };
+        const auto    tail = *m_sqTail;
+        io_uring_sqe& sqe  = m_sqes[tail & m_sqMask];
+        std::memset( &sqe, 0, sizeof( sqe ) );
+        sqe.opcode                 = IORING_OP_NOP;
+        m_sqArray[tail & m_sqMask] = tail & m_sqMask;
+        std::atomic_ref{ *m_sqTail }.store( tail + 1, std::memory_order_release );
+        enter( 0 );
+      }
+      m_thread.join();
+    }
+
+  private:
+    void* mapRing( std::size_t size, off_t offset ) {
+      void* p = ::mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, offset );
+      return p == MAP_FAILED ? nullptr : p;
+    }
+
+    bool supportsRead() {
+      constexpr unsigned int nOps = 256;
+      std::vector<char>      storage( sizeof( io_uring_probe ) + nOps * sizeof( io_uring_probe_op ) );
+      auto                   probe = reinterpret_cast<io_uring_probe*>( storage.data() );
+      if ( sys_io_uring_register( m_ringFd, IORING_REGISTER_PROBE, probe, nOps ) < 0 ) return false;
+      return probe->last_op >= IORING_OP_READ && ( probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED );
+    }
+
+    /// Submit the entries of the submission queue not yet consumed by the kernel (m_mutex must be held)
+    void enter( unsigned int minComplete, unsigned int flags = 0 ) {
+      const auto toSubmit = *m_sqTail - std::atomic_ref{ *m_sqHead }.load( std::memory_order_acquire );
+      // on failure the entries stay in the queue and are submitted by the next call
+      while ( sys_io_uring_enter( m_ringFd, toSubmit, minComplete, flags ) < 0 && errno == EINTR ) {}
+    }
+
+    /// Move as many pending reads as possible to the submission queue (m_mutex must be held)
+    void flush() {
+      auto       tail = *m_sqTail;
+      const auto head = std::atomic_ref{ *m_sqHead }.load( std::memory_order_acquire );
+      bool       any  = false;
+      // limiting the reads in flight to the size of the submission queue also prevents completion queue overflows
+      while ( !m_pending.empty() && m_opsInFlight < m_entries && tail - head < m_entries ) {
+        auto          op  = std::make_unique<Operation>( std::move( m_pending.front() ) );
+        const auto    idx = tail & m_sqMask;
+        io_uring_sqe& sqe = m_sqes[idx];
+        m_pending.pop_front();
+        std::memset( &sqe, 0, sizeof( sqe ) );
+        sqe.opcode = op->request.registeredBuffer >= 0 ? IORING_OP_READ_FIXED : IORING_OP_READ;
+        sqe.fd     = op->request.fd;
+        sqe.off    = op->request.offset + op->done;
+        sqe.addr   = reinterpret_cast<std::uintptr_t>( op->request.buffer.data() + op->done );
+        sqe.len    = op->request.buffer.size() - op->done;
+        if ( op->request.registeredBuffer >= 0 ) sqe.buf_index = op->request.registeredBuffer;
+        sqe.user_data  = reinterpret_cast<std::uintptr_t>( op.release() );
+        m_sqArray[idx] = idx;
+        ++tail;
+        ++m_opsInFlight;
+        any = true;
+      }
+      if ( any ) {
+        std::atomic_ref{ *m_sqTail }.store( tail, std::memory_order_release );
+        enter( 0 );
+      }
+    }
+
+    /// Body of the completion thread
+    void run() {
+      bool stopping = false;
+      while ( !stopping ) {
+        if ( sys_io_uring_enter( m_ringFd, 0, 1, IORING_ENTER_GETEVENTS ) < 0 && errno != EINTR && errno != EAGAIN &&
+             errno != EBUSY ) {
+          // the ring is unusable: nothing else we can do than retrying
+          std::this_thread::yield();
+        }
+        std::vector<std::pair<std::unique_ptr<Operation>, std::int64_t>> completed;
+        std::vector<Operation>                                           resubmitted;
+
+        auto       head = *m_cqHead;
+        const auto tail = std::atomic_ref{ *m_cqTail }.load( std::memory_order_acquire );
+        for ( ; head != tail; ++head ) {
+          const io_uring_cqe& cqe = m_cqes[head & m_cqMask];
+          if ( cqe.user_data == 0 ) {
+            stopping = true;
+            continue;
+          }
+          std::unique_ptr<Operation> op{ reinterpret_cast<Operation*>( cqe.user_data ) };
+          if ( cqe.res == -EINTR || cqe.res == -EAGAIN ) {
+            resubmitted.push_back( std::move( *op ) );
+          } else if ( cqe.res < 0 ) {
+            completed.emplace_back( std::move( op ), cqe.res );
+          } else {
+            op->done += cqe.res;
+            if ( cqe.res > 0 && op->done < op->request.buffer.size() ) {
+              // short read: read the rest, as preadAll does (a read of 0 bytes means the end of file)
+              resubmitted.push_back( std::move( *op ) );
+            } else {
+              const std::int64_t done = op->done;
+              completed.emplace_back( std::move( op ), done );
+            }
+          }
+        }
+        std::atomic_ref{ *m_cqHead }.store( head, std::memory_order_release );
+        if ( !completed.empty() || !resubmitted.empty() ) {
+          // refill the submission queue before running the callbacks
+          auto _ = std::scoped_lock{ m_mutex };
+          m_opsInFlight -= completed.size() + resubmitted.size();
+          for ( auto& op : resubmitted ) m_pending.push_front( std::move( op ) );
+          flush();
+        }
+        for ( auto& [op, result] : completed ) op->batch->complete( op->index, result );
+      }
+    }
+
+    int         m_ringFd = -1;
+    std::string m_error;
+
+    unsigned int  m_entries    = 0;
+    void*         m_sqRing     = nullptr;
+    void*         m_cqRing     = nullptr;
+    std::size_t   m_sqRingSize = 0;
+    std::size_t   m_cqRingSize = 0;
+    io_uring_sqe* m_sqes       = nullptr;
+    unsigned int* m_sqHead     = nullptr;
+    unsigned int* m_sqTail     = nullptr;
+    unsigned int* m_sqArray    = nullptr;
+    unsigned int  m_sqMask     = 0;
+    unsigned int* m_cqHead     = nullptr;
+    unsigned int* m_cqTail     = nullptr;
+    io_uring_cqe* m_cqes       = nullptr;
+    unsigned int  m_cqMask     = 0;
+
+    /// protects the submission queue and the pending reads
+    std::mutex            m_mutex;
+    std::deque<Operation> m_pending;
+    unsigned int          m_opsInFlight       = 0;
+    bool                  m_buffersRegistered = false;
+
+    std::thread m_thread;
+  };
+#endif
+} // namespace
+
+StatusCode AsyncFileSvc::initialize() {
+  return Service::initialize().andThen( [&]() -> StatusCode {
+    m_fileMgr = service( "FileMgr" );
+    if ( !m_fileMgr ) {
+      error() << "Unable to get the FileMgr" << endmsg;
+      return StatusCode::FAILURE;
+    }
+
+    const std::string& backend = m_backendName.value();
+    if ( backend != "auto" && backend != "io_uring" && backend != "threads" ) {
+      error() << "Unknown backend '" << backend << "' (allowed: auto, io_uring, threads)" << endmsg;
+      return StatusCode::FAILURE;
+    }
+    if ( backend != "threads" ) {
+#ifdef GAUDI_HAVE_IO_URING
+      auto uring = std::make_unique<UringBackend>( m_queueDepth );
+      if ( uring->error().empty() ) {
+        m_backend = std::move( uring );
+      } else if ( backend == "io_uring" ) {
+        error() << "Cannot use io_uring: " << uring->error() << endmsg;
+        return StatusCode::FAILURE;
+      } else {
+        info() << "io_uring not available (" << uring->error() << "), falling back to threads" << endmsg;
+      }
+#else
+      if ( backend == "io_uring" ) {
+        error() << "Gaudi was built without io_uring support" << endmsg;
+        return StatusCode::FAILURE;
+      }
+#endif
+    }
+    if ( !m_backend ) m_backend = std::make_unique<ThreadPoolBackend>( m_nThreads );
+
+    info() << "Using the " << m_backend->name() << " backend" << endmsg;
+    return StatusCode::SUCCESS;
+  } );
+}
+
+StatusCode AsyncFileSvc::finalize() {
+  if ( m_backend ) {
+    m_backend->stop();
+    m_backend.reset();
+  }
+  m_registeredBuffers.clear();
+  if ( !m_openFiles.empty() ) {
+    warning() << m_openFiles.size() << " file(s) not closed by their users, closing them" << endmsg;
+    for ( auto fd : std::set<Io::Fd>{ m_openFiles } ) close( fd, name() ).ignore();
+  }
+  m_fileMgr.reset();
+  return Service::finalize();
+}
+
+Io::Fd AsyncFileSvc::open( const std::string& caller, const std::string& fname, const std::string& desc ) {
+  auto   _  = std::scoped_lock{ m_filesMutex };
+  Io::Fd fd = -1;
+  if ( m_fileMgr->open( Io::POSIX, caller, fname, Io::READ, fd, desc ) < 0 || fd < 0 ) {
+    error() << "Cannot open " << fname << " for " << caller << endmsg;
+    return -1;
+  }
+  m_openFiles.insert( fd );
+  return fd;
+}
+
+StatusCode AsyncFileSvc::close( Io::Fd fd, const std::string& caller ) {
+  auto _ = std::scoped_lock{ m_filesMutex };
+  if ( !m_openFiles.erase( fd ) ) {
+    error() << "File descriptor " << fd << " was not opened by " << name() << endmsg;
+    return StatusCode::FAILURE;
+  }
+  return m_fileMgr->close( fd, caller ) < 0 ? StatusCode::FAILURE : StatusCode::SUCCESS;
+}
+
+void AsyncFileSvc::read( std::vector<ReadRequest> requests, ReadCallback done ) {
+  // a batch with invalid requests is not submitted: the invalid reads fail with EINVAL, the others with ECANCELED
+  std::vector<std::int64_t> errors;
+  for ( std::size_t i = 0; i < requests.size(); ++i ) {
+    const auto& r     = requests[i];
+    bool        valid = r.buffer.size() <= maxReadSize;
+    if ( r.registeredBuffer >= 0 ) {
+      if ( static_cast<std::size_t>( r.registeredBuffer ) < m_registeredBuffers.size() ) {
+        const auto& reg = m_registeredBuffers[r.registeredBuffer];
+        valid = valid && r.buffer.data() >= reg.data() && r.buffer.data() + r.buffer.size() <= reg.data() + reg.size();
+      } else {
+        valid = false;
+      }
+    }
+    if ( !valid ) {
+      if ( errors.empty() ) errors.resize( requests.size(), -ECANCELED );
+      errors[i] = -EINVAL;
+    }
+  }
+  if ( !m_backend ) errors.resize( requests.size(), -ECANCELED );
+  if ( !errors.empty() || requests.empty() ) {
+    done( std::move( errors ) );
+    return;
+  }
+  m_backend->submit( std::move( requests ), std::move( done ) );
+}
+
+StatusCode AsyncFileSvc::registerBuffers( std::vector<std::span<std::byte>> buffers ) {
+  if ( !m_backend ) {
+    error() << "registerBuffers called before initialization" << endmsg;
+    return StatusCode::FAILURE;
+  }
+  if ( m_backend->inFlight() ) {
+    error() << "Cannot register buffers while reads are in flight" << endmsg;
+    return StatusCode::FAILURE;
+  }
+  if ( m_backend->registerBuffers( buffers ).isFailure() ) {
+    error() << "Failed to register " << buffers.size() << " buffers with the " << m_backend->name()
+            << " backend (check the limit of locked memory)" << endmsg;
+    return StatusCode::FAILURE;
+  }
+  m_registeredBuffers = std::move( buffers );
+  return StatusCode::SUCCESS;
+}
@@ -0,0 +1,77 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <GaudiKernel/IAsyncFileSvc.h>
+#include <GaudiKernel/IFileMgr.h>
+#include <GaudiKernel/Service.h>
+
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+/** @class AsyncFileSvc AsyncFileSvc.h
+ *
+ *  Implementation of IAsyncFileSvc with two backends:
+ *  - "io_uring": the reads are submitted to a Linux io_uring instance and completed by a dedicated thread
+ *    (registered buffers are registered in the kernel and read with fixed-buffer operations),
+ *  - "threads": the reads are done with pread() by a small pool of threads.
+ *
+ *  With the default Backend ("auto") io_uring is used when available, the thread pool otherwise.
+ *  The files are opened and closed through the FileMgr.
+ */
+class AsyncFileSvc : public extends<Service, IAsyncFileSvc> {
+public:
+  using extends::extends;
+
+  StatusCode initialize() override;
+  StatusCode finalize() override;
+
+  Io::Fd     open( const std::string& caller, const std::string& fname, const std::string& desc ) override;
+  StatusCode close( Io::Fd fd, const std::string& caller ) override;
+  void       read( std::vector<ReadRequest> requests, ReadCallback done ) override;
+  StatusCode registerBuffers( std::vector<std::span<std::byte>> buffers ) override;
+
+  /// Interface of the backends doing the actual reads
+  class Backend {
+  public:
+    virtual ~Backend() = default;
+    /// Name of the backend, for the printouts
+    virtual std::string name() const = 0;
+    /// Start the reads (already validated), `done` must be invoked once all of them completed
+    virtual void submit( std::vector<ReadRequest> requests, ReadCallback done ) = 0;
+    /// Replace the registered buffers (no read is in flight)
+    virtual StatusCode registerBuffers( const std::vector<std::span<std::byte>>& buffers ) = 0;
+    /// Number of batches not yet completed
+    virtual std::size_t inFlight() const = 0;
+    /// Wait for the completion of the reads in flight and release the resources
+    virtual void stop() = 0;
+  };
+
+private:
+  Gaudi::Property<std::string>  m_backendName{ this, "Backend", "auto",
+                                              "Backend used for the reads: auto, io_uring or threads" };
+  Gaudi::Property<unsigned int> m_queueDepth{ this, "QueueDepth", 256,
+                                              "Maximum number of reads in flight in the io_uring backend" };
+  Gaudi::Property<unsigned int> m_nThreads{ this, "NumThreads", 2,
+                                            "Number of threads of the thread pool backend" };
+
+  SmartIF<IFileMgr>        m_fileMgr;
+  std::unique_ptr<Backend> m_backend;
+
+  /// protects the calls to the FileMgr and the list of open files
+  std::mutex       m_filesMutex;
+  std::set<Io::Fd> m_openFiles;
+
+  std::vector<std::span<std::byte>> m_registeredBuffers;
+};
@@ -0,0 +1,111 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include "RawEventCnvSvc.h"
+#include "RawEventFile.h"
+#include <GaudiKernel/AnyDataWrapper.h>
+#include <GaudiKernel/DataObject.h>
+#include <GaudiKernel/GaudiException.h>
+#include <GaudiKernel/GenericAddress.h>
+#include <GaudiKernel/IDataProviderSvc.h>
+#include <GaudiKernel/IRegistry.h>
+
+#include <cstddef>
+#include <memory>
+#include <span>
+
+namespace {
+  /// Address of an event, keeping the file mapped
+  class RawEventAddress : public GenericAddress {
+  public:
+    RawEventAddress( std::shared_ptr<const Gaudi::RawEventFile> file, const CLID& clid, std::string root,
+                     unsigned long record )
+        : GenericAddress( RAWDATA_StorageType, clid, file->path(), std::move( root ), record )
+        , m_file{ std::move( file ) } {}
+    const std::shared_ptr<const Gaudi::RawEventFile>& file() const { return m_file; }
+
+  private:
+    std::shared_ptr<const Gaudi::RawEventFile> m_file;
+  };
+
+  /// Non-owning view on a record, keeping the file mapped while the object is in the store
+  class RawEventView : public AnyDataWrapper<std::span<const std::byte>> {
+  public:
+    RawEventView( std::shared_ptr<const Gaudi::RawEventFile> file, std::size_t record )
+        : AnyDataWrapper{ file->record( record ) }, m_file{ std::move( file ) } {}
+
+  private:
+    std::shared_ptr<const Gaudi::RawEventFile> m_file;
+  };
+
+  std::string stripPFN( const std::string& pfn ) { return pfn.starts_with( "PFN:" ) ? pfn.substr( 4 ) : pfn; }
+} // namespace
+
+StatusCode Gaudi::RawEventCnvSvc::finalize() {
+  {
+    auto _ = std::scoped_lock{ m_filesMutex };
+    m_files.clear();
+  }
+  return ConversionSvc::finalize();
+}
+
+std::shared_ptr<const Gaudi::RawEventFile> Gaudi::RawEventCnvSvc::connect( const std::string& pfn ) {
+  const auto path  = stripPFN( pfn );
+  auto       _     = std::scoped_lock{ m_filesMutex };
+  auto&      entry = m_files[path];
+  auto       file  = entry.lock();
+  if ( !file ) {
+    file  = std::make_shared<const RawEventFile>( path );
+    entry = file;
+    debug() << "Mapped " << path << " (" << file->size() << " events)" << endmsg;
+  }
+  return file;
+}
+
+StatusCode Gaudi::RawEventCnvSvc::createAddress( long svc_type, const CLID& clid, const std::string* par,
+                                                 const unsigned long* ipar, IOpaqueAddress*& refpAddress ) {
+  refpAddress = nullptr;
+  if ( svc_type != repSvcType() ) return StatusCode::FAILURE;
+  try {
+    auto file = connect( par[0] );
+    if ( ipar[0] >= file->size() ) {
+      error() << "No record " << ipar[0] << " in " << file->path() << endmsg;
+      return StatusCode::FAILURE;
+    }
+    refpAddress = new RawEventAddress( std::move( file ), clid, par[1], ipar[0] );
+  } catch ( const GaudiException& e ) {
+    error() << e.message() << endmsg;
+    return StatusCode::FAILURE;
+  }
+  return StatusCode::SUCCESS;
+}
+
+StatusCode Gaudi::RawEventCnvSvc::createObj( IOpaqueAddress* pAddress, DataObject*& refpObject ) {
+  refpObject = nullptr;
+  if ( !dynamic_cast<RawEventAddress*>( pAddress ) ) {
+    error() << "createObj> Not a raw event address" << endmsg;
+    return StatusCode::FAILURE;
+  }
+  refpObject = new DataObject();
+  return StatusCode::SUCCESS;
+}
+
+StatusCode Gaudi::RawEventCnvSvc::fillObjRefs( IOpaqueAddress* pAddress, DataObject* pObject ) {
+  auto addr = dynamic_cast<RawEventAddress*>( pAddress );
+  if ( !addr || !pObject || !pObject->registry() ) return StatusCode::FAILURE;
+  // register in the store the object was loaded into (e.g. the current slot of the whiteboard)
+  IDataProviderSvc* store = pObject->registry()->dataSvc();
+  auto              view  = std::make_unique<RawEventView>( addr->file(), addr->ipar()[0] );
+  StatusCode        sc    = store->registerObject( pObject, m_location.value(), view.get() );
+  if ( sc.isSuccess() ) view.release();
+  return sc;
+}
+
+DECLARE_COMPONENT( Gaudi::RawEventCnvSvc )
@@ -0,0 +1,57 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <GaudiKernel/ConversionSvc.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace Gaudi {
+  class RawEventFile;
+
+  /** @class RawEventCnvSvc RawEventCnvSvc.h
+   *
+   *  Conversion service for the events read from raw event files (see RawEventFile and RawEventSelector).
+   *
+   *  The files are memory mapped and the data is never copied: the root of the event is an empty DataObject,
+   *  below which (at RawEventLocation) the record is registered as an AnyDataWrapper<std::span<const std::byte>>
+   *  pointing to the mapped file. A file stays mapped as long as an address or an object refers to it.
+   */
+  class GAUDI_API RawEventCnvSvc : public ConversionSvc {
+  public:
+    RawEventCnvSvc( const std::string& name, ISvcLocator* svc ) : ConversionSvc( name, svc, RAWDATA_StorageType ) {}
+
+    StatusCode finalize() override;
+
+    /// Map the given file (or share the mapping of the other users), throwing GaudiException on failure
+    std::shared_ptr<const RawEventFile> connect( const std::string& pfn );
+
+    /// Create the address of an event: par = { file name, root name }, ipar = { record number, unused }
+    StatusCode createAddress( long svc_type, const CLID& clid, const std::string* par, const unsigned long* ipar,
+                              IOpaqueAddress*& refpAddress ) override;
+
+    /// Create the root of the event
+    StatusCode createObj( IOpaqueAddress* pAddress, DataObject*& refpObject ) override;
+
+    /// Register the view on the record below the root of the event
+    StatusCode fillObjRefs( IOpaqueAddress* pAddress, DataObject* pObject ) override;
+
+  private:
+    Gaudi::Property<std::string> m_location{ this, "RawEventLocation", "RawEvent",
+                                             "Location of the record, relative to the root of the event" };
+
+    std::mutex                                                m_filesMutex;
+    std::map<std::string, std::weak_ptr<const RawEventFile>> m_files;
+  };
+} // namespace Gaudi
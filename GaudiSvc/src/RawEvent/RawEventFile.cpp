@@ -0,0 +1,98 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include "RawEventFile.h"
+#include <GaudiKernel/GaudiException.h>
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <format>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+  static_assert( std::endian::native == std::endian::little, "RawEventFile only supports little-endian hosts" );
+
+  constexpr char          headerMagic[8]  = { 'G', 'A', 'U', 'D', 'I', 'R', 'A', 'W' };
+  constexpr char          trailerMagic[8] = { 'G', 'A', 'U', 'D', 'I', 'I', 'D', 'X' };
+  constexpr std::uint32_t version         = 1;
+  constexpr std::size_t   headerSize      = 16;
+
+  std::uint64_t readU64( const std::byte* p ) {
+    std::uint64_t v;
+    std::memcpy( &v, p, sizeof( v ) );
+    return v;
+  }
+} // namespace
+
+Gaudi::RawEventFile::RawEventFile( std::string path ) : m_path{ std::move( path ) } {
+  auto fail = [this]( std::string_view what ) {
+    // the destructor is not called if the constructor throws
+    if ( m_data ) ::munmap( m_data, m_length );
+    throw GaudiException( std::format( "{}: {}", m_path, what ), "Gaudi::RawEventFile", StatusCode::FAILURE );
+  };
+
+  const int fd = ::open( m_path.c_str(), O_RDONLY | O_CLOEXEC );
+  if ( fd < 0 ) fail( std::strerror( errno ) );
+  struct stat st;
+  if ( ::fstat( fd, &st ) != 0 ) {
+    const int err = errno;
+    ::close( fd );
+    fail( std::strerror( err ) );
+  }
+  m_length = st.st_size;
+  if ( m_length < headerSize + 16 ) {
+    ::close( fd );
+    fail( "file too short" );
+  }
+  void* data = ::mmap( nullptr, m_length, PROT_READ, MAP_SHARED, fd, 0 );
+  // the mapping keeps a reference to the file
+  ::close( fd );
+  if ( data == MAP_FAILED ) fail( std::strerror( errno ) );
+  m_data = static_cast<std::byte*>( data );
+
+  std::uint32_t fileVersion;
+  std::memcpy( &fileVersion, m_data + 8, sizeof( fileVersion ) );
+  if ( std::memcmp( m_data, headerMagic, 8 ) != 0 || fileVersion != version ) fail( "not a raw event file" );
+  if ( std::memcmp( m_data + m_length - 8, trailerMagic, 8 ) != 0 ) fail( "missing index (truncated file?)" );
+
+  const std::uint64_t nRecords = readU64( m_data + m_length - 16 );
+  if ( nRecords > ( m_length - headerSize - 16 ) / 8 ) fail( "corrupted index" );
+  const std::size_t indexStart = m_length - 16 - 8 * nRecords;
+
+  m_records.reserve( nRecords );
+  for ( std::size_t i = 0; i < nRecords; ++i ) {
+    const std::uint64_t offset = readU64( m_data + indexStart + 8 * i );
+    // indexStart >= headerSize > 8, while offset + 8 could wrap around
+    if ( offset < headerSize || offset > indexStart - 8 ) fail( std::format( "invalid offset of record {}", i ) );
+    const std::uint64_t size = readU64( m_data + offset );
+    if ( size > indexStart - offset - 8 ) fail( std::format( "invalid size of record {}", i ) );
+    m_records.emplace_back( m_data + offset + 8, size );
+  }
+}
+
+Gaudi::RawEventFile::~RawEventFile() {
+  if ( m_data ) ::munmap( m_data, m_length );
+}
+
+void Gaudi::RawEventFile::prefetch( std::size_t first, std::size_t last ) const {
+  last = std::min( last, m_records.size() );
+  if ( first >= last ) return;
+  static const std::size_t pageSize = ::sysconf( _SC_PAGESIZE );
+  // madvise requires a page aligned address
+  const std::size_t begin = ( m_records[first].data() - m_data - 8 ) / pageSize * pageSize;
+  const std::size_t end   = m_records[last - 1].data() + m_records[last - 1].size() - m_data;
+  ::madvise( m_data + begin, end - begin, MADV_WILLNEED );
+}
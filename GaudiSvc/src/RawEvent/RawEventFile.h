@@ -0,0 +1,57 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <GaudiKernel/Kernel.h>
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Gaudi {
+
+  /** @class RawEventFile RawEventFile.h
+   *
+   *  Read-only memory mapping of a file of raw events, giving access to the records without copying them.
+   *
+   *  The file format is (integers are little-endian):
+   *  - a header: the 8 characters "GAUDIRAW", the version (uint32, currently 1) and 4 reserved bytes,
+   *  - the records: the size of the payload (uint64) followed by the payload, padded with zeros to a multiple of
+   *    8 bytes,
+   *  - an index trailer: the offset of each record in the file (uint64), the number of records (uint64) and the
+   *    8 characters "GAUDIIDX".
+   *
+   *  The constructor throws a GaudiException if the file cannot be mapped or is not valid.
+   */
+  class RawEventFile {
+  public:
+    explicit RawEventFile( std::string path );
+    RawEventFile( const RawEventFile& )            = delete;
+    RawEventFile& operator=( const RawEventFile& ) = delete;
+    ~RawEventFile();
+
+    const std::string& path() const { return m_path; }
+    /// Number of records in the file
+    std::size_t size() const { return m_records.size(); }
+    /// Payload of the given record
+    std::span<const std::byte> record( std::size_t i ) const { return m_records[i]; }
+
+    /// Ask the kernel to start reading the pages of the records in [first, last)
+    void prefetch( std::size_t first, std::size_t last ) const;
+
+  private:
+    std::string                             m_path;
+    std::byte*                              m_data   = nullptr;
+    std::size_t                             m_length = 0;
+    std::vector<std::span<const std::byte>> m_records;
+  };
+} // namespace Gaudi
@@ -0,0 +1,213 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include "RawEventSelector.h"
+#include "RawEventFile.h"
+#include <GaudiKernel/AttribStringParser.h>
+#include <GaudiKernel/GaudiException.h>
+#include <GaudiKernel/IDataManagerSvc.h>
+#include <GaudiKernel/IPersistencySvc.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace {
+  /// Iteration state: the list of files, the current file and the current record in it
+  class RawEventSelectorContext : public IEvtSelector::Context {
+  public:
+    explicit RawEventSelectorContext( const Gaudi::RawEventSelector* s ) : m_sel{ s } {}
+    void* identifier() const override { return const_cast<Gaudi::RawEventSelector*>( m_sel ); }
+
+    std::vector<std::string>                   files;
+    std::size_t                                fileIndex = 0;
+    std::shared_ptr<const Gaudi::RawEventFile> file;
+    /// current record in the current file
+    long entry = -1;
+    /// end of the range of records of the current file already prefetched
+    std::size_t prefetched = 0;
+
+    /// Move to the given file (the current one is released)
+    void setFile( std::size_t index ) {
+      fileIndex  = index;
+      file       = nullptr;
+      entry      = -1;
+      prefetched = 0;
+    }
+
+  private:
+    const Gaudi::RawEventSelector* m_sel;
+  };
+
+  RawEventSelectorContext* rawContext( IEvtSelector::Context& ctxt ) {
+    return dynamic_cast<RawEventSelectorContext*>( &ctxt );
+  }
+} // namespace
+
+StatusCode Gaudi::RawEventSelector::initialize() {
+  return Service::initialize().andThen( [&]() -> StatusCode {
+    auto ipers = serviceLocator()->service<IPersistencySvc>( m_persName );
+    if ( !ipers ) {
+      error() << "Unable to locate IPersistencySvc interface of " << m_persName.value() << endmsg;
+      return StatusCode::FAILURE;
+    }
+    IConversionSvc* cnvSvc = nullptr;
+    if ( ipers->getService( RAWDATA_StorageType, cnvSvc ).isFailure() ) {
+      // no conversion service for raw data yet: provide ours
+      auto svc = serviceLocator()->service<IConversionSvc>( m_cnvSvcName );
+      if ( !svc || ipers->addCnvService( svc ).isFailure() ) {
+        error() << "Unable to register " << m_cnvSvcName.value() << " in " << m_persName.value() << endmsg;
+        return StatusCode::FAILURE;
+      }
+      cnvSvc = svc;
+    }
+    m_cnvSvc = dynamic_cast<RawEventCnvSvc*>( cnvSvc );
+    if ( !m_cnvSvc ) {
+      error() << "The conversion service for raw data is not a Gaudi::RawEventCnvSvc" << endmsg;
+      return StatusCode::FAILURE;
+    }
+    m_cnvSvc->addRef();
+
+    auto eds = serviceLocator()->service<IDataManagerSvc>( "EventDataSvc" );
+    if ( !eds ) {
+      error() << "Unable to localize service EventDataSvc" << endmsg;
+      return StatusCode::FAILURE;
+    }
+    m_rootCLID = eds->rootCLID();
+    m_rootName = eds->rootName();
+    return StatusCode::SUCCESS;
+  } );
+}
+
+StatusCode Gaudi::RawEventSelector::finalize() {
+  if ( m_cnvSvc ) m_cnvSvc->release();
+  m_cnvSvc = nullptr;
+  return Service::finalize();
+}
+
+StatusCode Gaudi::RawEventSelector::createContext( Context*& refpCtxt ) const {
+  refpCtxt = new RawEventSelectorContext( this );
+  return StatusCode::SUCCESS;
+}
+
+StatusCode Gaudi::RawEventSelector::next( Context& ctxt ) const { return next( ctxt, 1 ); }
+
+StatusCode Gaudi::RawEventSelector::next( Context& ctxt, int jump ) const {
+  auto pCtxt = rawContext( ctxt );
+  if ( !pCtxt || jump <= 0 ) return StatusCode::FAILURE;
+  while ( pCtxt->fileIndex < pCtxt->files.size() ) {
+    if ( !pCtxt->file ) {
+      try {
+        pCtxt->file = m_cnvSvc->connect( pCtxt->files[pCtxt->fileIndex] );
+      } catch ( const GaudiException& e ) {
+        error() << e.message() << ": file skipped" << endmsg;
+        pCtxt->setFile( pCtxt->fileIndex + 1 );
+        continue;
+      }
+    }
+    const long remaining = long( pCtxt->file->size() ) - pCtxt->entry - 1;
+    if ( jump <= remaining ) {
+      pCtxt->entry += jump;
+      const std::size_t entry = pCtxt->entry;
+      if ( m_prefetch > 0 && entry + m_prefetch / 2 >= pCtxt->prefetched ) {
+        // read ahead by chunks of half the window, not to call madvise for every event
+        const std::size_t first = std::max( pCtxt->prefetched, entry );
+        pCtxt->prefetched       = entry + m_prefetch;
+        pCtxt->file->prefetch( first, pCtxt->prefetched );
+      }
+      return StatusCode::SUCCESS;
+    }
+    jump -= remaining;
+    pCtxt->setFile( pCtxt->fileIndex + 1 );
+  }
+  return StatusCode::FAILURE;
+}
+
+StatusCode Gaudi::RawEventSelector::previous( Context& ctxt ) const { return previous( ctxt, 1 ); }
+
+StatusCode Gaudi::RawEventSelector::previous( Context& ctxt, int jump ) const {
+  auto pCtxt = rawContext( ctxt );
+  if ( pCtxt && jump > 0 ) {
+    if ( pCtxt->file && pCtxt->entry >= jump ) {
+      pCtxt->entry -= jump;
+      return StatusCode::SUCCESS;
+    }
+    error() << "EventSelector Iterator, operator -- not supported across file boundaries" << endmsg;
+  }
+  return StatusCode::FAILURE;
+}
+
+StatusCode Gaudi::RawEventSelector::last( Context& ctxt ) const {
+  auto pCtxt = rawContext( ctxt );
+  if ( !pCtxt || pCtxt->files.empty() ) return StatusCode::FAILURE;
+  if ( pCtxt->fileIndex != pCtxt->files.size() - 1 ) pCtxt->setFile( pCtxt->files.size() - 1 );
+  StatusCode sc = StatusCode::SUCCESS;
+  if ( !pCtxt->file ) sc = next( ctxt );
+  if ( sc.isSuccess() ) pCtxt->entry = long( pCtxt->file->size() ) - 1;
+  return sc;
+}
+
+StatusCode Gaudi::RawEventSelector::rewind( Context& ctxt ) const {
+  auto pCtxt = rawContext( ctxt );
+  if ( !pCtxt ) return StatusCode::FAILURE;
+  pCtxt->setFile( 0 );
+  return StatusCode::SUCCESS;
+}
+
+StatusCode Gaudi::RawEventSelector::createAddress( const Context& ctxt, IOpaqueAddress*& pAddr ) const {
+  pAddr      = nullptr;
+  auto pCtxt = dynamic_cast<const RawEventSelectorContext*>( &ctxt );
+  if ( !pCtxt || !pCtxt->file || pCtxt->entry < 0 ) return StatusCode::FAILURE;
+  const std::string   par[2]  = { pCtxt->file->path(), m_rootName };
+  const unsigned long ipar[2] = { static_cast<unsigned long>( pCtxt->entry ), 0 };
+  return m_cnvSvc->createAddress( RAWDATA_StorageType, m_rootCLID, par, ipar, pAddr );
+}
+
+StatusCode Gaudi::RawEventSelector::releaseContext( Context*& ctxt ) const {
+  auto pCtxt = dynamic_cast<RawEventSelectorContext*>( ctxt );
+  if ( !pCtxt ) return StatusCode::FAILURE;
+  delete pCtxt;
+  ctxt = nullptr;
+  return StatusCode::SUCCESS;
+}
+
+StatusCode Gaudi::RawEventSelector::resetCriteria( const std::string& criteria, Context& ctxt ) const {
+  auto pCtxt = rawContext( ctxt );
+  if ( !pCtxt ) {
+    error() << "Invalid iteration context." << endmsg;
+    return StatusCode::FAILURE;
+  }
+  std::string db;
+  if ( criteria.starts_with( "FILE " ) ) {
+    db = criteria.substr( 5 );
+  } else {
+    for ( auto attrib : Gaudi::Utils::AttribStringParser( criteria ) ) {
+      const auto tag = attrib.tag.substr( 0, 3 );
+      if ( tag == "DAT" ) {
+        db = std::move( attrib.value );
+      } else if ( tag == "OPT" && !attrib.value.starts_with( "REA" ) ) {
+        error() << "Option:\"" << attrib.value << "\" not valid" << endmsg;
+        return StatusCode::FAILURE;
+      }
+    }
+  }
+  // the format is: filename1, filename2 ...
+  pCtxt->files.clear();
+  std::size_t pos = 0;
+  while ( ( pos = db.find_first_not_of( " ,", pos ) ) != std::string::npos ) {
+    const auto end = db.find_first_of( " ,", pos );
+    pCtxt->files.push_back( db.substr( pos, end - pos ) );
+    pos = end;
+  }
+  pCtxt->setFile( 0 );
+  return StatusCode::SUCCESS;
+}
+
+DECLARE_COMPONENT( Gaudi::RawEventSelector )
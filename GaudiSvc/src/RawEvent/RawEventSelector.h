@@ -0,0 +1,67 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include "RawEventCnvSvc.h"
+#include <GaudiKernel/ClassID.h>
+#include <GaudiKernel/IEvtSelector.h>
+#include <GaudiKernel/Service.h>
+
+#include <string>
+
+namespace Gaudi {
+
+  /** @class RawEventSelector RawEventSelector.h
+   *
+   *  Event selector iterating over the records of raw event files (see RawEventFile), to be used as input stream
+   *  of the EventSelector:
+   *  @code
+   *  EventSelector().Input = ["DATAFILE='PFN:run1.raw' SVC='Gaudi::RawEventSelector' OPT='READ'"]
+   *  @endcode
+   *
+   *  The files are memory mapped by the RawEventCnvSvc (registered in the EventPersistencySvc if needed), which
+   *  puts in the event store views on the records instead of copies. While iterating, the kernel is asked to read
+   *  ahead the pages of the next PrefetchEvents records, so that the reads from the storage overlap with the
+   *  processing of the events in flight.
+   */
+  class GAUDI_API RawEventSelector : public extends<Service, IEvtSelector> {
+  public:
+    using extends::extends;
+
+    StatusCode initialize() override;
+    StatusCode finalize() override;
+
+    StatusCode createContext( Context*& refpCtxt ) const override;
+    StatusCode next( Context& refCtxt ) const override;
+    StatusCode next( Context& refCtxt, int jump ) const override;
+    StatusCode previous( Context& refCtxt ) const override;
+    StatusCode previous( Context& refCtxt, int jump ) const override;
+    StatusCode last( Context& refCtxt ) const override;
+    StatusCode rewind( Context& refCtxt ) const override;
+    StatusCode createAddress( const Context& refCtxt, IOpaqueAddress*& refpAddr ) const override;
+    StatusCode releaseContext( Context*& refCtxt ) const override;
+    /// Set the list of files, with criteria of the form "FILE name1, name2..." or "DATAFILE='name' ..."
+    StatusCode resetCriteria( const std::string& cr, Context& c ) const override;
+
+  private:
+    Gaudi::Property<std::string> m_persName{ this, "EvtPersistencySvc", "EventPersistencySvc",
+                                             "Name of the persistency service to search for conversion service" };
+    Gaudi::Property<std::string> m_cnvSvcName{ this, "ConversionSvc", "Gaudi::RawEventCnvSvc/RawEventCnvSvc",
+                                               "Conversion service used when none is registered for raw data" };
+    Gaudi::Property<unsigned int> m_prefetch{ this, "PrefetchEvents", 64,
+                                              "Number of records to read ahead (0 to disable the prefetching)" };
+
+    /// Conversion service mapping the files (reference counted)
+    RawEventCnvSvc* m_cnvSvc   = nullptr;
+    CLID            m_rootCLID = CLID_NULL;
+    std::string     m_rootName;
+  };
+} // namespace Gaudi
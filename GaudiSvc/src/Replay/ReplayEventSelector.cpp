@@ -0,0 +1,113 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include "ReplayEventSelector.h"
+#include <Gaudi/ReplayRecord.h>
+#include <GaudiKernel/ConcurrencyFlags.h>
+#include <GaudiKernel/IRndmEngine.h>
+#include <GaudiKernel/Incident.h>
+#include <GaudiKernel/SmartDataPtr.h>
+#include <GaudiKernel/TypeNameString.h>
+
+DECLARE_COMPONENT( Gaudi::ReplayEventSelector )
+
+StatusCode Gaudi::ReplayEventSelector::initialize() {
+  return Service::initialize().andThen( [&]() -> StatusCode {
+    // the files to replay are given to the selector doing the actual reading
+    if ( !m_input.empty() ) {
+      Gaudi::Utils::TypeNameString item( m_selectorName );
+      serviceLocator()->getOptsSvc().set( item.name() + ".Input", m_input.toString() );
+    }
+    m_selector = serviceLocator()->service( m_selectorName );
+    if ( !m_selector ) {
+      error() << "Unable to locate IEvtSelector interface of " << m_selectorName.value() << endmsg;
+      return StatusCode::FAILURE;
+    }
+    m_evtDataSvc = serviceLocator()->service( "EventDataSvc" );
+    if ( !m_evtDataSvc ) {
+      error() << "Unable to localize service EventDataSvc" << endmsg;
+      return StatusCode::FAILURE;
+    }
+    m_incidentSvc = serviceLocator()->service( "IncidentSvc" );
+    if ( !m_incidentSvc ) {
+      error() << "Unable to localize service IncidentSvc" << endmsg;
+      return StatusCode::FAILURE;
+    }
+    m_incidentSvc->addListener( this, IncidentType::BeginEvent );
+    if ( m_restoreSeeds && Gaudi::Concurrency::ConcurrencyFlags::concurrent() ) {
+      warning() << "The random number seeds are restored for the whole application: "
+                << "concurrent events will not be reproduced" << endmsg;
+    }
+    return StatusCode::SUCCESS;
+  } );
+}
+
+StatusCode Gaudi::ReplayEventSelector::finalize() {
+  info() << m_nReplayed << " events replayed";
+  if ( m_nMissing ) info() << ", " << m_nMissing << " events without " << ReplayRecord::location();
+  info() << endmsg;
+  if ( m_incidentSvc ) m_incidentSvc->removeListener( this, IncidentType::BeginEvent );
+  m_incidentSvc.reset();
+  m_evtDataSvc.reset();
+  m_rndmGenSvc.reset();
+  m_selector.reset();
+  return Service::finalize();
+}
+
+void Gaudi::ReplayEventSelector::handle( const Incident& ) {
+  SmartDataPtr<ReplayRecord> record( m_evtDataSvc, ReplayRecord::location() );
+  if ( !record ) {
+    if ( !m_nMissing++ ) {
+      warning() << "No " << ReplayRecord::location() << " in the event: was it in the ItemList of the capture stream?"
+                << endmsg;
+    }
+    return;
+  }
+  ++m_nReplayed;
+  info() << "Replaying event " << record->evt() << " (" << record->reason() << "), " << record->eventID() << endmsg;
+  if ( m_restoreSeeds && !record->seeds().empty() ) {
+    if ( !m_rndmGenSvc ) m_rndmGenSvc = serviceLocator()->service( "RndmGenSvc" );
+    if ( !m_rndmGenSvc || m_rndmGenSvc->engine()->setSeeds( record->seeds() ).isFailure() ) {
+      warning() << "Cannot restore the random number seeds of event " << record->evt() << endmsg;
+    }
+  }
+}
+
+StatusCode Gaudi::ReplayEventSelector::createContext( Context*& refpCtxt ) const {
+  return m_selector->createContext( refpCtxt );
+}
+
+StatusCode Gaudi::ReplayEventSelector::next( Context& refCtxt ) const { return m_selector->next( refCtxt ); }
+
+StatusCode Gaudi::ReplayEventSelector::next( Context& refCtxt, int jump ) const {
+  return m_selector->next( refCtxt, jump );
+}
+
+StatusCode Gaudi::ReplayEventSelector::previous( Context& refCtxt ) const { return m_selector->previous( refCtxt ); }
+
+StatusCode Gaudi::ReplayEventSelector::previous( Context& refCtxt, int jump ) const {
+  return m_selector->previous( refCtxt, jump );
+}
+
+StatusCode Gaudi::ReplayEventSelector::last( Context& refCtxt ) const { return m_selector->last( refCtxt ); }
+
+StatusCode Gaudi::ReplayEventSelector::rewind( Context& refCtxt ) const { return m_selector->rewind( refCtxt ); }
+
+StatusCode Gaudi::ReplayEventSelector::createAddress( const Context& refCtxt, IOpaqueAddress*& refpAddr ) const {
+  return m_selector->createAddress( refCtxt, refpAddr );
+}
+
+StatusCode Gaudi::ReplayEventSelector::releaseContext( Context*& refCtxt ) const {
+  return m_selector->releaseContext( refCtxt );
+}
+
+StatusCode Gaudi::ReplayEventSelector::resetCriteria( const std::string& cr, Context& c ) const {
+  return m_selector->resetCriteria( cr, c );
+}
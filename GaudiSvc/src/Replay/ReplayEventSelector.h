@@ -0,0 +1,78 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+#include <GaudiKernel/IDataProviderSvc.h>
+#include <GaudiKernel/IEvtSelector.h>
+#include <GaudiKernel/IIncidentListener.h>
+#include <GaudiKernel/IIncidentSvc.h>
+#include <GaudiKernel/IRndmGenSvc.h>
+#include <GaudiKernel/Service.h>
+
+#include <string>
+#include <vector>
+
+namespace Gaudi {
+
+  /** @class ReplayEventSelector ReplayEventSelector.h
+   *
+   *  Event selector re-running the events captured by HiveSlimEventLoopMgr (see its ReplayCaptureStream property)
+   *  so that slow or failing events can be investigated without the original input:
+   *  @code
+   *  ApplicationMgr(EventLoop="EventLoopMgr", ExtSvc=[ReplayEventSelector("EventSelector",
+   *                 Input=["DATAFILE='replay.dst' SVC='Gaudi::RootEvtSelector' OPT='READ'"])])
+   *  @endcode
+   *
+   *  The replay files are read by an EventSelector (see the Selector property) the iteration is delegated to. At
+   *  every BeginEvent the Gaudi::ReplayRecord of the event is read back, its original event number and EventIDBase
+   *  are printed and, unless RestoreSeeds is false, the seeds of the random number engine are set to the ones
+   *  the original event was reseeded with, if the capture used the ReplayReseed option of HiveSlimEventLoopMgr
+   *  (which requires a single event slot). As there is a single engine, the replay draws the same random numbers
+   *  as the original event only if it processes one event at a time.
+   */
+  class GAUDI_API ReplayEventSelector : public extends<Service, IEvtSelector, IIncidentListener> {
+  public:
+    using extends::extends;
+
+    StatusCode initialize() override;
+    StatusCode finalize() override;
+
+    StatusCode createContext( Context*& refpCtxt ) const override;
+    StatusCode next( Context& refCtxt ) const override;
+    StatusCode next( Context& refCtxt, int jump ) const override;
+    StatusCode previous( Context& refCtxt ) const override;
+    StatusCode previous( Context& refCtxt, int jump ) const override;
+    StatusCode last( Context& refCtxt ) const override;
+    StatusCode rewind( Context& refCtxt ) const override;
+    StatusCode createAddress( const Context& refCtxt, IOpaqueAddress*& refpAddr ) const override;
+    StatusCode releaseContext( Context*& refCtxt ) const override;
+    StatusCode resetCriteria( const std::string& cr, Context& c ) const override;
+
+    /// Restore the state of the replayed event at BeginEvent
+    void handle( const Incident& incident ) override;
+
+  private:
+    Gaudi::Property<std::vector<std::string>> m_input{ this, "Input", {}, "Replay files, as for EventSelector.Input" };
+    Gaudi::Property<std::string>              m_selectorName{
+        this, "Selector", "EventSelector/ReplayInput", "Type/Name of the event selector reading the replay files" };
+    Gaudi::Property<bool> m_restoreSeeds{ this, "RestoreSeeds", true,
+                                          "Restore the seeds of the random number engine of each event" };
+
+    SmartIF<IEvtSelector>     m_selector;
+    SmartIF<IIncidentSvc>     m_incidentSvc;
+    SmartIF<IDataProviderSvc> m_evtDataSvc;
+    SmartIF<IRndmGenSvc>      m_rndmGenSvc;
+
+    /// Number of events replayed, and of events without replay record
+    unsigned long m_nReplayed = 0;
+    unsigned long m_nMissing  = 0;
+  };
+} // namespace Gaudi
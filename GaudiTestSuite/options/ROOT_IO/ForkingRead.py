@@ -0,0 +1,32 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+####################################################################
+# Read ROOTIO.dst with ForkingEventLoopMgr: each worker opens the
+# input after the fork and reads the events it takes from the queue
+####################################################################
+
+from Configurables import ForkingEventLoopMgr, GaudiPersistency, ReadAlg
+from Configurables import Gaudi__RootCnvSvc as RootCnvSvc
+from Gaudi.Configuration import *
+
+# I/O
+GaudiPersistency()
+FileCatalog(Catalogs=["xmlcatalog_file:ROOTIO.xml"])
+esel = EventSelector(PrintFreq=50, FirstEvent=1)
+esel.Input = ["DATAFILE='PFN:ROOTIO.dst'  SVC='Gaudi::RootEvtSelector' OPT='READ'"]
+
+app = ApplicationMgr(
+    EvtMax=60,
+    HistogramPersistency="NONE",
+    EventLoop=ForkingEventLoopMgr(NumWorkers=3, ChunkSize=4, MergeCommand=""),
+    TopAlg=[ReadAlg()],
+)
+RootCnvSvc(OutputLevel=INFO)
@@ -0,0 +1,38 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+"""
+Copy ROOTIO.dst with an InputCopyStream whose ItemList also selects objects of
+the input file, which must be written only once.
+"""
+
+from Configurables import Gaudi__RootCnvSvc as RootCnvSvc
+from Configurables import GaudiPersistency, InputCopyStream
+from Gaudi.Configuration import *
+
+GaudiPersistency()
+FileCatalog(Catalogs=["xmlcatalog_file:ROOTIO.xml"])
+EventSelector(
+    Input=["DATAFILE='PFN:ROOTIO.dst'  SVC='Gaudi::RootEvtSelector' OPT='READ'"]
+)
+
+copy = InputCopyStream(
+    "CopyOverlap",
+    ItemList=["/Event/Collision_0#2", "/Event/MyTracks#1"],
+    Output="DATAFILE='PFN:InputCopyOverlap.dst' SVC='Gaudi::RootCnvSvc' OPT='RECREATE'",
+    OutputLevel=DEBUG,
+)
+
+ApplicationMgr(
+    OutStream=[copy],
+    EvtMax=5,
+    HistogramPersistency="NONE",
+)
+RootCnvSvc(OutputLevel=INFO)
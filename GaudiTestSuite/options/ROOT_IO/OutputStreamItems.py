@@ -0,0 +1,59 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+"""
+Copy the events of ROOTIO.dst accepted by a filter (one out of two) with an
+OutputStream, to check the compilation of its item lists and that the objects
+of the items are loaded only for the accepted events.
+"""
+
+from Configurables import Gaudi__RootCnvSvc as RootCnvSvc
+from Configurables import Gaudi__TestSuite__CheckLoaded as CheckLoaded
+from Configurables import GaudiPersistency
+from Configurables import GaudiTesting__OddEventsFilter as OddFilter
+from Gaudi.Configuration import *
+
+GaudiPersistency()
+FileCatalog(Catalogs=["xmlcatalog_file:ROOTIO.xml"])
+EventSelector(
+    Input=["DATAFILE='PFN:ROOTIO.dst'  SVC='Gaudi::RootEvtSelector' OPT='READ'"]
+)
+
+accept = OddFilter("Accept")
+stream = OutputStream(
+    "ItemsStream",
+    # /Event/Collision_0 is requested twice and /Event#1 is also added implicitly
+    # (VerifyItems): the duplicates are merged
+    ItemList=["/Event/Collision_0#1", "/Event#1", "/Event/Collision_0#2"],
+    # all but /Event/MyTracks are covered by the mandatory items
+    OptItemList=["/Event/Collision_0/MyVertices#1", "/Event/MyTracks#1", "/Event#1"],
+    Preload=True,
+    PreloadOptItems=True,
+    AcceptAlgs=[accept.name()],
+    Output="DATAFILE='PFN:OutputItems.dst' SVC='Gaudi::RootCnvSvc' OPT='RECREATE'",
+    OutputLevel=DEBUG,
+)
+# run after the stream, to see what it loaded
+check = CheckLoaded(
+    "CheckLoaded",
+    Paths=[
+        "/Event/Collision_0",
+        "/Event/Collision_0/MyVertices",
+        "/Event/MyTracks",
+        "/Event/Collision_1",
+    ],
+)
+
+ApplicationMgr(
+    TopAlg=[accept, stream, check],
+    EvtMax=10,
+    HistogramPersistency="NONE",
+)
+RootCnvSvc(OutputLevel=INFO)
@@ -0,0 +1,47 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+####################################################################
+# Navigate in ROOTIO_index.dst with RootEvtSelector, reading all
+# the events or only those selected with the event index
+####################################################################
+
+from Configurables import Gaudi__RootCnvSvc as RootCnvSvc
+from Configurables import Gaudi__RootEvtSelector as RootEvtSelector
+from Configurables import (
+    Gaudi__TestSuite__EvtSelectorNavigation as EvtSelectorNavigation,
+)
+from Configurables import GaudiPersistency
+from Gaudi.Configuration import *
+
+GaudiPersistency()
+FileCatalog(Catalogs=["xmlcatalog_file:ROOTIO_index.xml"])
+RootCnvSvc(OutputLevel=INFO)
+
+input = "DATAFILE='PFN:ROOTIO_index.dst' SVC='Gaudi::RootEvtSelector' OPT='READ'"
+selectors = [
+    RootEvtSelector("All"),
+    RootEvtSelector(
+        "ByEvent", SelectEvents=["1:3", "2:12", "3:27", "4:30", "5:41", "9:99"]
+    ),
+    RootEvtSelector("ByRun", SelectRuns=[(2, 3)]),
+]
+
+app = ApplicationMgr(
+    TopAlg=[
+        EvtSelectorNavigation(
+            f"Nav{sel.name()}", Selector=sel.getFullName(), Input=input
+        )
+        for sel in selectors
+    ],
+    EvtMax=1,
+    EvtSel="NONE",
+    HistogramPersistency="NONE",
+)
@@ -0,0 +1,35 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+####################################################################
+# Re-run the events captured by ReplayCapture.py
+####################################################################
+
+from Configurables import Gaudi__ReplayEventSelector as ReplayEventSelector
+from Configurables import Gaudi__RootCnvSvc as RootCnvSvc
+from Configurables import Gaudi__TestSuite__PrintRandom as PrintRandom
+from Configurables import GaudiPersistency, ReadAlg
+from Gaudi.Configuration import *
+
+# I/O
+GaudiPersistency()
+FileCatalog(Catalogs=["xmlcatalog_file:ROOTIO.xml"])
+esel = ReplayEventSelector(
+    "EventSelector",
+    Input=["DATAFILE='PFN:ReplayCapture.dst' SVC='Gaudi::RootEvtSelector' OPT='READ'"],
+)
+
+app = ApplicationMgr(
+    EvtMax=-1,
+    HistogramPersistency="NONE",
+    ExtSvc=[esel],
+    TopAlg=[ReadAlg(), PrintRandom()],
+)
+RootCnvSvc(OutputLevel=INFO)
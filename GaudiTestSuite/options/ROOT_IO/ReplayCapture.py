@@ -0,0 +1,53 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+####################################################################
+# Process ROOTIO.dst with the multithreaded event loop, capturing
+# two events for replay. The events are processed one at a time and
+# the random number engine is reseeded for each of them, so that the
+# replay draws the same random numbers (see Replay.py).
+####################################################################
+
+from Configurables import AvalancheSchedulerSvc, GaudiPersistency, HiveSlimEventLoopMgr
+from Configurables import Gaudi__RootCnvSvc as RootCnvSvc
+from Configurables import Gaudi__TestSuite__PrintRandom as PrintRandom
+from Configurables import HiveWhiteBoard, InputCopyStream, ReadAlg
+from Gaudi.Configuration import *
+
+# I/O
+GaudiPersistency()
+FileCatalog(Catalogs=["xmlcatalog_file:ROOTIO.xml"])
+esel = EventSelector(OutputLevel=DEBUG, PrintFreq=50, FirstEvent=1)
+esel.Input = ["DATAFILE='PFN:ROOTIO.dst'  SVC='Gaudi::RootEvtSelector' OPT='READ'"]
+
+# Stream writing the captured events, with their replay record
+InputCopyStream(
+    "ReplayCapture",
+    ItemList=["/Event/ReplayRecord#1"],
+    Output="DATAFILE='PFN:ReplayCapture.dst' SVC='Gaudi::RootCnvSvc' OPT='RECREATE'",
+)
+
+whiteboard = HiveWhiteBoard("EventDataSvc", EventSlots=1)
+scheduler = AvalancheSchedulerSvc(ThreadPoolSize=2)
+slimeventloopmgr = HiveSlimEventLoopMgr(
+    SchedulerName=scheduler.name(),
+    ReplayCaptureStream="InputCopyStream/ReplayCapture",
+    ReplayCaptureEvents=[2, 5],
+    ReplayReseed=True,
+)
+
+app = ApplicationMgr(
+    EvtMax=10,
+    HistogramPersistency="NONE",
+    EventLoop=slimeventloopmgr,
+    ExtSvc=[whiteboard],
+    TopAlg=[ReadAlg(), PrintRandom(OutputFile="ReplayCaptureRandom.txt")],
+)
+RootCnvSvc(OutputLevel=INFO)
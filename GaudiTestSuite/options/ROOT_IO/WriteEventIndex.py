@@ -0,0 +1,34 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+####################################################################
+# Write a DST with its event index, with 10 events per run
+####################################################################
+
+from Configurables import Gaudi__RootCnvSvc as RootCnvSvc
+from Configurables import Gaudi__TestSuite__SetEventID as SetEventID
+from Configurables import GaudiPersistency
+from Gaudi.Configuration import *
+
+dst = OutputStream("RootDst")
+dst.ItemList = ["/Event#999"]
+dst.Output = "DATAFILE='PFN:ROOTIO_index.dst' SVC='Gaudi::RootCnvSvc' OPT='RECREATE'"
+
+FileCatalog(Catalogs=["xmlcatalog_file:ROOTIO_index.xml"])
+GaudiPersistency()
+RootCnvSvc(OutputLevel=INFO, WriteEventIndex=True)
+
+app = ApplicationMgr(
+    TopAlg=[SetEventID(FirstRun=1, EventsPerRun=10), "WriteAlg"],
+    OutStream=[dst],
+    EvtMax=50,
+    EvtSel="NONE",
+    HistogramPersistency="NONE",
+)
@@ -0,0 +1,77 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+"""
+Read raw event files (see Gaudi::RawEventFile) with several threads and event
+slots, checking the content of the records.
+
+The two input files are written by this options file: record number n has a
+payload of 8 + n * 37 % 4000 bytes, starting with n (uint64) followed by bytes
+with value (n + position) % 251.
+"""
+
+import struct
+
+from Configurables import (
+    AvalancheSchedulerSvc,
+    Gaudi__Hive__FetchDataFromFile,
+    Gaudi__TestSuite__RawEventReader,
+    HiveSlimEventLoopMgr,
+    HiveWhiteBoard,
+)
+from Gaudi.Configuration import *
+
+
+def record(n):
+    size = 8 + n * 37 % 4000
+    pattern = bytes(range(251)) * (size // 251 + 2)
+    start = (n + 8) % 251
+    return struct.pack("<Q", n) + pattern[start : start + size - 8]
+
+
+def writeRawEventFile(name, numbers):
+    with open(name, "wb") as f:
+        f.write(b"GAUDIRAW" + struct.pack("<II", 1, 0))
+        offsets = []
+        for n in numbers:
+            payload = record(n)
+            offsets.append(f.tell())
+            f.write(struct.pack("<Q", len(payload)) + payload)
+            f.write(b"\0" * (-len(payload) % 8))
+        f.write(struct.pack("<%dQ" % len(offsets), *offsets))
+        f.write(struct.pack("<Q", len(offsets)) + b"GAUDIIDX")
+
+
+writeRawEventFile("raw_event_1.raw", range(0, 300))
+writeRawEventFile("raw_event_2.raw", range(300, 500))
+
+EventSelector(
+    PrintFreq=100,
+    Input=[
+        "DATAFILE='PFN:raw_event_1.raw' SVC='Gaudi::RawEventSelector' OPT='READ'",
+        "DATAFILE='PFN:raw_event_2.raw' SVC='Gaudi::RawEventSelector' OPT='READ'",
+    ],
+)
+
+loader = Gaudi__Hive__FetchDataFromFile("Loader", DataKeys=["/Event/RawEvent"])
+reader = Gaudi__TestSuite__RawEventReader("Reader")
+
+whiteboard = HiveWhiteBoard("EventDataSvc", EventSlots=8)
+scheduler = AvalancheSchedulerSvc(
+    ThreadPoolSize=4, OutputLevel=WARNING, DataLoaderAlg=loader.name()
+)
+
+ApplicationMgr(
+    TopAlg=[loader, reader],
+    EvtMax=-1,
+    ExtSvc=[whiteboard],
+    EventLoop=HiveSlimEventLoopMgr(OutputLevel=INFO),
+    MessageSvcType="InertMessageSvc",
+)
@@ -0,0 +1,76 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+"""
+Read a raw event file with an invalid index (the offset of the record is close
+to 2^64, so that adding the size of the length field wraps around), which must
+be rejected, followed by a valid file.
+
+The content of the records is the same as in Read.py.
+"""
+
+import struct
+
+from Configurables import (
+    AvalancheSchedulerSvc,
+    Gaudi__Hive__FetchDataFromFile,
+    Gaudi__TestSuite__RawEventReader,
+    HiveSlimEventLoopMgr,
+    HiveWhiteBoard,
+)
+from Gaudi.Configuration import *
+
+
+def record(n):
+    size = 8 + n * 37 % 4000
+    pattern = bytes(range(251)) * (size // 251 + 2)
+    start = (n + 8) % 251
+    return struct.pack("<Q", n) + pattern[start : start + size - 8]
+
+
+def writeRawEventFile(name, numbers, offsets=None):
+    with open(name, "wb") as f:
+        f.write(b"GAUDIRAW" + struct.pack("<II", 1, 0))
+        positions = []
+        for n in numbers:
+            payload = record(n)
+            positions.append(f.tell())
+            f.write(struct.pack("<Q", len(payload)) + payload)
+            f.write(b"\0" * (-len(payload) % 8))
+        offsets = offsets or positions
+        f.write(struct.pack("<%dQ" % len(offsets), *offsets))
+        f.write(struct.pack("<Q", len(offsets)) + b"GAUDIIDX")
+
+
+writeRawEventFile("bad_offset.raw", [0], offsets=[2**64 - 8])
+writeRawEventFile("after_bad.raw", range(100))
+
+EventSelector(
+    Input=[
+        "DATAFILE='PFN:bad_offset.raw' SVC='Gaudi::RawEventSelector' OPT='READ'",
+        "DATAFILE='PFN:after_bad.raw' SVC='Gaudi::RawEventSelector' OPT='READ'",
+    ],
+)
+
+loader = Gaudi__Hive__FetchDataFromFile("Loader", DataKeys=["/Event/RawEvent"])
+reader = Gaudi__TestSuite__RawEventReader("Reader")
+
+whiteboard = HiveWhiteBoard("EventDataSvc", EventSlots=2)
+scheduler = AvalancheSchedulerSvc(
+    ThreadPoolSize=2, OutputLevel=WARNING, DataLoaderAlg=loader.name()
+)
+
+ApplicationMgr(
+    TopAlg=[loader, reader],
+    EvtMax=-1,
+    ExtSvc=[whiteboard],
+    EventLoop=HiveSlimEventLoopMgr(OutputLevel=INFO),
+    MessageSvcType="InertMessageSvc",
+)
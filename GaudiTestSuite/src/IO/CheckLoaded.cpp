@@ -0,0 +1,41 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include <Gaudi/Algorithm.h>
+#include <GaudiKernel/DataObject.h>
+#include <GaudiKernel/IDataProviderSvc.h>
+
+#include <string>
+#include <vector>
+
+namespace Gaudi::TestSuite {
+  /// Print which of the given locations are in the event store, without loading them from the input (to check
+  /// what the previous algorithms and output streams loaded).
+  class CheckLoaded : public Gaudi::Algorithm {
+  public:
+    using Gaudi::Algorithm::Algorithm;
+
+    StatusCode execute( const EventContext& ) const override {
+      auto& log = info() << "loaded:";
+      for ( const auto& path : m_paths.value() ) {
+        DataObject* obj = nullptr;
+        // findObject only looks in the store
+        if ( eventSvc()->findObject( path, obj ).isSuccess() && obj ) log << ' ' << path;
+      }
+      log << endmsg;
+      return StatusCode::SUCCESS;
+    }
+
+  private:
+    Gaudi::Property<std::vector<std::string>> m_paths{ this, "Paths", {}, "locations to check" };
+  };
+
+  DECLARE_COMPONENT( CheckLoaded )
+} // namespace Gaudi::TestSuite
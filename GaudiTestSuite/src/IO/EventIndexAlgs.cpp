@@ -0,0 +1,99 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include <Gaudi/Algorithm.h>
+#include <GaudiKernel/EventIDBase.h>
+#include <GaudiKernel/IEvtSelector.h>
+#include <GaudiKernel/IOpaqueAddress.h>
+#include <GaudiKernel/SerializeSTL.h>
+#include <GaudiKernel/ServiceHandle.h>
+#include <GaudiKernel/ThreadLocalContext.h>
+
+#include <string_view>
+#include <vector>
+
+namespace Gaudi::TestSuite {
+  /// Set run and event numbers in the current event context, as an event loop reading real data would do.
+  /// The run number is incremented every `EventsPerRun` events.
+  class SetEventID : public Gaudi::Algorithm {
+  public:
+    using Gaudi::Algorithm::Algorithm;
+
+    StatusCode execute( const EventContext& ctx ) const override {
+      EventContext updated = ctx;
+      updated.setEventID( EventIDBase( m_firstRun + ctx.evt() / m_eventsPerRun, ctx.evt() ) );
+      Gaudi::Hive::setCurrentContext( updated );
+      return StatusCode::SUCCESS;
+    }
+
+  private:
+    Gaudi::Property<unsigned int> m_firstRun{ this, "FirstRun", 1, "run number of the first event" };
+    Gaudi::Property<unsigned int> m_eventsPerRun{ this, "EventsPerRun", 10, "number of events in each run" };
+  };
+
+  DECLARE_COMPONENT( SetEventID )
+
+  /// Go through the events of an input file with an event selector, printing the entries it visits, then
+  /// exercise the random access methods of the selector (next with a jump, previous and last).
+  class EvtSelectorNavigation : public Gaudi::Algorithm {
+  public:
+    using Gaudi::Algorithm::Algorithm;
+
+    StatusCode execute( const EventContext& ) const override {
+      IEvtSelector::Context* ctx = nullptr;
+      if ( !m_selector->createContext( ctx ) || !m_selector->resetCriteria( m_input, *ctx ) ) {
+        error() << "Cannot open " << m_input.value() << endmsg;
+        return StatusCode::FAILURE;
+      }
+
+      std::vector<long> entries;
+      while ( m_selector->next( *ctx ) ) entries.push_back( entry( *ctx ) );
+      info() << "entries: " << entries << endmsg;
+
+      auto report = [&]( std::string_view step, StatusCode sc ) {
+        auto& log = info();
+        log << step << " -> ";
+        if ( sc ) {
+          log << entry( *ctx );
+        } else {
+          log << "end";
+        }
+        log << endmsg;
+      };
+      m_selector->rewind( *ctx ).ignore();
+      report( "next", m_selector->next( *ctx ) );
+      report( "next(2)", m_selector->next( *ctx, 2 ) );
+      report( "previous", m_selector->previous( *ctx ) );
+      report( "last", m_selector->last( *ctx ) );
+      report( "previous(2)", m_selector->previous( *ctx, 2 ) );
+      report( "next", m_selector->next( *ctx ) );
+      report( "next", m_selector->next( *ctx ) );
+      report( "next", m_selector->next( *ctx ) );
+
+      return m_selector->releaseContext( ctx );
+    }
+
+  private:
+    /// Entry in the event tree of the current event of the iteration
+    long entry( const IEvtSelector::Context& ctx ) const {
+      IOpaqueAddress* addr = nullptr;
+      if ( !m_selector->createAddress( ctx, addr ) || !addr ) return -1;
+      addr->addRef();
+      const long e = addr->ipar()[1];
+      addr->release();
+      return e;
+    }
+
+    ServiceHandle<IEvtSelector>  m_selector{ this, "Selector", "Gaudi::RootEvtSelector/NavigationSelector" };
+    Gaudi::Property<std::string> m_input{ this, "Input", "", "input file, as in EventSelector.Input" };
+  };
+
+  DECLARE_COMPONENT( EvtSelectorNavigation )
+} // namespace Gaudi::TestSuite
@@ -0,0 +1,73 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include <Gaudi/Algorithm.h>
+#include <GaudiKernel/IRndmGenSvc.h>
+#include <GaudiKernel/RndmGenerators.h>
+#include <GaudiKernel/SmartDataPtr.h>
+#include <GaudiTestSuite/Event.h>
+
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+namespace Gaudi::TestSuite {
+  /// Print a few random numbers drawn in each event, together with the event number, to compare the random numbers
+  /// of different jobs processing the same events (e.g. an event captured for replay and its replay).
+  class PrintRandom : public Gaudi::Algorithm {
+  public:
+    using Gaudi::Algorithm::Algorithm;
+
+    StatusCode initialize() override {
+      return Gaudi::Algorithm::initialize().andThen( [&]() -> StatusCode {
+        if ( !m_output.value().empty() ) {
+          m_outputFile.open( m_output.value() );
+          if ( !m_outputFile ) {
+            error() << "Cannot open " << m_output.value() << endmsg;
+            return StatusCode::FAILURE;
+          }
+        }
+        return StatusCode::SUCCESS;
+      } );
+    }
+
+    StatusCode execute( const EventContext& ) const override {
+      SmartDataPtr<Event> evt( eventSvc(), "/Event/Header" );
+      if ( !evt ) {
+        error() << "Cannot retrieve /Event/Header" << endmsg;
+        return StatusCode::FAILURE;
+      }
+      Rndm::Numbers flat( randSvc(), Rndm::Flat( 0., 1. ) );
+      std::string   line = std::format( "event {} random:", evt->event() );
+      // std::format prints the shortest representation that reads back to the same double
+      for ( int i = 0; i < m_count; ++i ) line += std::format( " {}", flat() );
+      info() << line << endmsg;
+      if ( m_outputFile.is_open() ) {
+        std::scoped_lock lock( m_outputMutex );
+        m_outputFile << line << '\n';
+      }
+      return StatusCode::SUCCESS;
+    }
+
+    StatusCode finalize() override {
+      m_outputFile.close();
+      return Gaudi::Algorithm::finalize();
+    }
+
+  private:
+    Gaudi::Property<int>         m_count{ this, "Count", 3, "number of random numbers drawn in each event" };
+    Gaudi::Property<std::string> m_output{ this, "OutputFile", "", "file to write the lines to, in addition" };
+    mutable std::ofstream        m_outputFile;
+    mutable std::mutex           m_outputMutex;
+  };
+
+  DECLARE_COMPONENT( PrintRandom )
+} // namespace Gaudi::TestSuite
@@ -0,0 +1,51 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include <Gaudi/Accumulators.h>
+#include <Gaudi/Functional/Consumer.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+namespace Gaudi::TestSuite {
+  /** Check the records read by Gaudi::RawEventSelector from the files written by options/RawEvent/Read.py.
+   *
+   *  Each record starts with its number (uint64), followed by bytes with the value (number + position) % 251.
+   */
+  struct RawEventReader final : Gaudi::Functional::Consumer<void( const std::span<const std::byte>& )> {
+    RawEventReader( const std::string& name, ISvcLocator* svcLoc )
+        : Consumer( name, svcLoc, { "RawEventLocation", "/Event/RawEvent" } ) {}
+
+    void operator()( const std::span<const std::byte>& record ) const override {
+      std::uint64_t number = 0;
+      if ( record.size() < sizeof( number ) ) {
+        ++m_corrupted;
+        return;
+      }
+      std::memcpy( &number, record.data(), sizeof( number ) );
+      for ( std::size_t i = sizeof( number ); i < record.size(); ++i ) {
+        if ( std::to_integer<std::uint64_t>( record[i] ) != ( number + i ) % 251 ) {
+          ++m_corrupted;
+          return;
+        }
+      }
+      ++m_records;
+      m_bytes += record.size();
+    }
+
+    mutable Gaudi::Accumulators::Counter<> m_records{ this, "Records" };
+    mutable Gaudi::Accumulators::Counter<> m_bytes{ this, "Bytes" };
+    mutable Gaudi::Accumulators::Counter<> m_corrupted{ this, "Corrupted records" };
+  };
+
+  DECLARE_COMPONENT( RawEventReader )
+} // namespace Gaudi::TestSuite
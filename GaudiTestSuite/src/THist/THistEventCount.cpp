@@ -0,0 +1,47 @@
+/***********************************************************************************\
+* (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include <Gaudi/Algorithm.h>
+#include <GaudiKernel/ITHistSvc.h>
+#include <GaudiKernel/ServiceHandle.h>
+
+#include <TH1D.h>
+
+#include <memory>
+
+namespace Gaudi::TestSuite {
+  /// Fill a histogram with the number of each processed event, to check which events were processed by a job.
+  class THistEventCount : public Gaudi::Algorithm {
+  public:
+    using Gaudi::Algorithm::Algorithm;
+
+    StatusCode initialize() override {
+      return Algorithm::initialize().andThen( [&]() -> StatusCode {
+        auto h = std::make_unique<TH1D>( "events", "processed events", m_nEvents.value(), 0., m_nEvents.value() );
+        m_hist = h.get();
+        return m_ths->regHist( m_path, std::move( h ) );
+      } );
+    }
+
+    StatusCode execute( const EventContext& ctx ) const override {
+      m_hist->Fill( ctx.evt() );
+      return StatusCode::SUCCESS;
+    }
+
+  private:
+    ServiceHandle<ITHistSvc>      m_ths{ this, "HistSvc", "THistSvc" };
+    Gaudi::Property<std::string>  m_path{ this, "Path", "/events/events", "THistSvc path of the histogram" };
+    Gaudi::Property<unsigned int> m_nEvents{ this, "NEvents", 100, "number of bins (one per event)" };
+
+    TH1D* m_hist = nullptr;
+  };
+
+  DECLARE_COMPONENT( THistEventCount )
+} // namespace Gaudi::TestSuite
@@ -0,0 +1,58 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+from GaudiTesting import GaudiExeTest
+
+
+def config():
+    """
+    Run a multithreaded job with an algorithm slower than the thresholds of the
+    scheduler watchdog.
+    """
+    from GaudiConfig2 import Configurables as C
+
+    whiteboard = C.HiveWhiteBoard("EventDataSvc", EventSlots=2)
+    scheduler = C.AvalancheSchedulerSvc(
+        ThreadPoolSize=2,
+        SlowEventThreshold=2,
+        SlowAlgorithmThreshold=1,
+        WatchdogPeriod=0.2,
+        SlowEventsFile="slow_events.txt",
+    )
+    slimeventloopmgr = C.HiveSlimEventLoopMgr(SchedulerName=scheduler.name)
+
+    app = C.ApplicationMgr(
+        EvtMax=2,
+        EvtSel="NONE",
+        EventLoop=slimeventloopmgr.toStringProperty(),
+    )
+    app.TopAlg = [C.GaudiTesting.SleepyAlg("Sleepy", SleepTime=3)]
+    app.ExtSvc = [whiteboard]
+
+    return [app, whiteboard, scheduler, slimeventloopmgr] + list(app.TopAlg)
+
+
+class Test(GaudiExeTest):
+    command = ["gaudirun.py", f"{__file__}:config"]
+
+    def test_reports(self, stdout):
+        assert b"algorithm Sleepy running for" in stdout
+        assert b"in flight for" in stdout
+        assert b"stack of the thread running Sleepy" in stdout
+        assert b"Dumping scheduler state" in stdout
+
+    def test_slow_events(self, cwd):
+        lines = (cwd / "slow_events.txt").read_text().splitlines()
+        assert lines[0].startswith("#")
+        records = [line.split() for line in lines[1:]]
+        assert sorted(int(r[0]) for r in records if r[3] == "slow-event") == [0, 1]
+        assert sorted(
+            int(r[0]) for r in records if r[3] == "slow-algorithm:Sleepy"
+        ) == [0, 1]
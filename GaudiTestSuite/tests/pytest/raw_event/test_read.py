@@ -0,0 +1,25 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import re
+
+from GaudiTesting import GaudiExeTest
+
+
+class Test(GaudiExeTest):
+    command = ["gaudirun.py", "-v", "../../../options/RawEvent/Read.py"]
+
+    def test_records(self, stdout):
+        out = stdout.decode()
+        # 500 records in two files (see the options)
+        expected = sum(8 + n * 37 % 4000 for n in range(500))
+        assert re.search(r'\|\s*"Records"\s*\|\s*500 \|', out)
+        assert re.search(r'\|\s*"Bytes"\s*\|\s*%d \|' % expected, out)
+        assert "Corrupted records" not in out
@@ -0,0 +1,31 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import re
+
+from GaudiTesting import GaudiExeTest
+
+
+class Test(GaudiExeTest):
+    command = ["gaudirun.py", "-v", "../../../options/RawEvent/ReadCorrupted.py"]
+
+    def test_rejected(self, stdout):
+        out = stdout.decode()
+        assert re.search(
+            r"bad_offset\.raw: invalid offset of record 0: file skipped", out
+        )
+
+    def test_records(self, stdout):
+        out = stdout.decode()
+        # only the 100 records of the valid file
+        expected = sum(8 + n * 37 % 4000 for n in range(100))
+        assert re.search(r'\|\s*"Records"\s*\|\s*100 \|', out)
+        assert re.search(r'\|\s*"Bytes"\s*\|\s*%d \|' % expected, out)
+        assert "Corrupted records" not in out
@@ -0,0 +1,79 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import re
+
+import pytest
+from GaudiTesting import GaudiExeTest
+
+
+def navigation(stdout, name):
+    """
+    Extract the entries visited by the given EvtSelectorNavigation instance and
+    the result of each navigation step.
+    """
+    prefix = rf"^Nav{name}\s+INFO "
+    entries = re.search(
+        prefix + r"entries: \[(.*)\]$", stdout.decode(), re.MULTILINE
+    ).group(1)
+    steps = re.findall(prefix + r"(.*) -> (\S+)$", stdout.decode(), re.MULTILINE)
+    return [int(e) for e in entries.split(",") if e.strip()], steps
+
+
+@pytest.mark.ctest_fixture_required("root_io_index")
+@pytest.mark.shared_cwd("root_io")
+class Test(GaudiExeTest):
+    command = ["gaudirun.py", "-v", "../../../options/ROOT_IO/ReadEventIndex.py"]
+
+    def test_all_events(self, stdout):
+        entries, steps = navigation(stdout, "All")
+        assert entries == list(range(50))
+        assert steps == [
+            ("next", "0"),
+            ("next(2)", "2"),
+            ("previous", "1"),
+            ("last", "49"),
+            ("previous(2)", "47"),
+            ("next", "48"),
+            ("next", "49"),
+            ("next", "end"),
+        ]
+
+    def test_select_events(self, stdout):
+        entries, steps = navigation(stdout, "ByEvent")
+        # the event 99 of run 9 is not in the file
+        assert entries == [3, 12, 27, 30, 41]
+        assert steps == [
+            ("next", "3"),
+            ("next(2)", "27"),
+            ("previous", "12"),
+            ("last", "41"),
+            ("previous(2)", "27"),
+            ("next", "30"),
+            ("next", "41"),
+            ("next", "end"),
+        ]
+
+    def test_select_runs(self, stdout):
+        entries, steps = navigation(stdout, "ByRun")
+        assert entries == list(range(10, 30))
+        assert steps == [
+            ("next", "10"),
+            ("next(2)", "12"),
+            ("previous", "11"),
+            ("last", "29"),
+            ("previous(2)", "27"),
+            ("next", "28"),
+            ("next", "29"),
+            ("next", "end"),
+        ]
+
+    def test_index_used(self, stdout):
+        assert stdout.count(b"Using event index to select input events") == 2
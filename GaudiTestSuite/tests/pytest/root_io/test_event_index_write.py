@@ -0,0 +1,25 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import os
+
+import pytest
+from GaudiTesting import GaudiExeTest
+
+
+@pytest.mark.ctest_fixture_setup("root_io_index")
+@pytest.mark.shared_cwd("root_io")
+class Test(GaudiExeTest):
+    command = ["gaudirun.py", "-v", "../../../options/ROOT_IO/WriteEventIndex.py"]
+
+    def test_index_written(self, stdout, cwd):
+        assert b"Wrote index of 50 events to ROOTIO_index.dst.gidx" in stdout
+        # header, FID and one 32 bytes record per event
+        assert os.path.getsize(cwd / "ROOTIO_index.dst.gidx") > 50 * 32
@@ -0,0 +1,35 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import re
+
+import pytest
+from GaudiTesting import GaudiExeTest
+
+NEVENTS = 60
+NWORKERS = 3
+
+
+@pytest.mark.ctest_fixture_required("root_io_base")
+@pytest.mark.shared_cwd("root_io")
+class Test(GaudiExeTest):
+    command = ["gaudirun.py", "-v", "../../../options/ROOT_IO/ForkingRead.py"]
+
+    def test_workers(self, stdout):
+        processed = [
+            int(n) for n in re.findall(rb"worker \d+ processed (\d+) events", stdout)
+        ]
+        assert len(processed) == NWORKERS
+        assert sum(processed) == NEVENTS
+
+    def test_events(self, stdout):
+        # together, the workers read each of the first events of the input once
+        events = sorted(int(n) for n in re.findall(rb"========= EVENT:(\d+) ", stdout))
+        assert events == list(range(1, NEVENTS + 1))
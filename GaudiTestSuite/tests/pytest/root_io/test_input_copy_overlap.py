@@ -0,0 +1,37 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import re
+
+import pytest
+from GaudiTesting import GaudiExeTest
+
+
+@pytest.mark.ctest_fixture_required("root_io_base")
+@pytest.mark.shared_cwd("root_io")
+class Test(GaudiExeTest):
+    command = ["gaudirun.py", "-v", "../../../options/ROOT_IO/InputCopyOverlap.py"]
+
+    def test_selected_once(self, stdout):
+        selected = [
+            m.group(1).split()
+            for m in re.finditer(
+                r"CopyOverlap\s+DEBUG Selected \d+ object\(s\):(.*)$",
+                stdout.decode(),
+                re.M,
+            )
+        ]
+        assert len(selected) == 5
+        for paths in selected:
+            # the items overlap with the input leaves
+            assert "/Event/Collision_0" in paths
+            assert "/Event/Collision_0/MyVertices" in paths
+            assert "/Event/MyTracks" in paths
+            assert len(paths) == len(set(paths)), paths
@@ -0,0 +1,73 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import re
+
+import pytest
+from GaudiTesting import GaudiExeTest
+
+
+def selections(out):
+    """
+    Paths of the objects selected by the stream, for each event written.
+    """
+    return [
+        m.group(1).split()
+        for m in re.finditer(r"Selected \d+ object\(s\):(.*)$", out, re.M)
+    ]
+
+
+@pytest.mark.ctest_fixture_required("root_io_base")
+@pytest.mark.shared_cwd("root_io")
+class Test(GaudiExeTest):
+    command = ["gaudirun.py", "-v", "../../../options/ROOT_IO/OutputStreamItems.py"]
+
+    def test_compiled_items(self, stdout):
+        out = stdout.decode()
+        # duplicates merged keeping the largest depth
+        assert re.search(
+            r"ItemsStream\s+DEBUG Compiled ItemList: /Event#1 /Event/Collision_0#2$",
+            out,
+            re.M,
+        )
+        # optional items covered by the mandatory ones dropped
+        assert re.search(
+            r"ItemsStream\s+DEBUG Compiled OptItemList: /Event/MyTracks#1$", out, re.M
+        )
+
+    def test_loaded_on_accept(self, stdout):
+        loaded = [
+            m.group(1).split()
+            for m in re.finditer(
+                r"CheckLoaded\s+INFO loaded:(.*)$", stdout.decode(), re.M
+            )
+        ]
+        assert len(loaded) == 10
+        # the filter accepts the first event, then one out of two
+        for i, paths in enumerate(loaded):
+            if i % 2 == 0:
+                assert paths == [
+                    "/Event/Collision_0",
+                    "/Event/Collision_0/MyVertices",
+                    "/Event/MyTracks",
+                ], i
+            else:
+                assert paths == [], i
+
+    def test_selected(self, stdout):
+        selected = selections(stdout.decode())
+        assert len(selected) == 5
+        for paths in selected:
+            assert sorted(paths) == [
+                "/Event",
+                "/Event/Collision_0",
+                "/Event/Collision_0/MyVertices",
+                "/Event/MyTracks",
+            ]
@@ -0,0 +1,32 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import re
+
+import pytest
+from GaudiTesting import GaudiExeTest
+
+
+@pytest.mark.ctest_fixture_required("root_io_replay_capture")
+@pytest.mark.shared_cwd("root_io")
+class Test(GaudiExeTest):
+    command = ["gaudirun.py", "-v", "../../../options/ROOT_IO/Replay.py"]
+
+    def test_replayed(self, stdout):
+        assert b"Replaying event 2 (requested)" in stdout
+        assert b"Replaying event 5 (requested)" in stdout
+        assert b"2 events replayed" in stdout
+
+    def test_random_numbers(self, stdout, cwd):
+        # the replayed events draw the same random numbers as when they were captured
+        captured = (cwd / "ReplayCaptureRandom.txt").read_text().splitlines()
+        replayed = re.findall(r"event \d+ random:.*", stdout.decode())
+        assert len(replayed) == 2
+        assert all(line in captured for line in replayed)
@@ -0,0 +1,28 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import re
+
+from GaudiTesting import GaudiExeTest
+
+
+class TestAlgToolsCreationTimes(GaudiExeTest):
+    command = [
+        "gaudirun.py",
+        "../../options/AlgTools.py",
+        "--option",
+        "from Configurables import ToolSvc; ToolSvc(ReportCreationTimes=True)",
+    ]
+
+    def test_report(self, stdout):
+        out = stdout.decode()
+        assert "Creation time of the tools, per type" in out
+        for tool_type in ("MyTool", "TestTool"):
+            assert re.search(rf"INFO {tool_type}\s+\|\s+\d+ \|", out), tool_type
@@ -0,0 +1,63 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import re
+
+from GaudiTesting import GaudiExeTest
+
+
+def config():
+    """
+    Run a multithreaded job auditing the heap allocations of the algorithms.
+    """
+    from GaudiConfig2 import Configurables as C
+
+    from Gaudi.Configuration import WARNING
+
+    whiteboard = C.HiveWhiteBoard("EventDataSvc", EventSlots=4)
+    scheduler = C.AvalancheSchedulerSvc(ThreadPoolSize=4, OutputLevel=WARNING)
+    slimeventloopmgr = C.HiveSlimEventLoopMgr(SchedulerName=scheduler.name)
+    auditors = C.AuditorSvc(Auditors=["AllocationAuditor"])
+
+    app = C.ApplicationMgr(
+        EvtMax=20,
+        EvtSel="NONE",
+        EventLoop=slimeventloopmgr.toStringProperty(),
+        AuditAlgorithms=True,
+    )
+    app.TopAlg = [
+        C.Gaudi.TestSuite.VectorDataProducer("Producer", Data=list(range(1000))),
+        C.GaudiTesting.SleepyAlg("Sleepy", SleepTime=0),
+    ]
+    app.ExtSvc = [whiteboard, auditors, "Gaudi::Monitoring::MessageSvcSink"]
+
+    return [app, whiteboard, scheduler, slimeventloopmgr, auditors] + list(app.TopAlg)
+
+
+class Test(GaudiExeTest):
+    command = [
+        "gaudirun.py",
+        "--preload=libGaudiAllocTracker.so",
+        f"{__file__}:config",
+    ]
+
+    def test_allocations(self, stdout):
+        out = stdout.decode()
+        # the producer copies its 1000 ints to the event store at each event
+        m = re.search(
+            r'\|\s*"Producer allocated bytes"\s*\|\s*20 \|\s*\S+ \|\s*(\S+) \|', out
+        )
+        assert m, "missing allocation counters"
+        assert float(m.group(1)) >= 4000
+        assert re.search(r'\|\s*"Sleepy allocations"\s*\|\s*20 \|', out)
+
+    def test_summary(self, stdout):
+        assert b"allocs/exec" in stdout
+        assert b"not preloaded" not in stdout
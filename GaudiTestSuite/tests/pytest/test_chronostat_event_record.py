@@ -0,0 +1,73 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import json
+import struct
+
+from GaudiTesting import GaudiExeTest
+
+
+def read_records(path):
+    """
+    Minimal reader of a ChronoStatSvc.PerEventRecordFile.
+    """
+    data = open(path, "rb").read()
+    magic, version, ncolumns, record_size = struct.unpack_from("<4sIII", data)
+    assert magic == b"GCSR" and version == 1
+    pos = struct.calcsize("<4sIII")
+    columns = []
+    for _ in range(ncolumns):
+        type_, length = struct.unpack_from("<cI", data, pos)
+        pos += struct.calcsize("<cI")
+        columns.append((type_.decode(), data[pos : pos + length].decode()))
+        pos += length
+    assert record_size == 8 * ncolumns
+    fmt = "<" + "".join({"u": "Q", "i": "q", "d": "d"}[t] for t, _ in columns)
+    names = [name for _, name in columns]
+    return [
+        dict(zip(names, struct.unpack_from(fmt, data, offset)))
+        for offset in range(pos, len(data), record_size)
+    ]
+
+
+def config():
+    from GaudiConfig2 import Configurables as C
+
+    app = C.ApplicationMgr(EvtMax=5, EvtSel="NONE", AuditAlgorithms=True)
+    app.TopAlg = [
+        C.Gaudi.TestSuite.VectorDataProducer("Producer", Data=list(range(1000))),
+        C.GaudiTesting.SleepyAlg("Sleepy", SleepTime=0),
+    ]
+    auditors = C.AuditorSvc(Auditors=["ChronoAuditor"])
+    chrono = C.ChronoStatSvc(PerEventRecordFile="events.gcsr", PerEventRecordBuffer=2)
+    sink = C.Gaudi.Monitoring.JSONSink(
+        FileName="events_summary.json", TypesToSave=["chrono:.*"]
+    )
+    app.ExtSvc = [auditors, chrono, sink]
+    return [app, auditors, chrono, sink] + list(app.TopAlg)
+
+
+class TestPerEventRecord(GaudiExeTest):
+    command = ["gaudirun.py", f"{__file__}:config"]
+
+    def test_records(self, cwd):
+        records = read_records(cwd / "events.gcsr")
+        events = [r["event"] for r in records]
+        assert len(events) == 5 and events == sorted(set(events))
+        for r in records:
+            assert r["wall[us]"] >= 0 and r["cpu[us]"] >= 0
+            assert "Producer[us]" in r and "Sleepy[us]" in r
+            assert r["others[us]"] == 0
+
+    def test_summary(self, cwd):
+        (summary,) = json.load(open(cwd / "events_summary.json"))
+        assert summary["component"] == "ChronoStatSvc"
+        assert summary["name"] == "EventRecord"
+        assert summary["entity"]["nEntries"] == 5
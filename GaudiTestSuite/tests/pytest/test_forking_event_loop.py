@@ -0,0 +1,58 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import re
+
+from GaudiTesting import GaudiExeTest
+
+NEVENTS = 20
+NWORKERS = 3
+
+
+def config():
+    """
+    Process the events in forked workers, each writing a histogram of the
+    processed event numbers, merged at the end of the job.
+    """
+    from GaudiConfig2 import Configurables as C
+
+    loop = C.ForkingEventLoopMgr(NumWorkers=NWORKERS, ChunkSize=2)
+    hsvc = C.THistSvc(Output=["events DATAFILE='forked_events.root' OPT='RECREATE'"])
+    alg = C.Gaudi.TestSuite.THistEventCount("EventCount", NEvents=NEVENTS)
+    app = C.ApplicationMgr(
+        EvtMax=NEVENTS,
+        EvtSel="NONE",
+        EventLoop=loop.toStringProperty(),
+        TopAlg=[alg],
+        ExtSvc=[hsvc, C.IoComponentMgr()],
+    )
+    return [app, loop, hsvc, alg]
+
+
+class Test(GaudiExeTest):
+    command = ["gaudirun.py", f"{__file__}:config"]
+
+    def test_events(self, stdout):
+        processed = [
+            int(n) for n in re.findall(rb"worker \d+ processed (\d+) events", stdout)
+        ]
+        assert len(processed) == NWORKERS
+        assert sum(processed) == NEVENTS
+        assert f"all workers completed, {NEVENTS} events processed".encode() in stdout
+
+    def test_merged_output(self, cwd):
+        import ROOT
+
+        f = ROOT.TFile.Open(str(cwd / "forked_events.root"))
+        h = f.Get("events")
+        assert h, "missing merged histogram"
+        assert h.GetEntries() == NEVENTS
+        # every event processed exactly once
+        assert all(h.GetBinContent(i + 1) == 1 for i in range(NEVENTS))
@@ -0,0 +1,115 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+import gzip
+import re
+import struct
+from subprocess import check_output
+
+import pytest
+from GaudiTesting import GaudiExeTest
+
+
+def read_records(path):
+    """
+    Minimal reader of the records of a HistorySvc.CompactOutputFile.
+    """
+    data = gzip.open(path).read()
+    pos = 0
+
+    def unpack(fmt):
+        nonlocal pos
+        values = struct.unpack_from("<" + fmt, data, pos)
+        pos += struct.calcsize("<" + fmt)
+        return values
+
+    def string():
+        nonlocal pos
+        (n,) = unpack("I")
+        pos += n
+        return data[pos - n : pos].decode()
+
+    records = []
+    while pos < len(data):
+        magic, version, config_hash, _start = unpack("4sBQq")
+        assert magic == b"GPRV" and version == 1
+        record = {"hash": config_hash, "host": string(), "components": None}
+        (with_config,) = unpack("B")
+        if with_config:
+            strings = [string() for _ in range(unpack("I")[0])]
+            record["components"] = components = {}
+            for _ in range(unpack("I")[0]):
+                _kind, type_, name, nprops = unpack("BIII")
+                props = dict(
+                    (strings[k], strings[v])
+                    for k, v in (unpack("II") for _ in range(nprops))
+                )
+                components[strings[name]] = (strings[type_], props)
+        records.append(record)
+    return records
+
+
+def history_command(*options):
+    return ["gaudirun.py", "../../options/History.opts"] + [
+        arg
+        for opt in (
+            "from Configurables import HistorySvc; "
+            "HistorySvc(CompactOutputFile='history_compact.gprov')",
+        )
+        + options
+        for arg in ("--option", opt)
+    ]
+
+
+class TestHistoryCompact(GaudiExeTest):
+    """
+    Run the same job twice appending the provenance to the same file: the
+    configuration must be stored only by the first job. A third job recording
+    only the compact provenance has a different configuration (CompactOnly).
+    """
+
+    # the file is removed when configuring the first job, so that it only
+    # contains the records of this test
+    command = history_command(
+        "import os; os.path.exists('history_compact.gprov') "
+        "and os.remove('history_compact.gprov')"
+    )
+
+    @pytest.fixture(scope="class")
+    def more_jobs(self, stdout, cwd):
+        return [
+            check_output(
+                [self.resolve_path(arg) for arg in history_command(*options)],
+                cwd=cwd,
+            )
+            for options in ((), ("HistorySvc().CompactOnly = True",))
+        ]
+
+    def test_records(self, stdout, cwd, more_jobs):
+        assert b"Provenance appended to history_compact.gprov" in stdout
+        records = read_records(cwd / "history_compact.gprov")
+        assert len(records) == 3
+        first, second, compact_only = records
+
+        components = first["components"]
+        assert components["History"][0] == "History"
+        assert components["HistorySvc"][1]["CompactOutputFile"] == (
+            "'history_compact.gprov'"
+        )
+        assert components["JobOptions"][1]["ApplicationMgr.EvtMax"] == "2"
+
+        assert second["hash"] == first["hash"]
+        assert second["components"] is None
+        assert b"already stored" in more_jobs[0]
+
+        assert compact_only["hash"] != first["hash"]
+        assert compact_only["components"].keys() == components.keys()
+        assert compact_only["components"]["HistorySvc"][1]["CompactOnly"] == "True"
+        assert not re.search(rb"Registered \d+ Algorithms", more_jobs[1])
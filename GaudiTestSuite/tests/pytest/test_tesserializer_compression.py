@@ -0,0 +1,71 @@
+#####################################################################################
+# (c) Copyright 2026 CERN for the benefit of the LHCb and ATLAS collaborations      #
+#                                                                                   #
+# This software is distributed under the terms of the Apache version 2 licence,     #
+# copied verbatim in the file "LICENSE".                                            #
+#                                                                                   #
+# In applying this licence, CERN does not waive the privileges and immunities       #
+# granted to it by virtue of its status as an Intergovernmental Organization        #
+# or submit itself to any jurisdiction.                                             #
+#####################################################################################
+"""
+Check that the objects serialized by GaudiMP::TESSerializer with compression are
+restored identical by loadBuffer, and that the compression actually shrinks the
+buffer.
+"""
+
+
+def test(capfd):
+    import GaudiPython
+    import ROOT
+
+    gbl = GaudiPython.gbl
+    MyTrack = gbl.Gaudi.TestSuite.MyTrack
+    Tracks = gbl.ObjectVector[MyTrack]
+    n_tracks = 1000
+
+    app = GaudiPython.AppMgr()
+    app.start()
+    tes = app.evtsvc()
+    persistency = app.service("EventPersistencySvc", "IAddressCreator")
+
+    def fill_store():
+        tes.clearStore()
+        root = gbl.DataObject()
+        # Once the objects are registered the TES will clean them up
+        ROOT.SetOwnership(root, False)
+        tes.setRoot("/Event", root)
+        tracks = Tracks()
+        ROOT.SetOwnership(tracks, False)
+        for i in range(n_tracks):
+            track = MyTrack(1.0, 2.0, float(i % 10))
+            ROOT.SetOwnership(track, False)
+            tracks.push_back(track)
+        tes["/Event/Tracks"] = tracks
+
+    def dump(level):
+        fill_store()
+        serializer = gbl.GaudiMP.TESSerializer(tes._idp, persistency)
+        serializer.addItem("/Event#99")
+        serializer.setCompressionLevel(level)
+        buffer = ROOT.TBufferFile(ROOT.TBuffer.kWrite)
+        serializer.dumpBuffer(buffer)
+        return serializer, buffer
+
+    plain_serializer, plain = dump(0)
+    serializer, compressed = dump(4)
+    print("plain buffer:", plain.Length(), "compressed buffer:", compressed.Length())
+    assert 0 < compressed.Length() < plain.Length() / 2
+
+    for s, buffer in [(plain_serializer, plain), (serializer, compressed)]:
+        tes.clearStore()
+        s.loadBuffer(buffer)
+        tracks = tes["/Event/Tracks"]
+        assert tracks, "/Event/Tracks not restored"
+        assert tracks.size() == n_tracks
+        assert [(t.px(), t.py(), t.pz()) for t in tracks] == [
+            (1.0, 2.0, float(i % 10)) for i in range(n_tracks)
+        ]
+
+    stderr = capfd.readouterr().err.strip()
+    assert not stderr, "stderr must be empty"
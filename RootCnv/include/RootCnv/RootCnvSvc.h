@@ -21,8 +21,10 @@
 #include <GaudiKernel/ConversionSvc.h>
 #include <GaudiKernel/DataObject.h>
 #include <GaudiUtils/IIODataManager.h>
+#include <RootCnv/RootEventIndex.h>
 
 // C++ include files
+#include <map>
 #include <set>
 
 // Forward declarations
@@ -78,6 +80,9 @@ namespace Gaudi {
     Gaudi::Property<int> m_splitLevel{ this, "SplitLevel", 0, "Split level optimization parameter for ROOT TTree" };
     Gaudi::Property<std::string> m_compression{ this, "GlobalCompression", "",
                                                 "Compression-algorithm:compression-level,  empty: do nothing" };
+    Gaudi::Property<bool>        m_writeIndex{
+        this, "WriteEventIndex", false,
+        "Write an event index (RootEventIndex) next to each output file, at finalize" };
 
     /// Reference to the I/O data manager
     SmartIF<Gaudi::IIODataManager> m_ioMgr;
@@ -96,6 +101,8 @@ namespace Gaudi {
 
     /// Set with bad files/tables
     std::set<std::string> m_badFiles;
+    /// Event indices of the output files (by physical file name)
+    std::map<std::string, RootEventIndex> m_eventIndices;
 
     /// Message streamer
     std::unique_ptr<MsgStream> m_log;
@@ -0,0 +1,88 @@
+/***********************************************************************************\
+* (c) Copyright 1998-2026 CERN for the benefit of the LHCb and ATLAS collaborations *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#pragma once
+
+// Framework include files
+#include <GaudiKernel/Kernel.h>
+
+// C++ include files
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/*
+ *  Gaudi namespace declaration
+ */
+namespace Gaudi {
+
+  /** @class RootEventIndex RootEventIndex.h RootCnv/RootEventIndex.h
+   *
+   *  Compact index of the events stored in a ROOT file, written by RootCnvSvc next to the data file
+   *  (see the property `RootCnvSvc.WriteEventIndex`) and used by RootEvtSelector to read only selected events.
+   *
+   *  The index maps the identifier of each event (run, event number, luminosity block and time stamp, taken
+   *  from the EventContext of the event) to the entry in the event tree of the file with the given FID.
+   *
+   *  The sidecar file (name of the data file plus `suffix`) contains a small header, the FID and the array of
+   *  records sorted by (run, event). RootCnvSvc writes it at finalize, in one go: a job that does not finalize
+   *  (e.g. because it crashed) leaves no index, and a selection cannot be applied to its output.
+   */
+  class GAUDI_API RootEventIndex {
+  public:
+    /// Index entry
+    struct Record {
+      std::uint32_t run   = 0;
+      std::uint32_t lumi  = 0;
+      std::uint64_t event = 0;
+      std::uint64_t time  = 0;
+      std::int64_t  entry = -1;
+
+      friend bool operator<( const Record& a, const Record& b ) {
+        return std::tie( a.run, a.event, a.entry ) < std::tie( b.run, b.event, b.entry );
+      }
+    };
+    using Records = std::vector<Record>;
+
+    /// Suffix added to the name of the data file to get the name of its index
+    static constexpr const char* suffix = ".gidx";
+
+    /// Standard constructor
+    RootEventIndex() = default;
+    /// Initializing constructor
+    explicit RootEventIndex( std::string fid ) : m_fid( std::move( fid ) ) {}
+
+    /// FID of the indexed file
+    const std::string& fid() const { return m_fid; }
+    /// Access to the records (sorted after read() or write())
+    const Records& records() const { return m_records; }
+    /// Number of indexed events
+    std::size_t size() const { return m_records.size(); }
+
+    /// Add an event to the index
+    void add( const Record& rec ) { m_records.push_back( rec ); }
+
+    /// Entries of the events with the given run and event number
+    std::pair<Records::const_iterator, Records::const_iterator> find( std::uint32_t run, std::uint64_t event ) const;
+
+    /// Write the index to the given file (the records are sorted first)
+    bool write( const std::string& path );
+    /// Read the index from the given file (false if it is missing, truncated or inconsistent)
+    bool read( const std::string& path );
+
+  private:
+    /// FID of the indexed file
+    std::string m_fid;
+    /// Index records
+    Records m_records;
+  };
+} // namespace Gaudi
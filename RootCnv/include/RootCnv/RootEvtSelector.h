@@ -28,6 +28,11 @@
 // Framework include files
 #include <GaudiKernel/IEvtSelector.h>
 #include <GaudiKernel/Service.h>
+#include <RootCnv/RootEventIndex.h>
+
+// C++ include files
+#include <functional>
+#include <set>
 
 /*
  *  Gaudi namespace declaration
@@ -36,11 +41,17 @@ namespace Gaudi {
 
   // Forward declarations
   class RootCnvSvc;
+  class RootDataConnection;
+  class RootEvtSelectorContext;
 
   /** @class RootEvtSelector RootEvtSelector.h GAUDIROOT/RootEvtSelector.h
    *
    *  Concrete event selector implementation to access ROOT files.
    *
+   *  If the input files come with an event index (see RootEventIndex), the events to process can be chosen
+   *  with the properties `SelectEvents` and `SelectRuns` or with a filter function (see setEventFilter), so
+   *  that only the selected entries are read (and prefetched by the TTreeCache).
+   *
    *  @author  M.Frank
    *  @version 1.0
    *  @date    20/12/2009
@@ -50,10 +61,22 @@ namespace Gaudi {
     /// Helper method to issue error messages
     StatusCode error( const std::string& msg ) const;
 
+    /// Helper method to restrict the entries of a newly connected file to the selected ones
+    void applySelection( RootEvtSelectorContext& ctxt, RootDataConnection& con ) const;
+
   public:
+    /// Definition of the filter function used to select events from the index
+    typedef std::function<bool( const RootEventIndex::Record& )> EventFilter;
+
     /// Service Constructor
     using extends::extends;
 
+    /// Set a function to select the events to read from the event index of the input files
+    void setEventFilter( EventFilter filter ) { m_filter = std::move( filter ); }
+
+    /// Tell if the events are selected using the event index
+    bool useEventIndex() const { return m_filter || !m_events.empty() || !m_selectRuns.empty(); }
+
     /// IService implementation: Db event selector override
     StatusCode initialize() override;
 
@@ -141,6 +164,15 @@ namespace Gaudi {
     Gaudi::Property<std::string> m_persName{ this, "EvtPersistencySvc", "EventPersistencySvc",
                                              "Name of the persistency service to search for conversion service" };
     Gaudi::Property<std::string> m_dummy{ this, "DbType", "", "dummy property to fake backwards compatibility" };
+    Gaudi::Property<std::vector<std::string>> m_selectEvents{
+        this, "SelectEvents", {}, "list of events to read, as \"run:event\" (requires the event index)" };
+    Gaudi::Property<std::vector<std::pair<int, int>>> m_selectRuns{
+        this, "SelectRuns", {}, "list of inclusive ranges of run numbers to read (requires the event index)" };
+
+    /// Parsed content of the property SelectEvents
+    std::set<std::pair<std::uint32_t, std::uint64_t>> m_events;
+    /// Filter function for the events in the event index
+    EventFilter m_filter;
 
     /// Property; Name of the concversion service used to create opaque addresses
     std::string m_cnvSvcName = "Gaudi::RootCnvSvc/RootCnvSvc";
@@ -31,6 +31,7 @@
 #include <GaudiKernel/LinkManager.h>
 #include <GaudiKernel/MsgStream.h>
 #include <GaudiKernel/System.h>
+#include <GaudiKernel/ThreadLocalContext.h>
 #include <RootCnv/RootAddress.h>
 #include <RootCnv/RootCnvSvc.h>
 #include <RootCnv/RootConverter.h>
@@ -116,6 +117,15 @@ StatusCode RootCnvSvc::initialize() {
 
 // Finalize the Db data persistency service
 StatusCode RootCnvSvc::finalize() {
+  for ( auto& [pfn, index] : m_eventIndices ) {
+    string idx = pfn + RootEventIndex::suffix;
+    if ( index.write( idx ) ) {
+      log() << MSG::INFO << "Wrote index of " << index.size() << " events to " << idx << endmsg;
+    } else {
+      log() << MSG::WARNING << "Failed to write event index " << idx << endmsg;
+    }
+  }
+  m_eventIndices.clear();
   log() << MSG::INFO;
   if ( m_ioMgr ) {
     IIODataManager::Connections cons = m_ioMgr->connections( nullptr );
@@ -340,6 +350,24 @@ StatusCode RootCnvSvc::commitOutput( CSTR dsn, bool /* doCommit */ ) {
       if ( log().level() <= MSG::DEBUG )
         log() << MSG::DEBUG << "Set section entries of " << m_currSection << " to " << long( evt ) << " entries."
               << endmsg;
+      if ( m_writeIndex && section == m_setup->loadSection ) {
+        // index the event with the identifier in the current context, or with its position if not available
+        const auto&            ctx = Gaudi::Hive::currentContext();
+        const auto&            eid = ctx.eventID();
+        RootEventIndex::Record rec;
+        rec.entry = evt - 1;
+        if ( eid.isRunEvent() ) {
+          rec.run   = eid.run_number();
+          rec.event = eid.event_number();
+        } else {
+          rec.event = ctx.valid() ? ctx.evt() : rec.entry;
+        }
+        if ( eid.isLumiEvent() ) rec.lumi = eid.lumi_block();
+        if ( eid.isTimeStamp() ) rec.time = eid.time_stamp();
+        auto& index = m_eventIndices[m_current->pfn()];
+        if ( index.fid().empty() ) index = RootEventIndex( m_current->fid() );
+        index.add( rec );
+      }
     } else {
       return error( "commitOutput> Failed to update entry numbers on " + dsn );
     }
@@ -0,0 +1,82 @@
+/***********************************************************************************\
+* (c) Copyright 1998-2026 CERN for the benefit of the LHCb and ATLAS collaborations *
+*                                                                                   *
+* This software is distributed under the terms of the Apache version 2 licence,     *
+* copied verbatim in the file "LICENSE".                                            *
+*                                                                                   *
+* In applying this licence, CERN does not waive the privileges and immunities       *
+* granted to it by virtue of its status as an Intergovernmental Organization        *
+* or submit itself to any jurisdiction.                                             *
+\***********************************************************************************/
+#include <RootCnv/RootEventIndex.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+using namespace Gaudi;
+using namespace std;
+
+namespace {
+  constexpr char s_magic[8] = { 'G', 'A', 'U', 'D', 'I', 'I', 'D', 'X' };
+
+  /// On-disk header of the index file (native byte order)
+  struct Header {
+    char          magic[8];
+    std::uint32_t version;
+    std::uint32_t fidLength;
+    std::uint64_t nRecords;
+  };
+  static_assert( sizeof( RootEventIndex::Record ) == 32, "unexpected padding in RootEventIndex::Record" );
+} // namespace
+
+pair<RootEventIndex::Records::const_iterator, RootEventIndex::Records::const_iterator>
+RootEventIndex::find( std::uint32_t run, std::uint64_t event ) const {
+  auto key = []( const Record& r ) { return std::pair{ r.run, r.event }; };
+  auto lb  = lower_bound( m_records.begin(), m_records.end(), std::pair{ run, event },
+                          [&]( const Record& r, const auto& k ) { return key( r ) < k; } );
+  auto ub  = upper_bound( lb, m_records.end(), std::pair{ run, event },
+                          [&]( const auto& k, const Record& r ) { return k < key( r ); } );
+  return { lb, ub };
+}
+
+bool RootEventIndex::write( const string& path ) {
+  sort( m_records.begin(), m_records.end() );
+  ofstream out( path, ios::binary | ios::trunc );
+  if ( !out ) return false;
+  Header hdr{};
+  memcpy( hdr.magic, s_magic, sizeof( s_magic ) );
+  hdr.version   = 1;
+  hdr.fidLength = m_fid.size();
+  hdr.nRecords  = m_records.size();
+  out.write( reinterpret_cast<const char*>( &hdr ), sizeof( hdr ) );
+  out.write( m_fid.data(), m_fid.size() );
+  out.write( reinterpret_cast<const char*>( m_records.data() ), m_records.size() * sizeof( Record ) );
+  return out.good();
+}
+
+bool RootEventIndex::read( const string& path ) {
+  ifstream in( path, ios::binary | ios::ate );
+  if ( !in ) return false;
+  const auto fileSize = static_cast<std::uint64_t>( in.tellg() );
+  in.seekg( 0 );
+  Header hdr{};
+  if ( !in.read( reinterpret_cast<char*>( &hdr ), sizeof( hdr ) ) ) return false;
+  if ( memcmp( hdr.magic, s_magic, sizeof( s_magic ) ) != 0 || hdr.version != 1 ) return false;
+  // a truncated or corrupted file must not make us allocate more than what it can contain
+  const std::uint64_t payload = fileSize - sizeof( hdr );
+  if ( hdr.fidLength > payload || hdr.nRecords != ( payload - hdr.fidLength ) / sizeof( Record ) ||
+       ( payload - hdr.fidLength ) % sizeof( Record ) != 0 ) {
+    return false;
+  }
+  m_fid.resize( hdr.fidLength );
+  m_records.resize( hdr.nRecords );
+  in.read( m_fid.data(), m_fid.size() );
+  in.read( reinterpret_cast<char*>( m_records.data() ), m_records.size() * sizeof( Record ) );
+  if ( !in ) {
+    m_fid.clear();
+    m_records.clear();
+    return false;
+  }
+  return true;
+}
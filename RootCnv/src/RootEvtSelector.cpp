@@ -19,6 +19,9 @@
 #include <RootCnv/RootDataConnection.h>
 #include <RootCnv/RootEvtSelector.h>
 #include <TBranch.h>
+#include <TEntryList.h>
+#include <TTree.h>
+#include <algorithm>
 #include <vector>
 
 // Forward declarations
@@ -51,6 +54,14 @@ namespace Gaudi {
     Files::const_iterator m_fiter;
     /// Current entry of current file
     long m_entry;
+    /// Position of the current entry in the list of entries to read from the current file
+    long m_pos = -1;
+    /// Number of entries in the current file
+    long m_nEntries = 0;
+    /// Entries to read from the current file, if an event selection is used
+    std::vector<long> m_selected;
+    /// Flag telling if only the selected entries of the current file are read
+    bool m_useSelection = false;
     /// Reference to the top level branch (typically /Event) used to iterate
     TBranch* m_branch;
     /// Connection fid
@@ -76,7 +87,30 @@ namespace Gaudi {
     /// Access to the current event entry number
     long entry() const { return m_entry; }
     /// Set current event entry number
-    void setEntry( long e ) { m_entry = e; }
+    void setEntry( long e ) { m_entry = m_pos = e; }
+    /// Position of the current entry in the entries to read from the current file
+    long position() const { return m_pos; }
+    /// Number of entries still to be read from the current file
+    long remaining() const { return ( m_useSelection ? long( m_selected.size() ) : m_nEntries ) - m_pos - 1; }
+    /// Move forward (or backward) in the entries to read from the current file
+    void advance( long n ) {
+      m_pos += n;
+      m_entry = m_useSelection ? m_selected[m_pos] : m_pos;
+    }
+    /// Restrict the entries to read from the current file (and let the TTreeCache prefetch only those)
+    void setSelection( std::vector<long> entries ) {
+      m_selected     = std::move( entries );
+      m_useSelection = true;
+      if ( m_branch ) {
+        TTree* tree = m_branch->GetTree();
+        auto   list = new TEntryList( tree );
+        list->SetDirectory( nullptr );
+        for ( long e : m_selected ) list->Enter( e );
+        // the tree owns the list
+        list->SetBit( TObject::kCanDelete );
+        tree->SetEntryList( list );
+      }
+    }
     /// Set connection FID
     void setFID( const std::string& fid ) { m_fid = fid; }
     /// Access connection fid
@@ -84,7 +118,13 @@ namespace Gaudi {
     /// Access to the top level branch (typically /Event) used to iterate
     TBranch* branch() const { return m_branch; }
     /// Set the top level branch (typically /Event) used to iterate
-    void setBranch( TBranch* b ) { m_branch = b; }
+    void setBranch( TBranch* b ) {
+      if ( m_branch && m_useSelection ) m_branch->GetTree()->SetEntryList( nullptr );
+      m_useSelection = false;
+      m_selected.clear();
+      m_branch   = b;
+      m_nEntries = b ? b->GetEntries() : 0;
+    }
   };
 } // namespace Gaudi
 
@@ -129,6 +169,18 @@ StatusCode RootEvtSelector::initialize() {
   m_rootName = eds->rootName();
   MsgStream log( msgSvc(), name() );
   log << MSG::DEBUG << "Selection root:" << m_rootName << " CLID:" << m_rootCLID << endmsg;
+
+  m_events.clear();
+  for ( const auto& evt : m_selectEvents ) {
+    size_t sep = evt.find( ':' );
+    try {
+      if ( sep == string::npos ) throw invalid_argument( evt );
+      m_events.emplace( stoul( evt.substr( 0, sep ) ), stoull( evt.substr( sep + 1 ) ) );
+    } catch ( const exception& ) {
+      return error( "Invalid event specification \"" + evt + "\" (expected run:event)" );
+    }
+  }
+  if ( useEventIndex() ) log << MSG::INFO << "Using event index to select input events" << endmsg;
   return status;
 }
 
@@ -147,7 +199,68 @@ StatusCode RootEvtSelector::createContext( Context*& refpCtxt ) const {
 }
 
 // Access last item in the iteration
-StatusCode RootEvtSelector::last( Context& /*refContext*/ ) const { return StatusCode::FAILURE; }
+StatusCode RootEvtSelector::last( Context& ctxt ) const {
+  RootEvtSelectorContext* pCtxt = dynamic_cast<RootEvtSelectorContext*>( &ctxt );
+  if ( pCtxt && !pCtxt->files().empty() ) {
+    auto fileit = pCtxt->fileIterator();
+    auto lastit = std::prev( pCtxt->files().end() );
+    if ( fileit != lastit ) {
+      pCtxt->setBranch( nullptr );
+      if ( fileit != pCtxt->files().end() ) m_dbMgr->disconnect( *fileit ).ignore();
+      pCtxt->setFID( "" );
+      pCtxt->setEntry( -1 );
+      pCtxt->setFileIterator( lastit );
+    }
+    if ( !pCtxt->branch() ) {
+      StatusCode status = next( ctxt );
+      if ( !status.isSuccess() ) return status;
+    }
+    if ( long n = pCtxt->remaining(); n > 0 ) pCtxt->advance( n );
+    return StatusCode::SUCCESS;
+  }
+  return StatusCode::FAILURE;
+}
+
+// Restrict the entries of a newly connected file to the selected ones
+void RootEvtSelector::applySelection( RootEvtSelectorContext& ctxt, RootDataConnection& con ) const {
+  MsgStream      log( msgSvc(), name() );
+  RootEventIndex index;
+  const string   path = con.pfn() + RootEventIndex::suffix;
+  vector<long>   entries;
+  if ( index.read( path ) ) {
+    if ( index.fid() != con.fid() ) {
+      log << MSG::WARNING << "Event index " << path << " was written for FID " << index.fid() << " instead of "
+          << con.fid() << endmsg;
+    }
+    auto accept = [this]( const RootEventIndex::Record& r ) {
+      auto inRange = [&r]( const pair<int, int>& range ) {
+        return long( r.run ) >= range.first && long( r.run ) <= range.second;
+      };
+      if ( !m_selectRuns.empty() && none_of( m_selectRuns.begin(), m_selectRuns.end(), inRange ) ) return false;
+      return !m_filter || m_filter( r );
+    };
+    if ( !m_events.empty() ) {
+      for ( const auto& [run, evt] : m_events ) {
+        auto [first, last] = index.find( run, evt );
+        for ( ; first != last; ++first ) {
+          if ( accept( *first ) ) entries.push_back( first->entry );
+        }
+      }
+    } else {
+      for ( const auto& r : index.records() ) {
+        if ( accept( r ) ) entries.push_back( r.entry );
+      }
+    }
+    sort( entries.begin(), entries.end() );
+    entries.erase( unique( entries.begin(), entries.end() ), entries.end() );
+    log << MSG::DEBUG << "Selected " << entries.size() << " of " << index.size() << " events from " << con.pfn()
+        << endmsg;
+  } else {
+    log << MSG::ERROR << "Cannot read event index " << path << ": no event will be read from " << con.pfn()
+        << endmsg;
+  }
+  ctxt.setSelection( std::move( entries ) );
+}
 
 // Get next iteration item from the event loop context
 StatusCode RootEvtSelector::next( Context& ctxt ) const {
@@ -168,6 +281,7 @@ StatusCode RootEvtSelector::next( Context& ctxt ) const {
           if ( b ) {
             pCtxt->setFID( con->fid() );
             pCtxt->setBranch( b );
+            if ( useEventIndex() ) applySelection( *pCtxt, *con );
             return next( ctxt );
           }
         }
@@ -177,10 +291,8 @@ StatusCode RootEvtSelector::next( Context& ctxt ) const {
       }
       return StatusCode::FAILURE;
     }
-    long     ent  = pCtxt->entry();
-    Long64_t nent = b->GetEntries();
-    if ( nent > ( ent + 1 ) ) {
-      pCtxt->setEntry( ++ent );
+    if ( pCtxt->remaining() > 0 ) {
+      pCtxt->advance( 1 );
       return StatusCode::SUCCESS;
     }
     auto fit = pCtxt->fileIterator();
@@ -195,10 +307,18 @@ StatusCode RootEvtSelector::next( Context& ctxt ) const {
 
 // Get next iteration item from the event loop context
 StatusCode RootEvtSelector::next( Context& ctxt, int jump ) const {
-  if ( jump > 0 ) {
-    for ( int i = 0; i < jump; ++i ) {
-      StatusCode status = next( ctxt );
-      if ( !status.isSuccess() ) { return status; }
+  RootEvtSelectorContext* pCtxt = dynamic_cast<RootEvtSelectorContext*>( &ctxt );
+  if ( pCtxt && jump > 0 ) {
+    // move directly to the requested entry of the current file, stepping only to open the next file
+    while ( jump > 0 ) {
+      if ( long n = std::min<long>( jump, pCtxt->remaining() ); n > 0 ) {
+        pCtxt->advance( n );
+        jump -= n;
+      } else {
+        StatusCode status = next( ctxt );
+        if ( !status.isSuccess() ) { return status; }
+        --jump;
+      }
     }
     return StatusCode::SUCCESS;
   }
@@ -206,18 +326,17 @@ StatusCode RootEvtSelector::next( Context& ctxt, int jump ) const {
 }
 
 // Get previous iteration item from the event loop context
-StatusCode RootEvtSelector::previous( Context& /* ctxt */ ) const {
-  return error( "EventSelector Iterator, operator -- not supported " );
-}
+StatusCode RootEvtSelector::previous( Context& ctxt ) const { return previous( ctxt, 1 ); }
 
 // Get previous iteration item from the event loop context
 StatusCode RootEvtSelector::previous( Context& ctxt, int jump ) const {
-  if ( jump > 0 ) {
-    for ( int i = 0; i < jump; ++i ) {
-      StatusCode status = previous( ctxt );
-      if ( !status.isSuccess() ) { return status; }
+  RootEvtSelectorContext* pCtxt = dynamic_cast<RootEvtSelectorContext*>( &ctxt );
+  if ( pCtxt && jump > 0 ) {
+    if ( pCtxt->branch() && pCtxt->position() >= jump ) {
+      pCtxt->advance( -jump );
+      return StatusCode::SUCCESS;
     }
-    return StatusCode::SUCCESS;
+    return error( "EventSelector Iterator, operator -- not supported across file boundaries" );
   }
   return StatusCode::FAILURE;
 }
@@ -227,13 +346,13 @@ StatusCode RootEvtSelector::rewind( Context& ctxt ) const {
   RootEvtSelectorContext* pCtxt = dynamic_cast<RootEvtSelectorContext*>( &ctxt );
   if ( pCtxt ) {
     auto fileit = pCtxt->fileIterator();
+    pCtxt->setBranch( nullptr );
     if ( fileit != pCtxt->files().end() ) {
       string input = *fileit;
       m_dbMgr->disconnect( input ).ignore();
     }
     pCtxt->setFID( "" );
     pCtxt->setEntry( -1 );
-    pCtxt->setBranch( nullptr );
     pCtxt->setFileIterator( pCtxt->files().begin() );
     return StatusCode::SUCCESS;
   }